@@ -19,6 +19,11 @@
 #include "DDCond/ConditionsPool.h"
 #include "DDCond/ConditionsManager.h"
 
+// C/C++ include files
+#include <mutex>
+#include <string>
+#include <vector>
+
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
 
@@ -44,6 +49,15 @@ namespace dd4hep {
      *  ConditionResolver interface in order to allow for upgrades of
      *  this implementation which might not be polymorph.
      *
+     *  If the conditions manager property "ComputeThreads" is bigger than 1,
+     *  the creation callbacks are executed in parallel: the work items are
+     *  sorted into levels according to their declared dependencies and all
+     *  items of one level are processed concurrently. Results are identical
+     *  to the sequential execution. Callbacks must declare all dependencies
+     *  on other derived conditions. Conditions registered by callbacks
+     *  (registerOne/registerMany) are only inserted at the end of each level.
+     *  Dependency cycles cause a fall back to the sequential execution.
+     *
      *  \author  M.Frank
      *  \version 1.0
      */
@@ -65,6 +79,8 @@ namespace dd4hep {
         int                        callstack = 0;
         /// Current conversion state of the item
         State                      state     = INVALID;
+        /// Time spent in the creation callback (if timing is enabled)
+        double                     seconds   = 0e0;
       public:
         /// Inhibit default constructor
         Work() = delete;
@@ -85,6 +101,14 @@ namespace dd4hep {
       };
       typedef std::map<Condition::key_type, const ConditionDependency*>  Dependencies;
       typedef std::map<Condition::key_type, Work*> WorkConditions;
+      /// Timing information of one type of update callback
+      struct CallbackTiming  {
+        /// Number of callback invocations
+        std::size_t calls   = 0;
+        /// Total time spent in the callbacks
+        double      seconds = 0e0;
+      };
+      typedef std::map<std::string, CallbackTiming> Timing;
 
     protected:
       /// Reference to conditions manager 
@@ -103,15 +127,29 @@ namespace dd4hep {
       State                       m_state = CREATED;
       /// Current block work item
       Work*                       m_block = 0;
-      /// Current item of the block
-      Work*                       m_currentWork = 0;
+      /// Lock protecting the work items while callbacks execute in parallel
+      std::recursive_mutex        m_lock;
+      /// Conditions registered by callbacks during a parallel level
+      std::vector<std::pair<IOV, std::vector<Condition> > > m_deferred;
+      /// Flag set while the creation callbacks execute in parallel
+      bool                        m_parallel = false;
+      /// Flag to measure the execution time of the creation callbacks
+      bool                        m_doTiming = false;
     public:
       /// Number of callbacks to the handler for monitoring
       mutable size_t              num_callback;
+      /// Execution time per callback type. Only filled if enabled by the conditions manager
+      Timing                      timing;
 
     protected:
       /// Internal call to trigger update callback
       void do_callback(Work* dep);
+      /// Sort the work items into levels of independent items. Returns false on dependency cycles
+      bool build_levels(std::vector<std::vector<Work*> >& levels)  const;
+      /// Execute the creation callbacks level by level using a number of threads
+      void compute_parallel(const std::vector<std::vector<Work*> >& levels, size_t num_threads);
+      /// Accumulate the callback timing of all work items
+      void collect_timing();
 
     public:
       /// Initializing constructor
@@ -18,7 +18,11 @@
 
 // C/C++ include files
 #include <map>
+#include <mutex>
+#include <atomic>
 #include <memory>
+#include <vector>
+#include <shared_mutex>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -26,11 +30,66 @@ namespace dd4hep {
   /// Namespace for implementation details of the AIDA detector description toolkit
   namespace cond {
 
+    /// Sorted index to select the IOV pools containing a requested validity
+    /**
+     *  Entries are sorted by IOV key. A max-tree over the upper IOV bounds
+     *  finds all keys containing a requested range in O(log(N) + k*log(N)).
+     *  Keys appended in increasing order, which is the usual case for runs,
+     *  fills etc., are inserted in O(log(N)). Other keys are buffered and
+     *  merged once the buffer exceeds about sqrt(N) entries.
+     *
+     *  Purely internal class to the conditions manager implementation.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_CONDITIONS
+     */
+    class ConditionsIOVIndex  {
+    public:
+      /// Indexed entry: node of the ConditionsIOVPool elements map (nodes are stable)
+      typedef std::pair<const IOV::Key, std::shared_ptr<ConditionsPool> > Entry;
+
+    protected:
+      /// Entries sorted by IOV key
+      std::vector<const Entry*>           m_sorted;
+      /// Implicit binary tree with the maximal upper bound of each subtree
+      std::vector<IOV::Key_value_type>    m_maxUpper;
+      /// Number of leaves of the tree (power of 2)
+      std::size_t                         m_leaves = 0;
+      /// Recently inserted entries not yet merged into the sorted part
+      std::vector<const Entry*>           m_pending;
+
+      /// Merge pending entries and rebuild the tree
+      void rebuild();
+
+    public:
+      /// Total number of indexed entries
+      std::size_t size()  const   {  return m_sorted.size() + m_pending.size();  }
+      /// Remove all entries
+      void clear();
+      /// Add a new entry
+      void insert(const Entry* entry);
+      /// Collect all entries with a key containing the requested range in key order
+      std::size_t containing(const IOV::Key& req, std::vector<const Entry*>& hits)  const;
+    };
+
     /// Pool of conditions satisfying one IOV type (epoch, run, fill, etc)
     /** 
      *  Purely internal class to the conditions manager implementation.
      *  Not at all to be accessed by clients!
      *
+     *  The pool is read-mostly: all select calls only acquire the elements
+     *  lock in shared mode, so that slices for different (or overlapping)
+     *  IOVs may be prepared concurrently. Only the registration of new
+     *  IOV pools and the cleanup require exclusive access.
+     *  The update lock serializes the loading and the computation of
+     *  missing conditions of this IOV type.
+     *
+     *  Selections by validity use the ConditionsIOVIndex and do not scan
+     *  all pools. Hence pools must be added using insert().
+     *  Ages are derived from the number of aging selections (age_epoch):
+     *  only the selected pools are touched.
+     *
      *  \author  M.Frank
      *  \version 1.0
      *  \ingroup DD4HEP_CONDITIONS
@@ -46,12 +105,25 @@ namespace dd4hep {
       Elements elements;     //! Not ROOT persistent
       /// Reference to the IOV container
       const IOVType* type;   //! Not ROOT persistent
+      /// Reader/writer lock protecting the elements container
+      mutable std::shared_timed_mutex elements_lock; //! Not ROOT persistent
+      /// Lock serializing the population of missing conditions
+      std::mutex     update_lock;   //! Not ROOT persistent
+      /// Index of the elements for selections by validity
+      ConditionsIOVIndex index;     //! Not ROOT persistent
+      /// Number of aging selections. The age of a pool is derived from it.
+      std::atomic<long>  age_epoch; //! Not ROOT persistent
       
     public:
       /// Default constructor
       ConditionsIOVPool(const IOVType* type);
       /// Default destructor
       virtual ~ConditionsIOVPool();
+      /// Add a new conditions pool. The caller must hold the elements lock exclusively
+      /** @return Pointer to the registered pool. If a pool for this key exists, the existing one.  */
+      ConditionsPool* insert(const IOV::Key& key, Element pool);
+      /// Update the age values of all pools from the aging selections
+      void updateAges();
       /// Retrieve  a condition set given the key according to their validity
       size_t select(Condition::key_type key, const IOV& req_validity, RangeConditions& result);
       /// Retrieve  a condition set given the key according to their validity
@@ -72,6 +72,10 @@ namespace dd4hep {
       bool                   m_doLoad = true;
       /// Property: Flag to indicate if unloaded items should be saved to the slice (or not)
       bool                   m_doOutputUnloaded = false;
+      /// Property: Number of threads to compute derived conditions (0,1: sequential)
+      int                    m_numComputeThreads = 0;
+      /// Property: Flag to enable the timing instrumentation of derived conditions callbacks
+      bool                   m_doComputeTiming = false;
 
       /// Register callback listener object
       void registerCallee(Listeners& listeners, const Listener& callee, bool add);
@@ -96,6 +100,12 @@ namespace dd4hep {
       /// Access to flag to indicate if unloaded items should be saved to the slice (or not)
       bool doOutputUnloaded()  const        {  return m_doOutputUnloaded;     }
 
+      /// Access the number of threads used to compute derived conditions
+      int numComputeThreads()  const        {  return m_numComputeThreads;    }
+
+      /// Access to flag to enable the timing of derived conditions callbacks
+      bool doComputeTiming()  const         {  return m_doComputeTiming;      }
+
       /// Listener invocation when a condition is registered to the cache
       void onRegister(Condition condition);
 
@@ -19,6 +19,7 @@
 #include "DDCond/ConditionsManager.h"
 
 // C/C++ include files
+#include <atomic>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -63,8 +64,10 @@ namespace dd4hep {
       };
       /// The IOV of the conditions hosted
       IOV* iov;
-      /// Aging value
-      int  age_value;
+      /// Aging value. Updated by concurrent selections, hence atomic
+      std::atomic<int> age_value;
+      /// Aging selection count of the owning IOV pool when this pool was last selected
+      std::atomic<long> age_epoch;
 
     public:
       /// Listener invocation when a condition is registered to the cache
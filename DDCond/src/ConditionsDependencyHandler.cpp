@@ -15,13 +15,56 @@
 #include "DDCond/ConditionsDependencyHandler.h"
 #include "DDCond/ConditionsManagerObject.h"
 #include "DD4hep/ConditionsProcessor.h"
+#include "DD4hep/Primitives.h"
 #include "DD4hep/Printout.h"
 #include "TTimeStamp.h"
 
+// C/C++ include files
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <exception>
+#include <condition_variable>
+
 using namespace dd4hep;
 using namespace dd4hep::cond;
 
 namespace {
+  typedef ConditionsDependencyHandler::Work Work;
+
+  /// Work item currently processed by this thread. Callbacks may execute on worker threads
+  thread_local Work* s_currentWork = 0;
+
+  /// Helper to set the current work item of this thread and restore the previous one on exit
+  struct CurrentWork  {
+    Work* previous;
+    CurrentWork(Work* w) : previous(s_currentWork)  { s_currentWork = w;        }
+    ~CurrentWork()                                  { s_currentWork = previous; }
+  };
+
+  /// Reusable barrier: the threads of the pool meet at the end of each level
+  class LevelBarrier  {
+    std::mutex              lock;
+    std::condition_variable cond;
+    size_t                  count;
+    size_t                  waiting    = 0;
+    size_t                  generation = 0;
+  public:
+    explicit LevelBarrier(size_t n) : count(n)  {}
+    void wait()  {
+      std::unique_lock<std::mutex> guard(lock);
+      size_t gen = generation;
+      if ( ++waiting == count )  {
+        waiting = 0;
+        ++generation;
+        cond.notify_all();
+        return;
+      }
+      cond.wait(guard, [this, gen] { return gen != generation; });
+    }
+  };
+
   std::string dependency_name(const ConditionDependency* d)  {
 #ifdef DD4HEP_CONDITIONS_DEBUG
     return d->target.name;
@@ -75,7 +118,8 @@ ConditionsDependencyHandler::ConditionsDependencyHandler(ConditionsManager   mgr
     m_todo.emplace(d.first,w);
     p += sizeof(Work);
   }
-  m_iovType = iov.iovType;
+  m_iovType  = iov.iovType;
+  m_doTiming = m_manager->doComputeTiming();
 }
 
 /// Default destructor
@@ -90,9 +134,183 @@ Detector& ConditionsDependencyHandler::detectorDescription() const  {
   return m_manager->detectorDescription();
 }
 
+/// Sort the work items into levels of independent items. Returns false on dependency cycles
+bool ConditionsDependencyHandler::build_levels(std::vector<std::vector<Work*> >& levels)  const  {
+  const int VISITING = -2, UNKNOWN = -1;
+  std::vector<int> level(m_todo.size(), UNKNOWN);
+  // Explicit stack: dependency chains may be long
+  std::vector<std::pair<Work*,size_t> > stack;
+  for( const auto& t : m_todo )   {
+    if ( level[t.second-m_block] != UNKNOWN ) continue;
+    stack.emplace_back(t.second, 0);
+    level[t.second-m_block] = VISITING;
+    while( !stack.empty() )   {
+      Work*  w    = stack.back().first;
+      Work*  dep  = 0;
+      size_t next = stack.back().second;
+      const auto& deps = w->context.dependency->dependencies;
+      for( ; next < deps.size(); ++next )   {
+        auto i = m_todo.find(deps[next].hash);
+        if ( i == m_todo.end() ) continue;
+        int l = level[i->second-m_block];
+        if ( l == VISITING ) return false;
+        if ( l == UNKNOWN )  {
+          dep = i->second;
+          break;
+        }
+      }
+      stack.back().second = next;
+      if ( dep )  {
+        level[dep-m_block] = VISITING;
+        stack.emplace_back(dep, 0);
+        continue;
+      }
+      // All dependencies known: the item comes one level after the deepest of them
+      int lvl = 0;
+      for( const auto& d : deps )   {
+        auto i = m_todo.find(d.hash);
+        if ( i != m_todo.end() ) lvl = std::max(lvl, level[i->second-m_block]+1);
+      }
+      level[w-m_block] = lvl;
+      if ( size_t(lvl) >= levels.size() ) levels.resize(lvl+1);
+      stack.pop_back();
+    }
+  }
+  // Fill the levels in key order to keep the processing order reproducible
+  for( const auto& t : m_todo )
+    levels[level[t.second-m_block]].emplace_back(t.second);
+  return true;
+}
+
+/// Execute the creation callbacks level by level using a number of threads
+void ConditionsDependencyHandler::compute_parallel(const std::vector<std::vector<Work*> >& levels,
+                                                   size_t num_threads)
+{
+  // Items used as input by other items are resolved at the end of their level.
+  // Callbacks of the following levels then only read fully resolved conditions.
+  std::vector<char> is_input(m_todo.size(), 0);
+  for( const auto& t : m_todo )   {
+    for( const auto& d : t.second->context.dependency->dependencies )   {
+      auto i = m_todo.find(d.hash);
+      if ( i != m_todo.end() ) is_input[i->second-m_block] = 1;
+    }
+  }
+  size_t num_workers = 1;
+  for( const auto& items : levels )
+    num_workers = std::max(num_workers, std::min(num_threads, items.size()));
+
+  // The threads are started once and meet at a barrier after each level.
+  // Between two barriers the calling thread publishes the results of the level.
+  std::atomic<size_t> next(0);
+  std::exception_ptr  error;
+  std::mutex          error_lock;
+  LevelBarrier        barrier(num_workers);
+  auto failed = [&error, &error_lock]()  {
+    std::lock_guard<std::mutex> lock(error_lock);
+    return bool(error);
+  };
+  auto set_error = [&error, &error_lock]()  {
+    std::lock_guard<std::mutex> lock(error_lock);
+    if ( !error ) error = std::current_exception();
+  };
+  auto worker = [&](bool master)  {
+    CurrentWork current(0);
+    for( const auto& items : levels )   {
+      for( size_t i = next++; i < items.size(); i = next++ )   {
+        try  {
+          do_callback(items[i]);
+          if ( !items[i]->condition )  {
+            except("ConditionsDependencyHandler",
+                   "Derived condition was not created after calling the creation callback!");
+          }
+        }
+        catch(...)  {
+          set_error();
+          next = items.size();
+        }
+      }
+      barrier.wait();
+      if ( failed() ) return;
+      if ( master )   {
+        try  {
+          m_parallel = false;
+          // Conditions registered by the callbacks are now visible to the next level
+          for( const auto& d : m_deferred )
+            m_pool.registerMany(d.first, d.second);
+          m_deferred.clear();
+          for( Work* w : items )   {
+            if ( is_input[w-m_block] && w->state == CREATED )  {
+              CurrentWork resolving(w);
+              w->resolve(s_currentWork);
+            }
+          }
+          m_parallel = true;
+          next = 0;
+        }
+        catch(...)  {
+          set_error();
+        }
+      }
+      barrier.wait();
+      if ( failed() ) return;
+    }
+  };
+  std::vector<std::thread> threads;
+  m_parallel = true;
+  for( size_t i = 1; i < num_workers; ++i )
+    threads.emplace_back(worker, false);
+  worker(true);
+  for( auto& t : threads ) t.join();
+  m_parallel = false;
+  if ( error )  {
+    m_deferred.clear();
+    std::rethrow_exception(error);
+  }
+}
+
+/// Accumulate the callback timing of all work items
+void ConditionsDependencyHandler::collect_timing()   {
+  std::map<const ConditionUpdateCall*, CallbackTiming> calls;
+  for( const auto& t : m_todo )   {
+    const Work* w = t.second;
+    if ( w->state != INVALID )   {
+      auto& c = calls[w->context.dependency->callback.get()];
+      ++c.calls;
+      c.seconds += w->seconds;
+    }
+  }
+  for( const auto& c : calls )   {
+    auto& t = timing[typeName(typeid(*c.first))];
+    t.calls   += c.second.calls;
+    t.seconds += c.second.seconds;
+  }
+  for( const auto& t : timing )   {
+    printout(INFO,"DependencyHandler","Callback %-48s calls:%8ld total:%9.4f sec mean:%11.4g sec",
+             t.first.c_str(), long(t.second.calls), t.second.seconds,
+             t.second.calls ? t.second.seconds/double(t.second.calls) : 0e0);
+  }
+}
+
 /// 1rst pass: Compute/create the missing conditions
 void ConditionsDependencyHandler::compute()   {
+  CurrentWork current(0);
+  size_t num_threads = size_t(std::max(m_manager->numComputeThreads(), 0));
   m_state = CREATED;
+  if ( num_threads > 1 && m_todo.size() > 1 )   {
+    std::vector<std::vector<Work*> > levels;
+    if ( build_levels(levels) )  {
+      TTimeStamp start;
+      compute_parallel(levels, num_threads);
+      TTimeStamp stop;
+      printout(DEBUG,"DependencyHandler","Computed %ld conditions in %ld levels with %ld threads [%7.5f seconds]",
+               long(m_todo.size()), long(levels.size()), long(num_threads),
+               stop.AsDouble()-start.AsDouble());
+      if ( m_doTiming ) collect_timing();
+      return;
+    }
+    printout(WARNING,"DependencyHandler",
+             "Circular dependencies between derived conditions: computing sequentially.");
+  }
   for( const auto& i : m_todo )   {
     if ( !i.second->condition )  {
       do_callback(i.second);
@@ -103,6 +321,7 @@ void ConditionsDependencyHandler::compute()   {
     }
     // printout(INFO,"UserPool","Already calcluated: %s",d->name());
   }
+  if ( m_doTiming ) collect_timing();
 }
 
 /// 2nd pass:  Handler callback for the second turn to resolve missing dependencies
@@ -113,12 +332,13 @@ void ConditionsDependencyHandler::resolve()    {
   std::map<IOV::Key,std::vector<Condition> > work_pools;
   Work* w;
 
+  CurrentWork current(0);
   m_state = RESOLVED;
   for( const auto& c : m_todo )   {
     w = c.second;
-    m_currentWork = w;
+    s_currentWork = w;
     if ( w->state != RESOLVED )   {
-      w->resolve(m_currentWork);
+      w->resolve(s_currentWork);
     }
     ++num_resolved;
     // Fill an empty map of condition vectors for the block inserts
@@ -160,11 +380,21 @@ void ConditionsDependencyHandler::resolve()    {
 
 /// Interface to handle multi-condition inserts by callbacks: One single insert
 bool ConditionsDependencyHandler::registerOne(const IOV& iov, Condition cond)    {
+  if ( m_parallel )  {
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+    m_deferred.emplace_back(iov, std::vector<Condition>(1, cond));
+    return true;
+  }
   return m_pool.registerOne(iov, cond);
 }
 
 /// Handle multi-condition inserts by callbacks: block insertions of conditions with identical IOV
 size_t ConditionsDependencyHandler::registerMany(const IOV& iov, const std::vector<Condition>& values)   {
+  if ( m_parallel )  {
+    std::lock_guard<std::recursive_mutex> lock(m_lock);
+    m_deferred.emplace_back(iov, values);
+    return values.size();
+  }
   return m_pool.registerMany(iov, values);
 }
 
@@ -188,7 +418,7 @@ std::vector<Condition> ConditionsDependencyHandler::getByItem(Condition::itemkey
     };
     item_selector proc(key);
     m_pool.scan(conditionsProcessor(proc));
-    for (auto c : proc.conditions ) m_currentWork->do_intersection(c->iov);
+    for (auto c : proc.conditions ) s_currentWork->do_intersection(c->iov);
     return proc.conditions;
   }
   except("ConditionsDependencyHandler",
@@ -202,7 +432,7 @@ std::vector<Condition> ConditionsDependencyHandler::get(Condition::detkey_type d
     ConditionKey::KeyMaker lower(det_key, Condition::FIRST_ITEM_KEY);
     ConditionKey::KeyMaker upper(det_key, Condition::LAST_ITEM_KEY);
     std::vector<Condition> conditions = m_pool.get(lower.hash, upper.hash);
-    for (auto c : conditions ) m_currentWork->do_intersection(c->iov);
+    for (auto c : conditions ) s_currentWork->do_intersection(c->iov);
     return conditions;
   }
   except("ConditionsDependencyHandler",
@@ -215,24 +445,35 @@ Condition ConditionsDependencyHandler::get(Condition::key_type key, bool throw_i
   /// If we are not already resolving here, we follow the normal procedure
   Condition c = m_pool.get(key);
   if ( c.isValid() )  {
-    m_currentWork->do_intersection(c->iov);
+    s_currentWork->do_intersection(c->iov);
     return c;
   }
   auto i = m_todo.find(key);
   if ( i != m_todo.end() )   {
     Work* w = i->second;
+    // Items of previous levels may be resolved on demand by several threads
+    std::unique_lock<std::recursive_mutex> lock(m_lock, std::defer_lock);
+    if ( m_parallel ) lock.lock();
     if ( w->state == RESOLVED )   {
+      // Items of previous levels are resolved before they are read in parallel mode
+      if ( s_currentWork ) s_currentWork->do_intersection(w->iov);
       return w->condition;
     }
     else if ( w->state == CREATED )   {
-      return w->resolve(m_currentWork);
+      return w->resolve(s_currentWork);
     }
     else if ( w->state == INVALID )  {
+      if ( m_parallel )  {
+        except("ConditionsDependencyHandler",
+               "Access to the undeclared derived dependency %s. "
+               "Declare it or compute the conditions sequentially.",
+               dependency_name(w->context.dependency).c_str());
+      }
       do_callback(w);
       if ( w->condition && w->state == RESOLVED ) // cross-dependencies...
         return w->condition;
       else if ( w->condition )
-        return w->resolve(m_currentWork);
+        return w->resolve(s_currentWork);
     }
   }
   if ( throw_if_not )  {
@@ -245,8 +486,8 @@ Condition ConditionsDependencyHandler::get(Condition::key_type key, bool throw_i
 void ConditionsDependencyHandler::do_callback(Work* work)   {
   const ConditionDependency* dep = work->context.dependency;
   try  {
-    Work* previous  = m_currentWork;
-    m_currentWork   = work;
+    Work* previous  = s_currentWork;
+    s_currentWork   = work;
     if ( work->callstack > 0 )   {
       // if we end up here it means a previous construction call never finished
       // because the bugger tried to access another condition, which in turn
@@ -263,10 +504,19 @@ void ConditionsDependencyHandler::do_callback(Work* work)   {
              );
     }
     ++work->callstack;
-    work->condition = (*dep->callback)(dep->target, work->context).ptr();
+    if ( m_doTiming )  {
+      auto start = std::chrono::steady_clock::now();
+      work->condition = (*dep->callback)(dep->target, work->context).ptr();
+      work->seconds   = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+    }
+    else  {
+      work->condition = (*dep->callback)(dep->target, work->context).ptr();
+    }
     --work->callstack;
-    m_currentWork   = previous;
+    s_currentWork   = previous;
     if ( work->condition )  {
+      std::unique_lock<std::recursive_mutex> lock(m_lock, std::defer_lock);
+      if ( m_parallel ) lock.lock();
       if ( !work->iov )  {
         work->_iov = IOV(m_iovType,IOV::Key(IOV::MIN_KEY, IOV::MAX_KEY));
         work->iov  = &work->_iov;
@@ -20,11 +20,122 @@
 
 #include "DD4hep/detail/ConditionsInterna.h"
 
+// C/C++ include files
+#include <iterator>
+#include <algorithm>
+
 using namespace dd4hep;
 using namespace dd4hep::cond;
 
+namespace {
+  typedef std::shared_lock<std::shared_timed_mutex> reader_lock_t;
+  typedef std::unique_lock<std::shared_timed_mutex> writer_lock_t;
+  typedef ConditionsIOVIndex::Entry                 Entry;
+  typedef std::vector<const Entry*>                 Hits;
+
+  inline bool entry_less(const Entry* a, const Entry* b)  {
+    return a->first < b->first;
+  }
+
+  /// Depth first descent in key order. Skip subtrees without sufficient upper bound
+  void collect_containing(const std::vector<const Entry*>&  sorted,
+                          const std::vector<IOV::Key_value_type>& max_upper,
+                          std::size_t node, std::size_t lo, std::size_t width,
+                          std::size_t last, IOV::Key_value_type upper, Hits& hits)
+  {
+    if ( lo >= last || max_upper[node] < upper )
+      return;
+    if ( width == 1 )  {
+      hits.emplace_back(sorted[lo]);
+      return;
+    }
+    width >>= 1;
+    collect_containing(sorted, max_upper, 2*node,   lo,       width, last, upper, hits);
+    collect_containing(sorted, max_upper, 2*node+1, lo+width, width, last, upper, hits);
+  }
+
+  /// Derive the age of all pools from the number of aging selections
+  void update_ages(const ConditionsIOVPool::Elements& elements, long epoch)  {
+    for( const auto& e : elements )
+      e.second->age_value = int(epoch - e.second->age_epoch.load());
+  }
+}
+
+/// Remove all entries
+void ConditionsIOVIndex::clear()   {
+  m_sorted.clear();
+  m_pending.clear();
+  m_maxUpper.clear();
+  m_leaves = 0;
+}
+
+/// Merge pending entries and rebuild the tree
+void ConditionsIOVIndex::rebuild()   {
+  if ( !m_pending.empty() )  {
+    std::vector<const Entry*> merged;
+    merged.reserve(m_sorted.size()+m_pending.size());
+    std::sort(m_pending.begin(), m_pending.end(), entry_less);
+    std::merge(m_sorted.begin(),  m_sorted.end(),
+               m_pending.begin(), m_pending.end(),
+               std::back_inserter(merged), entry_less);
+    m_sorted.swap(merged);
+    m_pending.clear();
+  }
+  for( m_leaves = 1; m_leaves < m_sorted.size(); m_leaves <<= 1 );
+  m_maxUpper.assign(2*m_leaves, IOV::MIN_KEY);
+  for( std::size_t i = 0; i < m_sorted.size(); ++i )
+    m_maxUpper[m_leaves+i] = m_sorted[i]->first.second;
+  for( std::size_t i = m_leaves-1; i > 0; --i )
+    m_maxUpper[i] = std::max(m_maxUpper[2*i], m_maxUpper[2*i+1]);
+}
+
+/// Add a new entry
+void ConditionsIOVIndex::insert(const Entry* entry)   {
+  if ( m_pending.empty() && (m_sorted.empty() || m_sorted.back()->first < entry->first) )  {
+    // Fast path: the key is appended in order. Update the path to the root.
+    std::size_t node = m_leaves + m_sorted.size();
+    m_sorted.emplace_back(entry);
+    if ( m_sorted.size() > m_leaves )  {
+      rebuild();
+      return;
+    }
+    m_maxUpper[node] = entry->first.second;
+    for( node >>= 1; node > 0; node >>= 1 )
+      m_maxUpper[node] = std::max(m_maxUpper[2*node], m_maxUpper[2*node+1]);
+    return;
+  }
+  m_pending.emplace_back(entry);
+  std::size_t limit = 16;
+  while( limit*limit < m_sorted.size() ) limit <<= 1;
+  if ( m_pending.size() > limit )  {
+    rebuild();
+  }
+}
+
+/// Collect all entries with a key containing the requested range in key order
+std::size_t ConditionsIOVIndex::containing(const IOV::Key& req, Hits& hits)  const  {
+  std::size_t len = hits.size();
+  // Candidates are all keys with a lower bound below the requested lower bound
+  std::size_t last = std::upper_bound(m_sorted.begin(), m_sorted.end(), req.first,
+                                      [](IOV::Key_value_type v, const Entry* e)
+                                      { return v < e->first.first; }) - m_sorted.begin();
+  if ( last > 0 )  {
+    collect_containing(m_sorted, m_maxUpper, 1, 0, m_leaves, last, req.second, hits);
+  }
+  if ( !m_pending.empty() )  {
+    std::size_t num_sorted = hits.size();
+    for( const Entry* e : m_pending )  {
+      if ( IOV::key_contains_range(e->first, req) ) hits.emplace_back(e);
+    }
+    if ( hits.size() > num_sorted )  {
+      std::sort(hits.begin()+len, hits.end(), entry_less);
+    }
+  }
+  return hits.size() - len;
+}
+
 /// Default constructor
-ConditionsIOVPool::ConditionsIOVPool(const IOVType* typ) : type(typ)  {
+ConditionsIOVPool::ConditionsIOVPool(const IOVType* typ) : type(typ), age_epoch(0)  {
   InstanceCount::increment(this);
 }
 
@@ -39,16 +150,31 @@ ConditionsIOVPool::~ConditionsIOVPool()  {
   InstanceCount::decrement(this);
 }
 
+/// Add a new conditions pool. The caller must hold the elements lock exclusively
+ConditionsPool* ConditionsIOVPool::insert(const IOV::Key& key, Element pool)   {
+  auto ret = elements.emplace(key, pool);
+  if ( ret.second )  {
+    ret.first->second->age_epoch = age_epoch.load();
+    index.insert(&(*ret.first));
+  }
+  return ret.first->second.get();
+}
+
+/// Update the age values of all pools from the aging selections
+void ConditionsIOVPool::updateAges()   {
+  reader_lock_t lock(elements_lock);
+  update_ages(elements, age_epoch);
+}
+
 size_t ConditionsIOVPool::select(Condition::key_type key, const IOV& req_validity, RangeConditions& result)
 {
+  reader_lock_t lock(elements_lock);
   if ( !elements.empty() )  {
+    Hits   hits;
     size_t len = result.size();
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& e : elements )  {
-      if ( IOV::key_contains_range(e.first, req_key) )  {
-        e.second->select(key, result);
-      }
-    }
+    index.containing(req_validity.key(), hits);
+    for( const Entry* e : hits )
+      e->second->select(key, result);
     return result.size() - len;
   }
   return 0;
@@ -56,6 +182,7 @@ size_t ConditionsIOVPool::select(Condition::key_type key, const IOV& req_validit
 
 size_t ConditionsIOVPool::selectRange(Condition::key_type key, const IOV& req_validity, RangeConditions& result)
 {
+  reader_lock_t lock(elements_lock);
   size_t len = result.size();
   const IOV::Key range = req_validity.key();
   for( const auto& e : elements )  {
@@ -75,7 +202,8 @@ size_t ConditionsIOVPool::selectRange(Condition::key_type key, const IOV& req_va
 
 /// Invoke cache cleanup with user defined policy
 int ConditionsIOVPool::clean(const ConditionsCleanup& cleaner)   {
- Elements rest;
+  writer_lock_t lock(elements_lock);
+  Elements rest;
   int count = 0;
   for( const auto& e : elements )  {
     const ConditionsPool* p = e.second.get();
@@ -87,13 +215,18 @@ int ConditionsIOVPool::clean(const ConditionsCleanup& cleaner)   {
     rest.insert(e);
   }
   elements = std::move(rest);
+  index.clear();
+  for( const auto& e : elements )
+    index.insert(&e);
   return count;  
 }
 
 /// Remove all key based pools with an age beyon the minimum age
 int ConditionsIOVPool::clean(int max_age)   {
+  writer_lock_t lock(elements_lock);
   Elements rest;
   int count = 0;
+  update_ages(elements, age_epoch);
   for( const auto& e : elements )  {
     if ( e.second->age_value >= max_age )   {
       count += e.second->size();
@@ -104,6 +237,9 @@ int ConditionsIOVPool::clean(int max_age)   {
     }
   }
   elements = std::move(rest);
+  index.clear();
+  for( const auto& e : elements )
+    index.insert(&e);
   return count;
 }
 
@@ -112,17 +248,17 @@ size_t ConditionsIOVPool::select(const IOV&        req_validity,
                                  RangeConditions&  valid,
                                  IOV&              cond_validity)
 {
+  reader_lock_t lock(elements_lock);
   size_t num_selected = 0;
   if ( !elements.empty() )  {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        ++i.second->age_value;
-        continue;
-      }
-      cond_validity.iov_intersection(i.first);
-      num_selected += i.second->select_all(valid);
-      i.second->age_value = 0;
+    Hits hits;
+    long epoch = ++age_epoch;
+    index.containing(req_validity.key(), hits);
+    for( const Entry* i : hits )  {
+      cond_validity.iov_intersection(i->first);
+      num_selected += i->second->select_all(valid);
+      i->second->age_epoch = epoch;
+      i->second->age_value = 0;
     }
   }
   return num_selected;
@@ -133,18 +269,18 @@ size_t ConditionsIOVPool::select(const IOV&              req_validity,
                                  const ConditionsSelect& predicate_processor,
                                  IOV&                    cond_validity)
 {
+  reader_lock_t lock(elements_lock);
   size_t num_selected = 0, pool_selected = 0;
   if ( !elements.empty() )  {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        ++i.second->age_value;
-        continue;
-      }
-      cond_validity.iov_intersection(i.first);
-      pool_selected = i.second->select_all(predicate_processor);
+    Hits hits;
+    long epoch = ++age_epoch;
+    index.containing(req_validity.key(), hits);
+    for( const Entry* i : hits )  {
+      cond_validity.iov_intersection(i->first);
+      pool_selected = i->second->select_all(predicate_processor);
       num_selected += pool_selected;
-      i.second->age_value = 0;
+      i->second->age_epoch = epoch;
+      i->second->age_value = 0;
     }
   }
   return num_selected;
@@ -165,14 +301,13 @@ size_t ConditionsIOVPool::select(const IOV& req_validity,
 /// Select all ACTIVE conditions, which do match the IOV requirement
 size_t ConditionsIOVPool::select(const IOV& req_validity, Elements&  valid)
 {
+  reader_lock_t lock(elements_lock);
   size_t num_selected = 0;
   if ( !elements.empty() )   {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        continue;
-      }
-      valid[i.first] = i.second;
+    Hits hits;
+    index.containing(req_validity.key(), hits);
+    for( const Entry* i : hits )  {
+      valid[i->first] = i->second;
       ++num_selected;
     }
   }
@@ -194,14 +329,13 @@ size_t ConditionsIOVPool::select(const IOV&        req_validity,
 /// Select all ACTIVE conditions, which do match the IOV requirement
 size_t ConditionsIOVPool::select(const IOV& req_validity, std::vector<Element>& valid)
 {
+  reader_lock_t lock(elements_lock);
   size_t num_selected = 0;
   if ( !elements.empty() )   {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        continue;
-      }
-      valid.emplace_back(i.second);
+    Hits hits;
+    index.containing(req_validity.key(), hits);
+    for( const Entry* i : hits )  {
+      valid.emplace_back(i->second);
       ++num_selected;
     }
   }
@@ -53,6 +53,8 @@ ConditionsManagerObject::ConditionsManagerObject(Detector& ref_description)
   InstanceCount::increment(this);
   declareProperty("LoadConditions",           m_doLoad);
   declareProperty("OutputUnloadedConditions", m_doOutputUnloaded);
+  declareProperty("ComputeThreads",           m_numComputeThreads);
+  declareProperty("ComputeTiming",            m_doComputeTiming);
 }
 
 /// Default destructor
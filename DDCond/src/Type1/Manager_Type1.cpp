@@ -216,11 +216,13 @@ const IOVType* Manager_Type1::iovType (const string& iov_name) const   {
 /// Register IOV with type and key
 ConditionsPool* Manager_Type1::registerIOV(const IOVType& typ, IOV::Key key)   {
   // IOV read and checked. Now register it, but always locked!
-  ConditionsIOVPool* pool = m_rawPool[typ.type];
   dd4hep_lock_t lock(m_poolLock);
+  ConditionsIOVPool* pool = m_rawPool[typ.type];
   if ( !pool )  {
     m_rawPool[typ.type] = pool = new ConditionsIOVPool(&typ);
   }
+  // Concurrent selections only hold the shared lock: insertions must be exclusive
+  unique_lock<shared_timed_mutex> pool_lock(pool->elements_lock);
   ConditionsIOVPool::Elements::const_iterator i = pool->elements.find(key);
   if ( i != pool->elements.end() )   {
     return (*i).second.get();
@@ -230,7 +232,7 @@ ConditionsPool* Manager_Type1::registerIOV(const IOVType& typ, IOV::Key key)   {
   iov->keyData   = key;
   const void* argv_pool[] = {this, iov, 0};
   shared_ptr<ConditionsPool> cond_pool(createPlugin<ConditionsPool>(m_poolType,m_detDesc,2,argv_pool));
-  pool->elements.emplace(key,cond_pool);
+  pool->insert(key,cond_pool);
   printout(INFO,"ConditionsMgr","Created IOV Pool for:%s",iov->str().c_str());
   return cond_pool.get();
 }
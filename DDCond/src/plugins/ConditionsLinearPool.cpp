@@ -22,6 +22,7 @@
 
 // C/C++ include files
 #include <list>
+#include <shared_mutex>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -33,9 +34,11 @@ namespace dd4hep {
     /**
      *  Please note:
      *  Users should not directly interact with object instances of this type.
-     *  Data are not thread protected and interaction may cause serious harm.
      *  Only the ConditionsManager implementation should interact with
      *  this class or any subclass to ensure data integrity.
+     *  Selections acquire the pool lock in shared mode, insertions and
+     *  cleanup exclusively. Hence pools may be read by several threads
+     *  while other threads register newly loaded or derived conditions.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -44,10 +47,15 @@ namespace dd4hep {
     template<typename MAPPING, typename BASE> 
     class ConditionsLinearPool : public BASE   {
     protected:
+      typedef std::shared_lock<std::shared_timed_mutex> reader_lock_t;
+      typedef std::unique_lock<std::shared_timed_mutex> writer_lock_t;
       MAPPING m_entries;
+      /// Reader/writer lock protecting the entries
+      mutable std::shared_timed_mutex m_lock;
 
       /// Helper function to loop over the conditions container and apply a functor
       template <typename R,typename T> size_t loop(R& result, T functor) {
+        reader_lock_t lock(m_lock);
         size_t len = result.size();
         for_each(m_entries.begin(),m_entries.end(),functor);
         return result.size() - len;
@@ -61,28 +69,36 @@ namespace dd4hep {
 
       /// Total entry count
       virtual size_t size()  const   final  {
+        reader_lock_t lock(m_lock);
         return m_entries.size();
       }
 
       /// Full cleanup of all managed conditions.
       virtual void clear()  final   {
+        writer_lock_t lock(m_lock);
         for_each(m_entries.begin(), m_entries.end(), Operators::poolRemove(*this));
         m_entries.clear();
       }
 
       /// Check if a condition exists in the pool
       virtual Condition exists(Condition::key_type key)  const  final   {
+        reader_lock_t lock(m_lock);
         auto i = find_if(m_entries.begin(), m_entries.end(), Operators::keyFind(key));
         return i==m_entries.end() ? Condition() : (*i);
       }
 
       /// Register a new condition to this pool
-      virtual bool insert(Condition condition)  final 
-      {  m_entries.emplace(m_entries.end(),condition.access()); return true;     }
+      virtual bool insert(Condition condition)  final   {
+        writer_lock_t lock(m_lock);
+        m_entries.emplace(m_entries.end(),condition.access());
+        return true;
+      }
 
       /// Register a new condition to this pool. May overload for performance reasons.
-      virtual void insert(RangeConditions& rc)  final 
-      {  for_each(rc.begin(), rc.end(), Operators::sequenceSelect(m_entries));  }
+      virtual void insert(RangeConditions& rc)  final   {
+        writer_lock_t lock(m_lock);
+        for_each(rc.begin(), rc.end(), Operators::sequenceSelect(m_entries));
+      }
 
       /// Select the conditions matching the DetElement and the conditions name
       virtual size_t select(Condition::key_type key, RangeConditions& result)  final 
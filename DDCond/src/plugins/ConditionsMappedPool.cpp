@@ -22,6 +22,7 @@
 
 // C/C++ include files
 #include <map>
+#include <shared_mutex>
 #include <unordered_map>
 
 /// Namespace for the AIDA detector description toolkit
@@ -35,9 +36,11 @@ namespace dd4hep {
      *
      *  Please note:
      *  Users should not directly interact with object instances of this type.
-     *  Data are not thread protected and interaction may cause serious harm.
      *  Only the ConditionsManager implementation should interact with
      *  this class or any subclass to ensure data integrity.
+     *  Selections acquire the pool lock in shared mode, insertions and
+     *  cleanup exclusively. Hence pools may be read by several threads
+     *  while other threads register newly loaded or derived conditions.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -51,10 +54,15 @@ namespace dd4hep {
       typedef ConditionsMappedPool<Mapping,Base> Self;
       
     protected:
+      typedef std::shared_lock<std::shared_timed_mutex> reader_lock_t;
+      typedef std::unique_lock<std::shared_timed_mutex> writer_lock_t;
       Mapping          m_entries;
+      /// Reader/writer lock protecting the entries
+      mutable std::shared_timed_mutex m_lock;
       
       /// Helper function to loop over the conditions container and apply a functor
       template <typename R,typename T> size_t loop(R& result, T functor) {
+        reader_lock_t lock(m_lock);
         size_t len = result.size();
         for_each(m_entries.begin(),m_entries.end(),functor);
         return result.size() - len;
@@ -68,12 +76,14 @@ namespace dd4hep {
 
       /// Total entry count
       virtual size_t size()  const  final  {
+        reader_lock_t lock(m_lock);
         return m_entries.size();
       }
 
       /// Register a new condition to this pool
       virtual bool insert(Condition condition)  final    {
         Condition::Object* c = condition.access();
+        writer_lock_t lock(m_lock);
         bool result = m_entries.emplace(c->hash,c).second;
         if ( result ) return true;
         auto i = m_entries.find(c->hash);
@@ -87,6 +97,7 @@ namespace dd4hep {
       /// Register a new condition to this pool. May overload for performance reasons.
       virtual void insert(RangeConditions& new_entries)  final   {
         Condition::Object* o;
+        writer_lock_t lock(m_lock);
         for( Condition c : new_entries )  {
           o = c.access();
           m_entries.emplace(o->hash,o);
@@ -95,12 +106,14 @@ namespace dd4hep {
 
       /// Full cleanup of all managed conditions.
       virtual void clear()  final   {
+        writer_lock_t lock(m_lock);
         for_each(m_entries.begin(), m_entries.end(), Operators::poolRemove(*this));
         m_entries.clear();
       }
 
       /// Check if a condition exists in the pool
       virtual Condition exists(Condition::key_type key)  const  final   {
+        reader_lock_t lock(m_lock);
         auto i=find_if(m_entries.begin(), m_entries.end(), Operators::keyFind(key));
         return i==m_entries.end() ? Condition() : (*i).second;
       }
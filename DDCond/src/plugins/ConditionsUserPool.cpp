@@ -57,6 +57,8 @@ namespace dd4hep {
 
       /// Internal insertion helper
       bool i_insert(Condition::Object* o);
+      /// Internal helper to (re-)select the conditions of the required IOV from the IOV pool
+      void i_select(const IOV& required);
 
     public:
       /// Default constructor
@@ -240,6 +242,15 @@ ConditionsMappedUserPool<MAPPING>::i_findCondition(Condition::key_type key)  con
   return i != m_conditions.end() ? (*i).second : 0;
 }
 
+template<typename MAPPING> inline void
+ConditionsMappedUserPool<MAPPING>::i_select(const IOV& required)   {
+  IOV pool_iov(required.iovType);
+  m_conditions.clear();
+  pool_iov.reset().invert();
+  m_iovPool->select(required, Operators::mapConditionsSelect(m_conditions), pool_iov);
+  m_iov = pool_iov;
+}
+
 template<typename MAPPING> inline bool
 ConditionsMappedUserPool<MAPPING>::i_insert(Condition::Object* o)   {
   int ret = m_conditions.emplace(o->hash,o).second;
@@ -483,6 +494,9 @@ size_t ConditionsMappedUserPool<MAPPING>::compute(const Dependencies& deps,
 }
 
 namespace {
+  /// Conditions loaders are not required to be thread safe: serialize backend access
+  mutex s_loaderLock;
+
   struct COMP {
     typedef pair<Condition::key_type,const ConditionDependency*>     Dep;
     typedef pair<const Condition::key_type,detail::ConditionObject*> Cond;
@@ -516,34 +530,42 @@ ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required,
   IOV    pool_iov(required.iovType);
   ConditionsManager::Result result;
 
-  // This is a critical operation, because we have to ensure the
-  // IOV pools are ONLY manipulated by the current thread.
-  // Otherwise the selection and the population are unsafe!
-  static mutex lock;
-  lock_guard<mutex> guard(lock);
+  // The selection only requires shared access to the IOV pools. Hence slices
+  // for different or overlapping IOVs are prepared concurrently.
+  // Only if conditions are missing, the population of this IOV type is
+  // serialized. Once the update lock is held, the selection is repeated:
+  // another thread may have loaded or computed the items in the meantime.
+  unique_lock<mutex> update_guard(m_iovPool->update_lock, defer_lock);
+  CondMissing cond_missing;
+  CalcMissing calc_missing;
+  CondMissing::iterator last_cond;
+  CalcMissing::iterator last_calc;
+  long num_cond_miss = 0, num_calc_miss = 0;
 
-  m_conditions.clear();
   slice_miss_cond.clear();
   slice_miss_calc.clear();
-  pool_iov.reset().invert();
-  m_iovPool->select(required, Operators::mapConditionsSelect(m_conditions), pool_iov);
-  m_iov = pool_iov;
-  CondMissing cond_missing(slice_cond.size()+m_conditions.size());
-  CalcMissing calc_missing(slice_calc.size()+m_conditions.size());
-
-  CondMissing::iterator last_cond = set_difference(begin(slice_cond),   end(slice_cond),
-                                                   begin(m_conditions), end(m_conditions),
-                                                   begin(cond_missing), COMP());
-  long num_cond_miss = last_cond-begin(cond_missing);
-  cond_missing.resize(num_cond_miss);
+  for(;;)  {
+    i_select(required);
+    pool_iov = m_iov;
+    cond_missing.resize(slice_cond.size()+m_conditions.size());
+    calc_missing.resize(slice_calc.size()+m_conditions.size());
+    last_cond = set_difference(begin(slice_cond),   end(slice_cond),
+                               begin(m_conditions), end(m_conditions),
+                               begin(cond_missing), COMP());
+    num_cond_miss = last_cond-begin(cond_missing);
+    cond_missing.resize(num_cond_miss);
+    last_calc = set_difference(begin(slice_calc),   end(slice_calc),
+                               begin(m_conditions), end(m_conditions),
+                               begin(calc_missing), COMP());
+    num_calc_miss = last_calc-begin(calc_missing);
+    calc_missing.resize(num_calc_miss);
+    if ( !do_load || update_guard.owns_lock() || (num_cond_miss == 0 && num_calc_miss == 0) )
+      break;
+    update_guard.lock();
+  }
   printout((flags&PRINT_LOAD) ? INFO : DEBUG,"UserPool",
            "%ld conditions out of %ld conditions are MISSING.",
            num_cond_miss, slice_cond.size());
-  CalcMissing::iterator last_calc = set_difference(begin(slice_calc),   end(slice_calc),
-                                                   begin(m_conditions), end(m_conditions),
-                                                   begin(calc_missing), COMP());
-  long num_calc_miss = last_calc-begin(calc_missing);
-  calc_missing.resize(num_calc_miss);
   printout((flags&PRINT_COMPUTE) ? INFO : DEBUG,"UserPool",
            "%ld derived conditions out of %ld conditions are MISSING.",
            num_calc_miss, slice_calc.size());
@@ -558,7 +580,10 @@ ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required,
   if ( num_cond_miss > 0 )  {
     if ( do_load )  {
       ConditionsDataLoader::LoadedItems loaded;
-      size_t updates = m_loader->load_many(required, cond_missing, loaded, pool_iov);
+      size_t updates = 0;  {
+        lock_guard<mutex> load_guard(s_loaderLock);
+        updates = m_loader->load_many(required, cond_missing, loaded, pool_iov);
+      }
       if ( updates > 0 )  {
         // Need to compute the intersection: All missing entries are required....
         CondMissing load_missing(cond_missing.size()+loaded.size());
@@ -641,23 +666,27 @@ ConditionsMappedUserPool<MAPPING>::load(const IOV&                  required,
   IOV    pool_iov(required.iovType);
   ConditionsManager::Result result;
 
-  // This is a critical operation, because we have to ensure the
-  // IOV pools are ONLY manipulated by the current thread.
-  // Otherwise the selection and the population are unsafe!
-  static mutex lock;
-  lock_guard<mutex> guard(lock);
+  // Shared selection first. Serialize only if conditions must be loaded
+  // and re-select once the update lock is held (see prepare).
+  unique_lock<mutex> update_guard(m_iovPool->update_lock, defer_lock);
+  CondMissing cond_missing;
+  CondMissing::iterator last_cond;
+  long num_cond_miss = 0;
 
-  m_conditions.clear();
   slice_miss_cond.clear();
-  pool_iov.reset().invert();
-  m_iovPool->select(required, Operators::mapConditionsSelect(m_conditions), pool_iov);
-  m_iov = pool_iov;
-  CondMissing cond_missing(slice_cond.size()+m_conditions.size());
-  CondMissing::iterator last_cond = set_difference(begin(slice_cond),   end(slice_cond),
-                                                   begin(m_conditions), end(m_conditions),
-                                                   begin(cond_missing), COMP());
-  long num_cond_miss = last_cond-begin(cond_missing);
-  cond_missing.resize(num_cond_miss);
+  for(;;)  {
+    i_select(required);
+    pool_iov = m_iov;
+    cond_missing.resize(slice_cond.size()+m_conditions.size());
+    last_cond = set_difference(begin(slice_cond),   end(slice_cond),
+                               begin(m_conditions), end(m_conditions),
+                               begin(cond_missing), COMP());
+    num_cond_miss = last_cond-begin(cond_missing);
+    cond_missing.resize(num_cond_miss);
+    if ( !do_load || update_guard.owns_lock() || num_cond_miss == 0 )
+      break;
+    update_guard.lock();
+  }
   printout((flags&PRINT_LOAD) ? INFO : DEBUG,"UserPool",
            "Found %ld missing conditions out of %ld conditions.",
            num_cond_miss, slice_cond.size());
@@ -671,7 +700,10 @@ ConditionsMappedUserPool<MAPPING>::load(const IOV&                  required,
   if ( num_cond_miss > 0 )  {
     if ( do_load )  {
       ConditionsDataLoader::LoadedItems loaded;
-      size_t updates = m_loader->load_many(required, cond_missing, loaded, pool_iov);
+      size_t updates = 0;  {
+        lock_guard<mutex> load_guard(s_loaderLock);
+        updates = m_loader->load_many(required, cond_missing, loaded, pool_iov);
+      }
       if ( updates > 0 )  {
         // Need to compute the intersection: All missing entries are required....
         CondMissing load_missing(cond_missing.size()+loaded.size());
@@ -715,19 +747,30 @@ ConditionsMappedUserPool<MAPPING>::compute(const IOV&                  required,
   IOV    pool_iov(required.iovType);
   ConditionsManager::Result result;
 
-  // This is a critical operation, because we have to ensure the
-  // IOV pools are ONLY manipulated by the current thread.
-  // Otherwise the selection and the population are unsafe!
-  static mutex lock;
-  lock_guard<mutex> guard(lock);
+  // Work on the conditions selected by 'load'. Serialize only if derived
+  // conditions are missing: once the update lock is held, the selection is
+  // refreshed, since other threads may have computed them in the meantime.
+  unique_lock<mutex> update_guard(m_iovPool->update_lock, defer_lock);
+  CalcMissing calc_missing;
+  CalcMissing::iterator last_calc;
+  long num_calc_miss = 0;
 
   slice_miss_calc.clear();
-  CalcMissing calc_missing(slice_calc.size()+m_conditions.size());
-  CalcMissing::iterator last_calc = set_difference(begin(slice_calc),   end(slice_calc),
-                                                   begin(m_conditions), end(m_conditions),
-                                                   begin(calc_missing), COMP());
-  long num_calc_miss = last_calc-begin(calc_missing);
-  calc_missing.resize(num_calc_miss);
+  for(;;)  {
+    calc_missing.resize(slice_calc.size()+m_conditions.size());
+    last_calc = set_difference(begin(slice_calc),   end(slice_calc),
+                               begin(m_conditions), end(m_conditions),
+                               begin(calc_missing), COMP());
+    num_calc_miss = last_calc-begin(calc_missing);
+    calc_missing.resize(num_calc_miss);
+    if ( !do_load || update_guard.owns_lock() || num_calc_miss == 0 )
+      break;
+    update_guard.lock();
+    // Add the conditions registered meanwhile, but keep the ones already present
+    pool_iov.reset().invert();
+    m_iovPool->select(required, Operators::mapConditionsSelect(m_conditions), pool_iov);
+    m_iov.iov_intersection(pool_iov);
+  }
   printout((flags&PRINT_COMPUTE) ? INFO : DEBUG,"UserPool",
            "Found %ld missing derived conditions out of %ld conditions.",
            num_calc_miss, m_conditions.size());
@@ -90,8 +90,8 @@ namespace dd4hep {
     Int_t saveObject(const char *name=0, Int_t option=0, Int_t bufsize=0) const;
   public:
 
-    /// Local method (no interface): Load volume manager.
-    void imp_loadVolumeManager();
+    /// Local method (no interface): Load volume manager. Flags: see VolumeManager::PopulateFlags
+    void imp_loadVolumeManager(int flags = VolumeManager::TREE);
     
     /// Default constructor used by ROOT I/O
     DetectorImp();
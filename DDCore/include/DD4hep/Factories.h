@@ -313,6 +313,13 @@ namespace {
 #define DECLARE_SUBDETECTOR(name,func)            DECLARE_XML_PROCESSOR_BASIC(name,func,0)
 #define DECLARE_DETELEMENT(name,func)             DECLARE_XML_PROCESSOR_BASIC(name,func,0)
 #define DECLARE_DEPRECATED_DETELEMENT(name,func)  DECLARE_XML_PROCESSOR_BASIC(name,func,1)
+/// Detector element factory, which may be executed concurrently with other thread-safe factories
+/** The factory may only use DD4hep primitives to create TGeo objects (see dd4hep::geometry_lock())
+ *  and must not modify the detector description other than through its own DetElement.
+ *  Concurrent execution is enabled in the compact description with <geometry threads="N"/>.
+ */
+#define DECLARE_THREADSAFE_DETELEMENT(name,func)  DECLARE_XML_PROCESSOR_BASIC(name,func,0) \
+  namespace { static bool det_element_thread_safe_##name = dd4hep::declare_thread_safe_factory(#name); }
 
 #define DECLARE_JSON_DETELEMENT(name,func)        DECLARE_JSON_PROCESSOR_BASIC(name,func)
 
@@ -17,6 +17,7 @@
 #include "DD4hep/Fields.h"
 #include "DD4hep/Shapes.h"
 #include <vector>
+#include <string>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -162,5 +163,83 @@ namespace dd4hep {
     virtual void fieldComponents(const double* pos, double* field);
   };
 
+  /// Implementation object of a field defined by values on a regular grid.
+  /**
+   *  The field values are given on the nodes of a regular grid either
+   *  in cartesian coordinates (x,y,z) or in cylindrical coordinates (r,z)
+   *  assuming rotational symmetry around the z-axis.
+   *  The field is interpolated trilinearly (cartesian) or bilinearly (r,z)
+   *  between the grid nodes. Outside the grid no field is added.
+   *
+   *  The grid values are either
+   *  \li memory-mapped from a binary file written by save(), or
+   *  \li computed once ("baked") from a set of other field components,
+   *      e.g. the overlay of analytic fields defined before in the compact
+   *      description. Evaluating the grid is then independent of the number
+   *      and the complexity of the original components.
+   *
+   *  The values are stored as 3 floats per node: (Bx,By,Bz) for cartesian
+   *  grids, (Br,Bphi,Bz) for cylindrical grids. The first coordinate index
+   *  runs fastest.
+   *
+   *  \author  M.Frank
+   *  \version 1.0
+   *  \ingroup DD4HEP_CORE
+   */
+  class GridMapField : public CartesianField::Object {
+  public:
+    /// Grid coordinate systems
+    enum Coordinates { CARTESIAN = 1, CYLINDRICAL = 2 };
+    /// Grid coordinate system
+    int    coordinates  = CARTESIAN;
+    /// Number of grid nodes per axis: (x,y,z) or (r,1,z)
+    int    num[3]       = { 0, 0, 0 };
+    /// Position of the first grid node: (x,y,z) or (r,0,z)
+    double lower[3]     = { 0e0, 0e0, 0e0 };
+    /// Grid spacing: (x,y,z) or (r,0,z)
+    double step[3]      = { 1e0, 1e0, 1e0 };
+
+  protected:
+    /// Inverse grid spacing used by the interpolation
+    double m_invStep[3] = { 1e0, 1e0, 1e0 };
+    /// Scale factor from the units of the grid values to internal field units
+    double m_fieldScale  = 1e0;
+    /// Pointer to the grid values (owned storage or mapped file)
+    const float* m_values = nullptr;
+    /// Owned storage of the grid values if the map was baked
+    std::vector<float> m_storage;
+    /// Base address of the memory-mapped file
+    void*  m_mapping     = nullptr;
+    /// Size of the memory-mapped file
+    size_t m_mappingSize = 0;
+
+    /// Release the grid values
+    void release();
+    /// Precompute the interpolation constants
+    void prepare();
+
+  public:
+    /// Initializing constructor
+    GridMapField();
+    /// Default destructor
+    virtual ~GridMapField();
+    /// Decode the grid coordinate system from its name ("cartesian" or "cylindrical")
+    static Coordinates coordinateSystem(const std::string& name);
+    /// Number of grid nodes
+    size_t numNodes()  const;
+    /// Access the grid values (3 floats per node)
+    const float* values()  const   {  return m_values;  }
+    /// Memory-map the grid definition and the values from a binary file written by save()
+    void load(const std::string& file_name);
+    /// Save the grid definition and the values to a binary file
+    void save(const std::string& file_name)  const;
+    /// Fill the grid with the sum of the given field components. The grid geometry must be set.
+    void bake(const std::vector<CartesianField>& components);
+    /// Call to access the field components at a given location
+    virtual void fieldComponents(const double* pos, double* field);
+    /// Add the field components at n locations (pos[3*n]) to the field array field[3*n]
+    void fieldComponents(size_t n, const double* pos, double* field)  const;
+  };
+
 }         /* End namespace dd4hep             */
 #endif // DD4HEP_FIELDTYPES_H
@@ -42,12 +42,24 @@ namespace dd4hep {
   /// Steer redefinition of variable re-definition during expression evaluation. returns old value
   bool set_allow_variable_redefine(bool value);
 
+  /// Enable/disable the memoization of evaluated expression strings. Calls may be nested.
+  /** Returns the number of clients, which enabled the cache.
+   *  The cache is cleared when the last client disables it.
+   */
+  int set_expression_cache(bool enable);
+
   long num_object_validations();
   void increment_object_validations();
 
   /// Function tp print warning about deprecated factory usage. Used by Plugin mechanism.
   void warning_deprecated_xml_factory(const char* name);
 
+  /// Declare a detector element factory safe for concurrent execution. Used by Plugin mechanism.
+  bool declare_thread_safe_factory(const char* name);
+
+  /// Check if a detector element factory was declared safe for concurrent execution
+  bool is_thread_safe_factory(const std::string& name);
+
 
   /// Access to the magic word, which is protecting some objects against memory corruptions  \ingroup DD4HEP_CORE
   inline unsigned long long int magic_word() {
@@ -47,5 +47,12 @@ namespace dd4hep {
     ~dd4hep_lock_t() {}
   };
 #endif  
+
+  /// Global lock serializing the creation of TGeo objects (shapes, volumes, placements)
+  /** ROOT's TGeoManager registers shapes, volumes and matrices in global lists.
+   *  Detector constructors running concurrently (see <geometry threads="N"/>)
+   *  only call these primitives while holding this lock.
+   */
+  dd4hep_mutex_t& geometry_lock();
 }
 #endif  // DD4HEP_MUTEX_H
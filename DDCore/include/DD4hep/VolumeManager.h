@@ -118,6 +118,8 @@ namespace dd4hep {
       TREE = 1 << 1,   // Build 1 level DetElement hierarchy while populating
       ONE  = 1 << 2,   // Populate all daughter volumes into one big lookup-container
       // This flag may be in parallel with 'TREE'
+      FLAT = 1 << 3,   // Compile the populated manager into a flat, sorted lookup index.
+      // This flag may be in parallel with 'TREE' or 'ONE'. See freeze() for details.
       LAST
     };
 
@@ -175,6 +177,18 @@ namespace dd4hep {
     /// Register physical volume with the manager and pre-computed volume id
     bool adoptPlacement(VolumeID volume_id, VolumeManagerContext* context);
 
+    /// Compile the populated manager into an immutable flat lookup index.
+    /** The index consists of contiguous arrays of (masked VolumeID, context) pairs
+     *  sorted by VolumeID, one array for each distinct sub-detector mask.
+     *  Lookups are then binary searches in contiguous memory rather than
+     *  walks through the (per-subdetector) std::map containers.
+     *  Adopting new placements afterwards invalidates the index.
+     *  Returns the number of indexed placements.
+     */
+    size_t freeze();
+    /// Check if the flat lookup index is present and valid
+    bool isFrozen()  const;
+
     /** This set of functions is required when reading/analyzing
      *  already created hits which have a VolumeID attached.
      */
@@ -344,6 +344,12 @@ namespace dd4hep {
     /// Set flag to enable copy number checks when inserting new nodes
     /** By default checks are enabled. If you want to disable, call this function */
     static void enableCopyNumberCheck(bool value);
+
+    /// Record the placements into the mother volume made by the calling thread
+    /** Used to order the placements of concurrently built subdetectors.
+     *  Recording is stopped by passing an invalid mother or no container.
+     */
+    static void recordPlacements(Volume mother, std::vector<PlacedVolume>* placements);
     
     /// Check if placement is properly instrumented
     Object* data() const;
@@ -30,6 +30,9 @@
 // ROOT include files
 #include "TGeoMatrix.h"
 
+// C/C++ include files
+#include <vector>
+
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
 
@@ -55,6 +58,33 @@ namespace dd4hep {
       ~VolumeManagerContextExtension() = default;
     };
   
+    /// Flat lookup section of a frozen volume manager
+    /**
+     *  All placements sharing the same sub-detector mask are stored in one
+     *  contiguous array sorted by the masked volume identifier.
+     *
+     * \author  M.Frank
+     * \version 1.0
+     * \ingroup DD4HEP_CORE
+     */
+    class VolumeManagerFlatSection {
+    public:
+      /// Single entry of the flat lookup table
+      struct Entry  {
+        /// Masked placement identifier (sort key)
+        VolumeID              identifier;
+        /// Reference to the context owned by the volume manager section
+        VolumeManagerContext* context;
+      };
+      /// Sub-detector mask applied to the volume identifier before the search
+      VolumeID           mask = ~0x0ULL;
+      /// Sorted contiguous array of entries
+      std::vector<Entry> entries;
+    public:
+      /// Search entry by volume identifier. Returns null if not found
+      VolumeManagerContext* search(VolumeID vol_id)  const;
+    };
+
     /// This structure describes the internal data of the volume manager object
     /**
      *
@@ -70,6 +100,8 @@ namespace dd4hep {
       std::map<VolumeID, VolumeManager>         managers;
       /// The container of placements managed by this instance
       std::map<VolumeID, VolumeManagerContext*> volumes;
+      /// Flat lookup index built by VolumeManager::freeze() (top level manager only)
+      std::vector<VolumeManagerFlatSection>     flat;    //! Transient, not persistent
       /// The Detector element handle managed by this instance
       DetElement             detector;
       /// The ID descriptor object
@@ -16,7 +16,10 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <tuple>
 #include <sstream>
+#include <utility>
+#include <cstddef>
 
 
 namespace dd4hep {
@@ -93,6 +96,49 @@ namespace dd4hep {
 
     };
 
+    /// Shift/mask kernels to decode and encode one field of many bit fields at once.
+    /** The loops are branch free and operate on contiguous arrays, so that the
+     *  compiler can vectorize them. Used by BitFieldCoder::decode/encode and by
+     *  BitFieldCoderStatic, where offset and masks are compile time constants.
+     *
+     *    @author M.Frank
+     *    @date  2026-10
+     */
+    struct BitFieldKernel  {
+      /// Extract an unsigned field from count bit fields
+      static void decode(const long64* bitfields, std::size_t count, long64* values,
+                         unsigned offset, ulong64 lowMask)  {
+        for( std::size_t i=0; i<count; ++i )
+          values[i] = long64( ( ulong64(bitfields[i]) >> offset ) & lowMask ) ;
+      }
+      /// Extract a signed field from count bit fields. Sign extension by (v^s)-s
+      static void decodeSigned(const long64* bitfields, std::size_t count, long64* values,
+                               unsigned offset, ulong64 lowMask, ulong64 signBit)  {
+        for( std::size_t i=0; i<count; ++i )  {
+          ulong64 val = ( ulong64(bitfields[i]) >> offset ) & lowMask ;
+          values[i] = long64( ( val ^ signBit ) - signBit ) ;
+        }
+      }
+      /// Add the values of a field to count bit fields. The field bits must be zero
+      static void encode(long64* bitfields, std::size_t count, const long64* values,
+                         unsigned offset, ulong64 mask)  {
+        for( std::size_t i=0; i<count; ++i )
+          bitfields[i] = long64( ulong64(bitfields[i]) | ( ( ulong64(values[i]) << offset ) & mask ) ) ;
+      }
+      /// Index of the first value outside [minVal,maxVal]. count if all values are in range
+      static std::size_t outOfRange(const long64* values, std::size_t count, long64 minVal, long64 maxVal)  {
+        bool bad = false ;
+        for( std::size_t i=0; i<count; ++i )
+          bad |= ( values[i] < minVal ) | ( values[i] > maxVal ) ;
+        if( bad )  {
+          for( std::size_t i=0; i<count; ++i )
+            if( values[i] < minVal || values[i] > maxVal ) return i ;
+        }
+        return count ;
+      }
+      /// Throw the exception for a value out of range
+      [[noreturn]] static void throwOutOfRange(const std::string& name, long64 value, unsigned width) ;
+    };
 
   
     /// Helper class for decoding and encoding a bit field of 64bits for convenient declaration
@@ -195,6 +241,25 @@ namespace dd4hep {
 
 
 
+      /** Decode all fields of count bit fields into structure-of-arrays columns:
+       *  columns[i] must point to an array of count values receiving field i.
+       */
+      void decode(const long64* bitfields, std::size_t count, long64* const* columns) const ;
+
+      /** Decode all fields of the bit fields into columns. 
+       *  The columns are resized to size() vectors of bitfields.size() values.
+       */
+      void decode(const std::vector<long64>& bitfields, std::vector<std::vector<long64> >& columns) const ;
+
+      /** Encode count bit fields from structure-of-arrays columns (see decode).
+       *  The bit fields are overwritten. Values are range checked like in set.
+       */
+      void encode(long64* bitfields, std::size_t count, const long64* const* columns) const ;
+
+      /** Encode bit fields from size() columns of equal length.
+       */
+      void encode(const std::vector<std::vector<long64> >& columns, std::vector<long64>& bitfields) const ;
+
       /** Highest bit used in fields [0-63]
        */
       unsigned highestBit() const ;
@@ -261,6 +326,122 @@ namespace dd4hep {
 
     };
 
+    /// Compile time description of one field for BitFieldCoderStatic.
+    /**  Corresponds to the field descriptor name:OFFSET:SIGNED_WIDTH.
+     *
+     *    @author M.Frank
+     *    @date  2026-10
+     */
+    template <unsigned OFFSET, int SIGNED_WIDTH> struct BitFieldSpec  {
+      static_assert( SIGNED_WIDTH != 0 && OFFSET + unsigned(SIGNED_WIDTH < 0 ? -SIGNED_WIDTH : SIGNED_WIDTH) <= 64,
+                     "BitFieldSpec: field out of range" ) ;
+      /** The field's offset */
+      static constexpr unsigned offset()  {  return OFFSET ;  }
+      /** The field's width */
+      static constexpr unsigned width()   {  return unsigned(SIGNED_WIDTH < 0 ? -SIGNED_WIDTH : SIGNED_WIDTH) ;  }
+      /** True if field is interpreted as signed */
+      static constexpr bool isSigned()    {  return SIGNED_WIDTH < 0 ;  }
+      /** Mask of the field value before shifting */
+      static constexpr ulong64 lowMask()  {  return width() == 64 ? ~0ULL : ( 1ULL << width() ) - 1 ;  }
+      /** The field's mask */
+      static constexpr ulong64 mask()     {  return lowMask() << OFFSET ;  }
+      /** Minimal value  */
+      static constexpr long64 minValue()  {  return isSigned() ? -long64( 1ULL << ( width() - 1 ) ) : 0 ;  }
+      /** Maximal value (same limits as BitFieldElement) */
+      static constexpr long64 maxValue()  {
+        return isSigned() ? long64( ( 1ULL << ( width() - 1 ) ) - 1 ) : width() >= 63 ? long64( ~0ULL >> 1 ) : long64( 1ULL << width() ) ;
+      }
+      /// Field value of one bit field
+      static long64 value(long64 bitfield)  {
+        long64 val ;
+        if( isSigned() )
+          BitFieldKernel::decodeSigned( &bitfield, 1, &val, OFFSET, lowMask(), 1ULL << ( width() - 1 ) ) ;
+        else
+          BitFieldKernel::decode( &bitfield, 1, &val, OFFSET, lowMask() ) ;
+        return val ;
+      }
+      /// Decode this field of count bit fields
+      static void decode(const long64* bitfields, std::size_t count, long64* values)  {
+        if( isSigned() )
+          BitFieldKernel::decodeSigned( bitfields, count, values, OFFSET, lowMask(), 1ULL << ( width() - 1 ) ) ;
+        else
+          BitFieldKernel::decode( bitfields, count, values, OFFSET, lowMask() ) ;
+      }
+      /// Range check and encode this field into count bit fields
+      static void encode(long64* bitfields, std::size_t count, const long64* values, std::size_t idx)  {
+        std::size_t bad = BitFieldKernel::outOfRange( values, count, minValue(), maxValue() ) ;
+        if( bad != count )
+          BitFieldKernel::throwOutOfRange( "#" + std::to_string( idx ), values[bad], width() ) ;
+        BitFieldKernel::encode( bitfields, count, values, OFFSET, mask() ) ;
+      }
+    };
+
+
+    /// Bit field coder with the field layout fixed at compile time.
+    /** Bulk decoding and encoding of whole hit collections with a known readout
+     *  encoding: all offsets and masks are constants, hence the kernels are fully
+     *  inlined. The layout can be checked against the BitFieldCoder of the readout.
+     *
+     *  Example for the encoding "system:5,side:-2,layer:9":<br>
+     *    typedef BitFieldCoderStatic< BitFieldSpec<0,5>, BitFieldSpec<5,-2>, BitFieldSpec<7,9> > Coder ; <br>
+     *    if( !Coder::matches( *readout.idSpec().decoder() ) ) ...  <br>
+     *    Coder::decode( cellIDs, count, columns ) ;                <br>
+     *    long64 layer = Coder::get<2>( cellID ) ;                   <br>
+     *
+     *    @author M.Frank
+     *    @date  2026-10
+     */
+    template <typename... FIELDS> class BitFieldCoderStatic  {
+
+      /// Field specification by index
+      template <std::size_t IDX> using Field = typename std::tuple_element<IDX, std::tuple<FIELDS...> >::type ;
+
+      template <std::size_t... IDX>
+      static void decode_fields(const long64* bitfields, std::size_t count, long64* const* columns, std::index_sequence<IDX...>)  {
+        int expand[] = { 0, ( FIELDS::decode( bitfields, count, columns[IDX] ), 0 )... } ;
+        (void)expand ;
+      }
+      template <std::size_t... IDX>
+      static void encode_fields(long64* bitfields, std::size_t count, const long64* const* columns, std::index_sequence<IDX...>)  {
+        int expand[] = { 0, ( FIELDS::encode( bitfields, count, columns[IDX], IDX ), 0 )... } ;
+        (void)expand ;
+      }
+
+    public:
+      /** Number of fields */
+      static constexpr std::size_t size()  {  return sizeof...(FIELDS) ;  }
+
+      /** Value of the field IDX */
+      template <std::size_t IDX> static long64 get(long64 bitfield)  {
+        return Field<IDX>::value( bitfield ) ;
+      }
+
+      /** True if the runtime coder has exactly this field layout */
+      static bool matches(const BitFieldCoder& coder)  {
+        const unsigned offsets[] = { 0, FIELDS::offset()... } ;
+        const unsigned widths[]  = { 0, FIELDS::width()...  } ;
+        const bool     signs[]   = { false, FIELDS::isSigned()... } ;
+        if( coder.size() != size() ) return false ;
+        for( std::size_t i=0; i<size(); ++i )  {
+          const BitFieldElement& f = coder[ unsigned(i) ] ;
+          if( f.offset() != offsets[i+1] || f.width() != widths[i+1] || f.isSigned() != signs[i+1] )
+            return false ;
+        }
+        return true ;
+      }
+
+      /** Decode all fields of count bit fields into columns (see BitFieldCoder::decode) */
+      static void decode(const long64* bitfields, std::size_t count, long64* const* columns)  {
+        decode_fields( bitfields, count, columns, std::index_sequence_for<FIELDS...>() ) ;
+      }
+
+      /** Encode count bit fields from columns (see BitFieldCoder::encode) */
+      static void encode(long64* bitfields, std::size_t count, const long64* const* columns)  {
+        for( std::size_t i=0; i<count; ++i ) bitfields[i] = 0 ;
+        encode_fields( bitfields, count, columns, std::index_sequence_for<FIELDS...>() ) ;
+      }
+    };
+
 
     /// Helper class  for string tokenization.
     /**  Usage:<br>
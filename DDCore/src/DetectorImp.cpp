@@ -315,9 +315,9 @@ Int_t DetectorImp::saveObject(const char *name, Int_t option, Int_t bufsize) con
 }
 
 // Load volume manager
-void DetectorImp::imp_loadVolumeManager()   {
+void DetectorImp::imp_loadVolumeManager(int flags)   {
   detail::destroyHandle(m_volManager);
-  m_volManager = VolumeManager(*this, "World", world(), Readout(), VolumeManager::TREE);
+  m_volManager = VolumeManager(*this, "World", world(), Readout(), flags);
 }
 
 /// Add an extension object to the Detector instance
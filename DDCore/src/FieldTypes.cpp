@@ -12,8 +12,21 @@
 //==========================================================================
 
 #include "DD4hep/FieldTypes.h"
+#include "DD4hep/Printout.h"
+#include "DD4hep/DD4hepUnits.h"
 #include "DD4hep/detail/Handle.inl"
+
+// C/C++ include files
+#include <algorithm>
 #include <cmath>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 using namespace std;
 using namespace dd4hep;
@@ -37,6 +50,100 @@ DD4HEP_INSTANTIATE_HANDLE(ConstantField);
 DD4HEP_INSTANTIATE_HANDLE(SolenoidField);
 DD4HEP_INSTANTIATE_HANDLE(DipoleField);
 DD4HEP_INSTANTIATE_HANDLE(MultipoleField);
+DD4HEP_INSTANTIATE_HANDLE(GridMapField);
+
+namespace {
+
+  /// Header of the binary file holding a grid field map
+  struct GridMapHeader  {
+    /// File identifier: "DD4hepGM"
+    char    magic[8];
+    /// Format version
+    int32_t version;
+    /// Grid coordinate system (GridMapField::Coordinates)
+    int32_t coordinates;
+    /// Number of grid nodes per axis
+    int32_t num[3];
+    /// Padding
+    int32_t reserved;
+    /// Position of the first grid node in units of the writer
+    double  lower[3];
+    /// Grid spacing in units of the writer
+    double  step[3];
+    /// Value of dd4hep::mm in the units of the writer
+    double  length_unit;
+    /// Value of dd4hep::tesla (scaled to the stored values) in the units of the writer
+    double  field_unit;
+  };
+  static const char   s_gridMapMagic[8] = { 'D','D','4','h','e','p','G','M' };
+  static const int32_t s_gridMapVersion = 1;
+
+  /// Locate the grid cell of a coordinate given in units of the grid spacing
+  inline bool grid_cell(double u, int n, int& idx, double& frac)  {
+    if ( !(u >= 0e0) || u > double(n-1) ) return false;   // also rejects NaN
+    idx  = int(u);
+    if ( idx > n-2 ) idx = n-2;                            // upper grid edge
+    frac = u - double(idx);
+    return true;
+  }
+
+  /// Trilinear interpolation on a cartesian grid. Adds the field to 'field'
+  inline void interpolate_xyz(const float* values, const int* num, const double* lower,
+                              const double* inv_step, double scale, const double* pos, double* field)
+  {
+    int    ix, iy, iz;
+    double fx, fy, fz;
+    if ( !grid_cell((pos[0]-lower[0])*inv_step[0], num[0], ix, fx) ) return;
+    if ( !grid_cell((pos[1]-lower[1])*inv_step[1], num[1], iy, fy) ) return;
+    if ( !grid_cell((pos[2]-lower[2])*inv_step[2], num[2], iz, fz) ) return;
+    const size_t nx  = num[0];
+    const size_t nxy = nx*num[1];
+    const size_t off[8] = { 0, 1, nx, nx+1, nxy, nxy+1, nxy+nx, nxy+nx+1 };
+    const double gx = 1e0-fx, gy = 1e0-fy, gz = 1e0-fz;
+    const double wgt[8] = { gx*gy*gz, fx*gy*gz, gx*fy*gz, fx*fy*gz,
+                            gx*gy*fz, fx*gy*fz, gx*fy*fz, fx*fy*fz };
+    const float* base = values + 3*(ix + nx*iy + nxy*iz);
+    double b[3] = { 0e0, 0e0, 0e0 };
+    // Fixed trip counts without branches: unrolled and vectorized by the compiler
+    for( int k = 0; k < 8; ++k )  {
+      const float* v = base + 3*off[k];
+      b[0] += wgt[k]*v[0];
+      b[1] += wgt[k]*v[1];
+      b[2] += wgt[k]*v[2];
+    }
+    field[0] += scale*b[0];
+    field[1] += scale*b[1];
+    field[2] += scale*b[2];
+  }
+
+  /// Bilinear interpolation on a cylindrical (r,z) grid. Adds the field to 'field'
+  inline void interpolate_rz(const float* values, const int* num, const double* lower,
+                             const double* inv_step, double scale, const double* pos, double* field)
+  {
+    int    ir, iz;
+    double fr, fz;
+    const double r = std::sqrt(pos[0]*pos[0] + pos[1]*pos[1]);
+    if ( !grid_cell((r-lower[0])*inv_step[0], num[0], ir, fr) ) return;
+    if ( !grid_cell((pos[2]-lower[2])*inv_step[2], num[2], iz, fz) ) return;
+    const size_t nr = num[0];
+    const size_t off[4] = { 0, 1, nr, nr+1 };
+    const double gr = 1e0-fr, gz = 1e0-fz;
+    const double wgt[4] = { gr*gz, fr*gz, gr*fz, fr*fz };
+    const float* base = values + 3*(ir + nr*iz);
+    double b[3] = { 0e0, 0e0, 0e0 };
+    for( int k = 0; k < 4; ++k )  {
+      const float* v = base + 3*off[k];
+      b[0] += wgt[k]*v[0];
+      b[1] += wgt[k]*v[1];
+      b[2] += wgt[k]*v[2];
+    }
+    const double c = r > 0e0 ? pos[0]/r : 1e0;
+    const double s = r > 0e0 ? pos[1]/r : 0e0;
+    field[0] += scale*(b[0]*c - b[1]*s);
+    field[1] += scale*(b[0]*s + b[1]*c);
+    field[2] += scale*b[2];
+  }
+}
 
 /// Compute  the field components at a given location and add to given field
 void ConstantField::fieldComponents(const double* /* pos */, double* field) {
@@ -135,3 +242,193 @@ void MultipoleField::fieldComponents(const double* pos, double* field) {
     field[2] += B_z;
   }
 }
+
+/// Initializing constructor
+GridMapField::GridMapField()   {
+  type = CartesianField::MAGNETIC;
+}
+
+/// Default destructor
+GridMapField::~GridMapField()   {
+  release();
+}
+
+/// Release the grid values
+void GridMapField::release()   {
+  if ( m_mapping )  {
+    ::munmap(m_mapping, m_mappingSize);
+    m_mapping = nullptr;
+    m_mappingSize = 0;
+  }
+  m_storage.clear();
+  m_storage.shrink_to_fit();
+  m_values = nullptr;
+}
+
+/// Precompute the interpolation constants
+void GridMapField::prepare()   {
+  if ( coordinates != CARTESIAN && coordinates != CYLINDRICAL )  {
+    except("GridMapField","+++ %s: Invalid grid coordinate system: %d", GetName(), coordinates);
+  }
+  if ( coordinates == CYLINDRICAL )  {
+    num[1]   = 1;
+    lower[1] = 0e0;
+    step[1]  = 0e0;
+  }
+  for( int i = 0; i < 3; ++i )  {
+    if ( coordinates == CYLINDRICAL && i == 1 ) continue;
+    if ( num[i] < 2 || !(step[i] > 0e0) )  {
+      except("GridMapField","+++ %s: Invalid grid definition along axis %d: %d nodes, step %g",
+             GetName(), i, num[i], step[i]);
+    }
+    m_invStep[i] = 1e0/step[i];
+  }
+}
+
+/// Decode the grid coordinate system from its name ("cartesian" or "cylindrical")
+GridMapField::Coordinates GridMapField::coordinateSystem(const string& name)   {
+  string nam = name;
+  transform(nam.begin(), nam.end(), nam.begin(), ::tolower);
+  if ( nam == "cartesian" )
+    return CARTESIAN;
+  else if ( nam == "cylindrical" )
+    return CYLINDRICAL;
+  except("GridMapField","+++ Invalid grid coordinate system: '%s'. "
+         "Allowed are 'cartesian' and 'cylindrical'.", name.c_str());
+  return CARTESIAN; // Will never get here!
+}
+
+/// Number of grid nodes
+size_t GridMapField::numNodes()  const   {
+  return size_t(num[0])*size_t(num[1])*size_t(num[2]);
+}
+
+/// Memory-map the grid definition and the values from a binary file written by save()
+void GridMapField::load(const std::string& file_name)   {
+  struct stat st;
+  GridMapHeader hdr;
+  int fd = ::open(file_name.c_str(), O_RDONLY);
+  if ( fd < 0 )  {
+    except("GridMapField","+++ %s: Failed to open field map %s: %s",
+           GetName(), file_name.c_str(), std::strerror(errno));
+  }
+  if ( ::fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(GridMapHeader) )  {
+    ::close(fd);
+    except("GridMapField","+++ %s: Invalid field map file %s", GetName(), file_name.c_str());
+  }
+  void* ptr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if ( ptr == MAP_FAILED )  {
+    except("GridMapField","+++ %s: Failed to map field map %s: %s",
+           GetName(), file_name.c_str(), std::strerror(errno));
+  }
+  std::memcpy(&hdr, ptr, sizeof(hdr));
+  if ( std::memcmp(hdr.magic, s_gridMapMagic, sizeof(hdr.magic)) != 0 || hdr.version != s_gridMapVersion )  {
+    ::munmap(ptr, st.st_size);
+    except("GridMapField","+++ %s: File %s is no field map of version %d",
+           GetName(), file_name.c_str(), s_gridMapVersion);
+  }
+  release();
+  m_mapping     = ptr;
+  m_mappingSize = st.st_size;
+  coordinates   = hdr.coordinates;
+  for( int i = 0; i < 3; ++i )  {
+    num[i]   = hdr.num[i];
+    lower[i] = hdr.lower[i] * (dd4hep::mm/hdr.length_unit);
+    step[i]  = hdr.step[i]  * (dd4hep::mm/hdr.length_unit);
+  }
+  m_fieldScale = dd4hep::tesla/hdr.field_unit;
+  prepare();
+  if ( m_mappingSize < sizeof(GridMapHeader) + 3*sizeof(float)*numNodes() )  {
+    release();
+    except("GridMapField","+++ %s: Field map %s is truncated.", GetName(), file_name.c_str());
+  }
+  m_values = (const float*)((const char*)m_mapping + sizeof(GridMapHeader));
+  printout(INFO,"GridMapField","+++ %s: Mapped %ld nodes [%d x %d x %d] from %s",
+           GetName(), numNodes(), num[0], num[1], num[2], file_name.c_str());
+}
+
+/// Save the grid definition and the values to a binary file
+void GridMapField::save(const std::string& file_name)  const   {
+  GridMapHeader hdr;
+  if ( !m_values )  {
+    except("GridMapField","+++ %s: Cannot save empty field map to %s", GetName(), file_name.c_str());
+  }
+  std::memset(&hdr, 0, sizeof(hdr));
+  std::memcpy(hdr.magic, s_gridMapMagic, sizeof(hdr.magic));
+  hdr.version     = s_gridMapVersion;
+  hdr.coordinates = coordinates;
+  for( int i = 0; i < 3; ++i )  {
+    hdr.num[i]   = num[i];
+    hdr.lower[i] = lower[i];
+    hdr.step[i]  = step[i];
+  }
+  hdr.length_unit = dd4hep::mm;
+  hdr.field_unit  = dd4hep::tesla/m_fieldScale;
+  FILE* f = std::fopen(file_name.c_str(), "wb");
+  if ( !f )  {
+    except("GridMapField","+++ %s: Failed to open %s: %s", GetName(), file_name.c_str(), std::strerror(errno));
+  }
+  size_t len = 3*numNodes();
+  bool ok = std::fwrite(&hdr, sizeof(hdr), 1, f) == 1 && std::fwrite(m_values, sizeof(float), len, f) == len;
+  ok = (std::fclose(f) == 0) && ok;
+  if ( !ok )  {
+    except("GridMapField","+++ %s: Failed to write field map %s", GetName(), file_name.c_str());
+  }
+  printout(INFO,"GridMapField","+++ %s: Saved %ld nodes to %s", GetName(), numNodes(), file_name.c_str());
+}
+
+/// Fill the grid with the sum of the given field components. The grid geometry must be set.
+void GridMapField::bake(const std::vector<CartesianField>& components)   {
+  prepare();
+  std::vector<float> data(3*numNodes());
+  double pos[3], fld[3];
+  size_t idx = 0;
+  for( int iz = 0; iz < num[2]; ++iz )  {
+    pos[2] = lower[2] + iz*step[2];
+    for( int iy = 0; iy < num[1]; ++iy )  {
+      pos[1] = lower[1] + iy*step[1];
+      for( int ix = 0; ix < num[0]; ++ix, idx += 3 )  {
+        pos[0] = lower[0] + ix*step[0];
+        fld[0] = fld[1] = fld[2] = 0e0;
+        // For cylindrical grids the nodes are at phi=0: (Bx,By) = (Br,Bphi)
+        for( const auto& c : components )
+          c.value(pos, fld);
+        data[idx]   = float(fld[0]);
+        data[idx+1] = float(fld[1]);
+        data[idx+2] = float(fld[2]);
+      }
+    }
+  }
+  release();
+  m_storage    = std::move(data);
+  m_values     = m_storage.data();
+  m_fieldScale = 1e0;
+  printout(INFO,"GridMapField","+++ %s: Baked %ld field components into %ld nodes [%d x %d x %d]",
+           GetName(), components.size(), numNodes(), num[0], num[1], num[2]);
+}
+
+/// Compute the field components at a given location and add to given field
+void GridMapField::fieldComponents(const double* pos, double* field) {
+  if ( !m_values )
+    return;
+  else if ( coordinates == CARTESIAN )
+    interpolate_xyz(m_values, num, lower, m_invStep, m_fieldScale, pos, field);
+  else
+    interpolate_rz(m_values, num, lower, m_invStep, m_fieldScale, pos, field);
+}
+
+/// Add the field components at n locations (pos[3*n]) to the field array field[3*n]
+void GridMapField::fieldComponents(size_t n, const double* pos, double* field)  const  {
+  if ( !m_values )  {
+    return;
+  }
+  else if ( coordinates == CARTESIAN )  {
+    for( size_t i = 0; i < n; ++i )
+      interpolate_xyz(m_values, num, lower, m_invStep, m_fieldScale, pos+3*i, field+3*i);
+  }
+  else  {
+    for( size_t i = 0; i < n; ++i )
+      interpolate_rz(m_values, num, lower, m_invStep, m_fieldScale, pos+3*i, field+3*i);
+  }
+}
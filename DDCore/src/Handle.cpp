@@ -22,6 +22,10 @@
 #include <climits>
 #include <cstring>
 #include <cstdio>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
+#include <set>
 
 #if !defined(WIN32) && !defined(__ICC)
 #include "cxxabi.h"
@@ -49,7 +53,63 @@ namespace   {
       throw runtime_error("dd4hep: "+err.str()+" : value="+value+" [Evaluation error]");
     }
   }
-  
+
+  /// Memoization of evaluated expression strings
+  /**
+   *  Entries keep the compiled expression and the last result. The result is
+   *  valid as long as no existing variable was redefined or removed,
+   *  otherwise the compiled expression is re-evaluated without parsing.
+   */
+  struct ExpressionCache  {
+    struct Entry  {
+      tools::Evaluator::Expression expression;
+      long   generation = -1;
+      double value      = 0e0;
+    };
+    std::mutex  lock;
+    std::atomic<int> clients {0};
+    std::unordered_map<string, Entry> entries;
+
+    /// Evaluate an expression string. Returns false if the string cannot be evaluated
+    bool evaluate(const string& value, double& result)   {
+      long generation = eval.generation();
+      tools::Evaluator::Expression expr;
+      {
+        std::lock_guard<std::mutex> guard(lock);
+        auto i = entries.find(value);
+        if ( i != entries.end() )   {
+          if ( i->second.generation == generation )  {
+            result = i->second.value;
+            return true;
+          }
+          expr = i->second.expression;
+        }
+      }
+      std::pair<int,double> res;
+      if ( expr.empty() )   {
+        auto compiled = eval.compile(value);
+        if ( compiled.first != tools::Evaluator::OK )
+          return false;
+        expr = std::move(compiled.second);
+        res  = expr.evaluate();
+      }
+      else  {
+        res = eval.evaluate(expr);
+      }
+      if ( res.first != tools::Evaluator::OK )
+        return false;
+
+      std::lock_guard<std::mutex> guard(lock);
+      if ( clients > 0 )   {
+        Entry& e = entries[value];
+        e.expression = std::move(expr);
+        e.generation = generation;
+        e.value      = res.second;
+      }
+      result = res.second;
+      return true;
+    }
+  } s_expressionCache;
 }
 
 namespace dd4hep  {
@@ -61,7 +121,23 @@ namespace dd4hep  {
     return tmp;
   }
   
+  /// Enable/disable the memoization of evaluated expression strings. Calls may be nested.
+  int set_expression_cache(bool enable)   {
+    std::lock_guard<std::mutex> guard(s_expressionCache.lock);
+    if ( enable )
+      return ++s_expressionCache.clients;
+    if ( s_expressionCache.clients > 0 && --s_expressionCache.clients == 0 )
+      s_expressionCache.entries.clear();
+    return s_expressionCache.clients;
+  }
+
   std::pair<int, double> _toFloatingPoint(const string& value)   {
+    if ( s_expressionCache.clients > 0 )   {
+      double result = 0e0;
+      if ( s_expressionCache.evaluate(value, result) )
+        return std::make_pair(int(tools::Evaluator::OK), result);
+      // Failed evaluations are repeated below to report the error
+    }
     stringstream err;
     auto result = eval.evaluate(value, err);
     check_evaluation(value, result, err);
@@ -348,6 +424,22 @@ namespace dd4hep  {
     cerr << "++  Please use \"DD4hep_" << name << "\" instead." << setw(93-len) << right << "++" << endl;
     cerr << edge << edge << edge << endl;
   }
+
+  /// Names of detector element factories safe for concurrent execution
+  static pair<mutex, set<string> >& thread_safe_factories()   {
+    static pair<mutex, set<string> > s_factories;
+    return s_factories;
+  }
+  bool declare_thread_safe_factory(const char* name)   {
+    auto& factories = thread_safe_factories();
+    lock_guard<mutex> lock(factories.first);
+    return factories.second.insert(name).second;
+  }
+  bool is_thread_safe_factory(const string& name)   {
+    auto& factories = thread_safe_factories();
+    lock_guard<mutex> lock(factories.first);
+    return factories.second.find(name) != factories.second.end();
+  }
 }
 
 #include "DDSegmentation/Segmentation.h"
@@ -19,6 +19,7 @@
 #include <DD4hep/DD4hepUnits.h>
 #include <DD4hep/ShapeTags.h>
 #include <DD4hep/Printout.h>
+#include <DD4hep/Mutex.h>
 #include <DD4hep/detail/ShapesInterna.h>
 
 // C/C++ include files
@@ -118,10 +119,12 @@ Solid_type<T>::divide(const Volume& voldiv, const string& divname,
 
 /// Constructor to create an anonymous new box object (retrieves name from volume)
 ShapelessSolid::ShapelessSolid(const string& nam)  {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoShapeAssembly(), nam, SHAPELESS_TAG, true);
 }
 
 void Scale::make(const string& nam, Solid base, double x_scale, double y_scale, double z_scale)   {
+  dd4hep_lock_t lock(geometry_lock());
   auto scale = make_unique<TGeoScale>(x_scale, y_scale, z_scale);
   _assign(new TGeoScaledShape(nam.c_str(), base.access(), scale.release()), "", SCALE_TAG, true);
 }
@@ -142,6 +145,7 @@ double Scale::scale_z() const {
 }
 
 void Box::make(const string& nam, double x_val, double y_val, double z_val)   {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoBBox(nam.c_str(), x_val, y_val, z_val), "", BOX_TAG, true);
 }
 
@@ -169,17 +173,20 @@ double Box::z() const {
 
 /// Internal helper method to support object construction
 void HalfSpace::make(const string& nam, const double* const point, const double* const normal)   {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoHalfSpace(nam.c_str(),(Double_t*)point, (Double_t*)normal), "", HALFSPACE_TAG,true);
 }
 
 /// Constructor to be used when creating a new object
 Polycone::Polycone(double startPhi, double deltaPhi) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoPcon(startPhi/units::deg, deltaPhi/units::deg, 0), "", POLYCONE_TAG, false);
 }
 
 /// Constructor to be used when creating a new polycone object. Add at the same time all Z planes
 Polycone::Polycone(double startPhi, double deltaPhi,
                    const vector<double>& rmin, const vector<double>& rmax, const vector<double>& z) {
+  dd4hep_lock_t lock(geometry_lock());
   vector<double> params;
   if (rmin.size() < 2) {
     throw runtime_error("dd4hep: PolyCone Not enough Z planes. minimum is 2!");
@@ -200,6 +207,7 @@ Polycone::Polycone(double startPhi, double deltaPhi,
 
 /// Constructor to be used when creating a new polycone object. Add at the same time all Z planes
 Polycone::Polycone(double startPhi, double deltaPhi, const vector<double>& r, const vector<double>& z) {
+  dd4hep_lock_t lock(geometry_lock());
   vector<double> params;
   if (r.size() < 2) {
     throw runtime_error("dd4hep: PolyCone Not enough Z planes. minimum is 2!");
@@ -220,12 +228,14 @@ Polycone::Polycone(double startPhi, double deltaPhi, const vector<double>& r, co
 
 /// Constructor to be used when creating a new object
 Polycone::Polycone(const string& nam, double startPhi, double deltaPhi) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoPcon(nam.c_str(), startPhi/units::deg, deltaPhi/units::deg, 0), "", POLYCONE_TAG, false);
 }
 
 /// Constructor to be used when creating a new polycone object. Add at the same time all Z planes
 Polycone::Polycone(const string& nam, double startPhi, double deltaPhi,
                    const vector<double>& rmin, const vector<double>& rmax, const vector<double>& z) {
+  dd4hep_lock_t lock(geometry_lock());
   vector<double> params;
   if (rmin.size() < 2) {
     throw runtime_error("dd4hep: PolyCone Not enough Z planes. minimum is 2!");
@@ -246,6 +256,7 @@ Polycone::Polycone(const string& nam, double startPhi, double deltaPhi,
 
 /// Constructor to be used when creating a new polycone object. Add at the same time all Z planes
 Polycone::Polycone(const string& nam, double startPhi, double deltaPhi, const vector<double>& r, const vector<double>& z) {
+  dd4hep_lock_t lock(geometry_lock());
   vector<double> params;
   if (r.size() < 2) {
     throw runtime_error("dd4hep: PolyCone Not enough Z planes. minimum is 2!");
@@ -295,6 +306,7 @@ void ConeSegment::make(const string& nam,
                        double rmin2,     double rmax2,
                        double startPhi,  double endPhi)
 {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoConeSeg(nam.c_str(), dz, rmin1, rmax1, rmin2, rmax2,
                           startPhi/units::deg, endPhi/units::deg), "", CONESEGMENT_TAG, true);
 }
@@ -311,6 +323,7 @@ ConeSegment& ConeSegment::setDimensions(double dz,
 
 /// Constructor to be used when creating a new object with attribute initialization
 void Cone::make(const string& nam, double z, double rmin1, double rmax1, double rmin2, double rmax2) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoCone(nam.c_str(), z, rmin1, rmax1, rmin2, rmax2 ), "", CONE_TAG, true);
 }
 
@@ -323,6 +336,7 @@ Cone& Cone::setDimensions(double z, double rmin1, double rmax1, double rmin2, do
 
 /// Constructor to be used when creating a new object with attribute initialization
 void Tube::make(const string& nam, double rmin, double rmax, double z, double start_phi, double end_phi) {
+  dd4hep_lock_t lock(geometry_lock());
   // Check if it is a full tube
   if(fabs(end_phi-start_phi-2*M_PI)<10e-6){
     _assign(new TGeoTubeSeg(nam.c_str(), rmin, rmax, z, start_phi/units::deg, start_phi/units::deg+360.),nam,TUBE_TAG,true);
@@ -354,6 +368,7 @@ CutTube::CutTube(const string& nam,
 /// Constructor to be used when creating a new object with attribute initialization
 void CutTube::make(const string& nam, double rmin, double rmax, double dz, double start_phi, double end_phi,
                    double lx, double ly, double lz, double tx, double ty, double tz)  {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoCtub(nam.c_str(), rmin,rmax,dz,start_phi,end_phi,lx,ly,lz,tx,ty,tz),"",CUTTUBE_TAG,true);
 }
 
@@ -372,6 +387,7 @@ TruncatedTube::TruncatedTube(const string& nam,
 void TruncatedTube::make(const string& nam,
                          double dz, double rmin, double rmax, double start_phi, double delta_phi,
                          double cut_atStart, double cut_atDelta, bool cut_inside)   {
+  dd4hep_lock_t lock(geometry_lock());
   // check the parameters
   if( rmin <= 0 || rmax <= 0 || cut_atStart <= 0 || cut_atDelta <= 0 )
     except(TRUNCATEDTUBE_TAG,"++ 0 <= rIn,cut_atStart,rOut,cut_atDelta,rOut violated!");
@@ -505,18 +521,21 @@ bool TruncatedTube::cutInside() const   {
 
 /// Constructor to be used when creating a new object with attribute initialization
 void EllipticalTube::make(const string& nam, double a, double b, double dz) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoEltu(nam.c_str(), a, b, dz), "", ELLIPTICALTUBE_TAG, true);
 }
 
 /// Internal helper method to support TwistedTube object construction
 void TwistedTube::make(const std::string& nam, double twist_angle, double rmin, double rmax,
                        double zneg, double zpos, int nsegments, double totphi)   {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TwistedTubeObject(nam.c_str(), twist_angle, rmin, rmax, zneg, zpos, nsegments, totphi/units::deg),
           "", TWISTEDTUBE_TAG, true);
 }
 
 /// Constructor to be used when creating a new object with attribute initialization
 void Trd1::make(const string& nam, double x1, double x2, double y, double z) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoTrd1(nam.c_str(), x1, x2, y, z ), "", TRD1_TAG, true);
 }
 
@@ -529,6 +548,7 @@ Trd1& Trd1::setDimensions(double x1, double x2, double y, double z) {
 
 /// Constructor to be used when creating a new object with attribute initialization
 void Trd2::make(const string& nam, double x1, double x2, double y1, double y2, double z) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoTrd2(nam.c_str(), x1, x2, y1, y2, z ), "", TRD2_TAG, true);
 }
 
@@ -541,6 +561,7 @@ Trd2& Trd2::setDimensions(double x1, double x2, double y1, double y2, double z)
 
 /// Constructor to be used when creating a new object with attribute initialization
 void Paraboloid::make(const string& nam, double r_low, double r_high, double delta_z) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoParaboloid(nam.c_str(), r_low, r_high, delta_z ), "", PARABOLOID_TAG, true);
 }
 
@@ -553,6 +574,7 @@ Paraboloid& Paraboloid::setDimensions(double r_low, double r_high, double delta_
 
 /// Constructor to create a new anonymous object with attribute initialization
 void Hyperboloid::make(const string& nam, double rin, double stin, double rout, double stout, double dz) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoHype(nam.c_str(), rin, stin/units::deg, rout, stout/units::deg, dz), "", HYPERBOLOID_TAG, true);
 }
 
@@ -565,6 +587,7 @@ Hyperboloid& Hyperboloid::setDimensions(double rin, double stin, double rout, do
 
 /// Constructor function to be used when creating a new object with attribute initialization
 void Sphere::make(const string& nam, double rmin, double rmax, double startTheta, double endTheta, double startPhi, double endPhi) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoSphere(nam.c_str(), rmin, rmax,
                          startTheta/units::deg, endTheta/units::deg,
                          startPhi/units::deg,   endPhi/units::deg), "", SPHERE_TAG, true);
@@ -579,6 +602,7 @@ Sphere& Sphere::setDimensions(double rmin, double rmax, double startTheta, doubl
 
 /// Constructor to be used when creating a new object with attribute initialization
 void Torus::make(const string& nam, double r, double rmin, double rmax, double startPhi, double deltaPhi) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoTorus(nam.c_str(), r, rmin, rmax, startPhi/units::deg, deltaPhi/units::deg), "", TORUS_TAG, true);
 }
 
@@ -593,6 +617,7 @@ Torus& Torus::setDimensions(double r, double rmin, double rmax, double startPhi,
 Trap::Trap(double z, double theta, double phi,
            double h1, double bl1, double tl1, double alpha1,
            double h2, double bl2, double tl2, double alpha2) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoTrap(z, theta/units::deg, phi/units::deg,
                        h1, bl1, tl1, alpha1/units::deg,
                        h2, bl2, tl2, alpha2/units::deg), "", TRAP_TAG, true);
@@ -603,6 +628,7 @@ Trap::Trap(const string& nam,
            double z, double theta, double phi,
            double h1, double bl1, double tl1, double alpha1,
            double h2, double bl2, double tl2, double alpha2) {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoTrap(nam.c_str(), z, theta/units::deg, phi/units::deg,
                        h1, bl1, tl1, alpha1/units::deg,
                        h2, bl2, tl2, alpha2/units::deg), "", TRAP_TAG, true);
@@ -610,6 +636,7 @@ Trap::Trap(const string& nam,
 
 /// Constructor to be used when creating a new anonymous object with attribute initialization
 void Trap::make(const string& nam, double pz, double py, double px, double pLTX) {
+  dd4hep_lock_t lock(geometry_lock());
   double z      = pz / 2e0;
   double theta  = 0e0;
   double phi    = 0e0;
@@ -635,6 +662,7 @@ Trap& Trap::setDimensions(double z, double theta, double phi,
 
 /// Internal helper method to support object construction
 void PseudoTrap::make(const string& nam, double x1, double x2, double y1, double y2, double z, double r, bool atMinusZ)    {
+  dd4hep_lock_t lock(geometry_lock());
   double x            = atMinusZ ? x1 : x2;
   double h            = 0;
   bool   intersec     = false; // union or intersection solid
@@ -738,6 +766,7 @@ void PseudoTrap::make(const string& nam, double x1, double x2, double y1, double
 /// Helper function to create poly hedron
 void PolyhedraRegular::make(const string& nam, int nsides, double rmin, double rmax,
                             double zpos, double zneg, double start, double delta) {
+  dd4hep_lock_t lock(geometry_lock());
   if (rmin < 0e0 || rmin > rmax)
     throw runtime_error("dd4hep: PolyhedraRegular: Illegal argument rmin:<" + _toString(rmin) + "> is invalid!");
   else if (rmax < 0e0)
@@ -750,6 +779,7 @@ void PolyhedraRegular::make(const string& nam, int nsides, double rmin, double r
 /// Helper function to create poly hedron
 void Polyhedra::make(const string& nam, int nsides, double start, double delta,
                      const vector<double>& z, const vector<double>& rmin, const vector<double>& rmax)  {
+  dd4hep_lock_t lock(geometry_lock());
   vector<double> temp;
   if ( rmin.size() != z.size() || rmax.size() != z.size() )  {
     except("Polyhedra",
@@ -779,6 +809,7 @@ void ExtrudedPolygon::make(const string&         nam,
                            const vector<double>& sec_y,
                            const vector<double>& sec_scale)
 {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoXtru* solid = new TGeoXtru(sec_z.size());
   _assign(solid, nam, EXTRUDEDPOLYGON_TAG, false);
   // No need to transform coordinates to cm. We are in the dd4hep world: all is already in cm.
@@ -789,17 +820,20 @@ void ExtrudedPolygon::make(const string&         nam,
 
 /// Creator method for arbitrary eight point solids
 void EightPointSolid::make(const string& nam, double dz, const double* vtx)   {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoArb8(nam.c_str(), dz, (double*)vtx), "", EIGHTPOINTSOLID_TAG, true);
 }
 
 #if ROOT_VERSION_CODE > ROOT_VERSION(6,21,0)
 /// Internal helper method to support object construction
 void TessellatedSolid::make(const std::string& nam, int num_facets)   {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoTessellated(nam.c_str(), num_facets), nam, TESSELLATEDSOLID_TAG, false);
 }
 
 /// Internal helper method to support object construction
 void TessellatedSolid::make(const std::string& nam, const std::vector<Vertex>& vertices)   {
+  dd4hep_lock_t lock(geometry_lock());
   _assign(new TGeoTessellated(nam.c_str(), vertices), nam, TESSELLATEDSOLID_TAG, false);
 }
 
@@ -866,180 +900,210 @@ const TGeoMatrix* BooleanSolid::leftMatrix()  const   {
 
 /// Constructor to be used when creating a new object. Position is identity, Rotation is the identity rotation
 SubtractionSolid::SubtractionSolid(const Solid& shape1, const Solid& shape2) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoSubtraction* sub = new TGeoSubtraction(shape1, shape2, detail::matrix::_identity(), detail::matrix::_identity());
   _assign(new TGeoCompositeShape("", sub), "", SUBTRACTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Placement by a generic transformation within the mother
 SubtractionSolid::SubtractionSolid(const Solid& shape1, const Solid& shape2, const Transform3D& trans) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoSubtraction* sub = new TGeoSubtraction(shape1, shape2, detail::matrix::_identity(), detail::matrix::_transform(trans));
   _assign(new TGeoCompositeShape("", sub), "", SUBTRACTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Rotation is the identity rotation
 SubtractionSolid::SubtractionSolid(const Solid& shape1, const Solid& shape2, const Position& pos) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoSubtraction* sub = new TGeoSubtraction(shape1, shape2, detail::matrix::_identity(), detail::matrix::_translation(pos));
   _assign(new TGeoCompositeShape("", sub), "", SUBTRACTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 SubtractionSolid::SubtractionSolid(const Solid& shape1, const Solid& shape2, const RotationZYX& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoSubtraction* sub = new TGeoSubtraction(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotationZYX(rot));
   _assign(new TGeoCompositeShape("", sub), "", SUBTRACTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 SubtractionSolid::SubtractionSolid(const Solid& shape1, const Solid& shape2, const Rotation3D& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoSubtraction* sub = new TGeoSubtraction(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotation3D(rot));
   _assign(new TGeoCompositeShape("", sub), "", SUBTRACTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Position is identity, Rotation is the identity rotation
 SubtractionSolid::SubtractionSolid(const string& nam, const Solid& shape1, const Solid& shape2) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoSubtraction* sub = new TGeoSubtraction(shape1, shape2, detail::matrix::_identity(), detail::matrix::_identity());
   _assign(new TGeoCompositeShape(nam.c_str(), sub), "", SUBTRACTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Placement by a generic transformation within the mother
 SubtractionSolid::SubtractionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const Transform3D& trans) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoSubtraction* sub = new TGeoSubtraction(shape1, shape2, detail::matrix::_identity(), detail::matrix::_transform(trans));
   _assign(new TGeoCompositeShape(nam.c_str(), sub), "", SUBTRACTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Rotation is the identity rotation
 SubtractionSolid::SubtractionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const Position& pos) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoSubtraction* sub = new TGeoSubtraction(shape1, shape2, detail::matrix::_identity(), detail::matrix::_translation(pos));
   _assign(new TGeoCompositeShape(nam.c_str(), sub), "", SUBTRACTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 SubtractionSolid::SubtractionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const RotationZYX& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoSubtraction* sub = new TGeoSubtraction(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotationZYX(rot));
   _assign(new TGeoCompositeShape(nam.c_str(), sub), "", SUBTRACTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 SubtractionSolid::SubtractionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const Rotation3D& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoSubtraction* sub = new TGeoSubtraction(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotation3D(rot));
   _assign(new TGeoCompositeShape(nam.c_str(), sub), "", SUBTRACTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Position is identity, Rotation is identity rotation
 UnionSolid::UnionSolid(const Solid& shape1, const Solid& shape2) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoUnion* uni = new TGeoUnion(shape1, shape2, detail::matrix::_identity(), detail::matrix::_identity());
   _assign(new TGeoCompositeShape("", uni), "", UNION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Placement by a generic transformation within the mother
 UnionSolid::UnionSolid(const Solid& shape1, const Solid& shape2, const Transform3D& trans) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoUnion* uni = new TGeoUnion(shape1, shape2, detail::matrix::_identity(), detail::matrix::_transform(trans));
   _assign(new TGeoCompositeShape("", uni), "", UNION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Rotation is identity rotation
 UnionSolid::UnionSolid(const Solid& shape1, const Solid& shape2, const Position& pos) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoUnion* uni = new TGeoUnion(shape1, shape2, detail::matrix::_identity(), detail::matrix::_translation(pos));
   _assign(new TGeoCompositeShape("", uni), "", UNION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 UnionSolid::UnionSolid(const Solid& shape1, const Solid& shape2, const RotationZYX& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoUnion *uni = new TGeoUnion(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotationZYX(rot));
   _assign(new TGeoCompositeShape("", uni), "", UNION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 UnionSolid::UnionSolid(const Solid& shape1, const Solid& shape2, const Rotation3D& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoUnion *uni = new TGeoUnion(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotation3D(rot));
   _assign(new TGeoCompositeShape("", uni), "", UNION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Position is identity, Rotation is identity rotation
 UnionSolid::UnionSolid(const string& nam, const Solid& shape1, const Solid& shape2) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoUnion* uni = new TGeoUnion(shape1, shape2, detail::matrix::_identity(), detail::matrix::_identity());
   _assign(new TGeoCompositeShape(nam.c_str(), uni), "", UNION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Placement by a generic transformation within the mother
 UnionSolid::UnionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const Transform3D& trans) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoUnion* uni = new TGeoUnion(shape1, shape2, detail::matrix::_identity(), detail::matrix::_transform(trans));
   _assign(new TGeoCompositeShape(nam.c_str(), uni), "", UNION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Rotation is identity rotation
 UnionSolid::UnionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const Position& pos) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoUnion* uni = new TGeoUnion(shape1, shape2, detail::matrix::_identity(), detail::matrix::_translation(pos));
   _assign(new TGeoCompositeShape(nam.c_str(), uni), "", UNION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 UnionSolid::UnionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const RotationZYX& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoUnion *uni = new TGeoUnion(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotationZYX(rot));
   _assign(new TGeoCompositeShape(nam.c_str(), uni), "", UNION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 UnionSolid::UnionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const Rotation3D& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoUnion *uni = new TGeoUnion(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotation3D(rot));
   _assign(new TGeoCompositeShape(nam.c_str(), uni), "", UNION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Position is identity, Rotation is identity rotation
 IntersectionSolid::IntersectionSolid(const Solid& shape1, const Solid& shape2) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoIntersection* inter = new TGeoIntersection(shape1, shape2, detail::matrix::_identity(), detail::matrix::_identity());
   _assign(new TGeoCompositeShape("", inter), "", INTERSECTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Placement by a generic transformation within the mother
 IntersectionSolid::IntersectionSolid(const Solid& shape1, const Solid& shape2, const Transform3D& trans) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoIntersection* inter = new TGeoIntersection(shape1, shape2, detail::matrix::_identity(), detail::matrix::_transform(trans));
   _assign(new TGeoCompositeShape("", inter), "", INTERSECTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Position is identity.
 IntersectionSolid::IntersectionSolid(const Solid& shape1, const Solid& shape2, const Position& pos) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoIntersection* inter = new TGeoIntersection(shape1, shape2, detail::matrix::_identity(), detail::matrix::_translation(pos));
   _assign(new TGeoCompositeShape("", inter), "", INTERSECTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 IntersectionSolid::IntersectionSolid(const Solid& shape1, const Solid& shape2, const RotationZYX& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoIntersection* inter = new TGeoIntersection(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotationZYX(rot));
   _assign(new TGeoCompositeShape("", inter), "", INTERSECTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 IntersectionSolid::IntersectionSolid(const Solid& shape1, const Solid& shape2, const Rotation3D& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoIntersection* inter = new TGeoIntersection(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotation3D(rot));
   _assign(new TGeoCompositeShape("", inter), "", INTERSECTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Position is identity, Rotation is identity rotation
 IntersectionSolid::IntersectionSolid(const string& nam, const Solid& shape1, const Solid& shape2) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoIntersection* inter = new TGeoIntersection(shape1, shape2, detail::matrix::_identity(), detail::matrix::_identity());
   _assign(new TGeoCompositeShape(nam.c_str(), inter), "", INTERSECTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Placement by a generic transformation within the mother
 IntersectionSolid::IntersectionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const Transform3D& trans) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoIntersection* inter = new TGeoIntersection(shape1, shape2, detail::matrix::_identity(), detail::matrix::_transform(trans));
   _assign(new TGeoCompositeShape(nam.c_str(), inter), "", INTERSECTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object. Position is identity.
 IntersectionSolid::IntersectionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const Position& pos) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoIntersection* inter = new TGeoIntersection(shape1, shape2, detail::matrix::_identity(), detail::matrix::_translation(pos));
   _assign(new TGeoCompositeShape(nam.c_str(), inter), "", INTERSECTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 IntersectionSolid::IntersectionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const RotationZYX& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoIntersection* inter = new TGeoIntersection(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotationZYX(rot));
   _assign(new TGeoCompositeShape(nam.c_str(), inter), "", INTERSECTION_TAG, true);
 }
 
 /// Constructor to be used when creating a new object
 IntersectionSolid::IntersectionSolid(const string& nam, const Solid& shape1, const Solid& shape2, const Rotation3D& rot) {
+  dd4hep_lock_t lock(geometry_lock());
   TGeoIntersection* inter = new TGeoIntersection(shape1, shape2, detail::matrix::_identity(), detail::matrix::_rotation3D(rot));
   _assign(new TGeoCompositeShape(nam.c_str(), inter), "", INTERSECTION_TAG, true);
 }
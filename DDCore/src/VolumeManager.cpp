@@ -23,6 +23,7 @@
 // C/C++ includes
 #include <set>
 #include <cmath>
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 
@@ -341,6 +342,11 @@ VolumeManager::VolumeManager(const Detector& description, const string& nam, Det
     obj_ptr->flags = flags;
     p.populate(elt);
     node_count = p.numNodes();
+    if ( (flags & FLAT) == FLAT )  {
+      size_t num_indexed = freeze();
+      printout(INFO, "VolumeManager", " - flat lookup index built with %ld entries in %ld sections.",
+               num_indexed, obj_ptr->flat.size());
+    }
   }
   printout(INFO, "VolumeManager", " - populating volume ids - done. %ld nodes.",node_count);
 }
@@ -463,6 +469,12 @@ bool VolumeManager::adoptPlacement(VolumeID sys_id, VolumeManagerContext* contex
   if ( i == o.volumes.end()) {
     o.volumes[vid] = context;
     o.detMask |= mask;
+    if ( !o.flat.empty() || (o.top && !o.top->flat.empty()) )  {
+      printout(WARNING, "VolumeManager", "+++ Adopting placement %s invalidates the flat lookup index.",
+               pv.name());
+      o.flat.clear();
+      if ( o.top ) o.top->flat.clear();
+    }
     err << "Inserted new volume:" << setw(6) << left << o.volumes.size()
         << " Ptr:"  << (void*) pv.ptr()
         << " ["     << pv.name() << "]"
@@ -548,6 +560,14 @@ VolumeManagerContext* VolumeManager::lookupContext(VolumeID volume_id) const {
       return VolumeManager(o.top).lookupContext(volume_id);
     }
     VolumeID id = volume_id;
+    /// If the manager was frozen, the flat index contains all entries
+    if ( !o.flat.empty() )  {
+      for (const auto& sec : o.flat )  {
+        if ( (c = sec.search(id)) != 0 )
+          return c;
+      }
+      except("VolumeManager","lookupContext: Failed to search Volume context %016llX [Unknown identifier]", (void*)volume_id);
+    }
     /// First look in our own volume cache if the entry is found.
     c = o.search(id);
     if (c)
@@ -565,6 +585,57 @@ VolumeManagerContext* VolumeManager::lookupContext(VolumeID volume_id) const {
   return 0;
 }
 
+/// Compile the populated manager into an immutable flat lookup index.
+size_t VolumeManager::freeze()   {
+  if ( isValid() )  {
+    typedef VolumeManagerFlatSection::Entry Entry;
+    Object& o = _data();
+    vector<VolumeManagerFlatSection> sections;
+    /// Add one cached volume container. Sections with identical masks are merged.
+    auto add_section = [&sections](VolumeID mask, const map<VolumeID, VolumeManagerContext*>& vols)  {
+      if ( vols.empty() ) return;
+      auto it = find_if(sections.begin(), sections.end(),
+                        [mask](const VolumeManagerFlatSection& s) { return s.mask == mask; });
+      if ( it == sections.end() )  {
+        sections.emplace_back();
+        it = sections.end()-1;
+        it->mask = mask;
+      }
+      it->entries.reserve(it->entries.size()+vols.size());
+      for ( const auto& v : vols )
+        it->entries.emplace_back(Entry{v.first, v.second});
+    };
+    /// Preserve the search order of lookupContext: first own volumes, then the subdetectors
+    add_section(o.detMask, o.volumes);
+    if ( (o.flags & ONE) != ONE )  {
+      for ( const auto& j : o.subdetectors )  {
+        const Object& mo = j.second._data();
+        add_section(mo.detMask, mo.volumes);
+      }
+    }
+    size_t num_entries = 0;
+    for ( auto& sec : sections )  {
+      /// Stable sort: on duplicate keys the first registered context wins like for the maps
+      stable_sort(sec.entries.begin(), sec.entries.end(),
+                  [](const Entry& a, const Entry& b) { return a.identifier < b.identifier; });
+      auto last = unique(sec.entries.begin(), sec.entries.end(),
+                         [](const Entry& a, const Entry& b) { return a.identifier == b.identifier; });
+      sec.entries.erase(last, sec.entries.end());
+      sec.entries.shrink_to_fit();
+      num_entries += sec.entries.size();
+    }
+    o.flat = std::move(sections);
+    return num_entries;
+  }
+  except("VolumeManager","freeze: Failed to build flat lookup index [Invalid Manager Handle]");
+  return 0;
+}
+
+/// Check if the flat lookup index is present and valid
+bool VolumeManager::isFrozen()  const   {
+  return isValid() && !_data().flat.empty();
+}
+
 /// Lookup a physical (placed) volume identified by its 64 bit hit ID
 PlacedVolume VolumeManager::lookupDetElementPlacement(VolumeID volume_id) const {
   VolumeManagerContext* c = lookupContext(volume_id); // Throws exception if not found!
@@ -670,6 +741,14 @@ void VolumeManagerObject::update(unsigned long tags, DetElement& det, void* para
     printout(DEBUG,"VolumeManager","+++ Alignment update %s",i.second->elementPlacement().name());
 }
 
+/// Search entry by volume identifier. Returns null if not found
+VolumeManagerContext* VolumeManagerFlatSection::search(VolumeID vol_id)  const   {
+  VolumeID key = vol_id&mask;
+  auto i = lower_bound(entries.begin(), entries.end(), key,
+                       [](const Entry& e, VolumeID k) { return e.identifier < k; });
+  return (i != entries.end() && i->identifier == key) ? i->context : 0;
+}
+
 /// Search the locally cached volumes for a matching ID
 VolumeManagerContext* VolumeManagerObject::search(const VolumeID& vol_id) const {
   auto i = volumes.find(vol_id&detMask);
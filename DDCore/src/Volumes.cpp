@@ -15,6 +15,7 @@
 #include "DD4hep/Detector.h"
 #include "DD4hep/Printout.h"
 #include "DD4hep/InstanceCount.h"
+#include "DD4hep/Mutex.h"
 #include "DD4hep/MatrixHelpers.h"
 #include "DD4hep/detail/ObjectsInterna.h"
 
@@ -61,21 +62,32 @@ template <typename T> static typename T::Object* _userExtension(const T& v)  {
 
 ClassImp(PlacedVolumeExtension)
 
+/// Global lock serializing the creation of TGeo objects
+dd4hep_mutex_t& dd4hep::geometry_lock()   {
+  static dd4hep_mutex_t s_lock;
+  return s_lock;
+}
+
 namespace {
 
   static bool s_verifyCopyNumbers = true;
+  /// Placements into the recorded mother volume made by this thread (see Volume::recordPlacements)
+  thread_local pair<TGeoVolume*, vector<PlacedVolume>*> s_recordPlacements { nullptr, nullptr };
 
   TGeoVolume* _createTGeoVolume(const string& name, TGeoShape* s, TGeoMedium* m)  {
+    dd4hep_lock_t lock(geometry_lock());
     geo_volume_t* e = new geo_volume_t(name.c_str(),s,m);
     e->SetUserExtension(new Volume::Object());
     return e;
   }
   TGeoVolume* _createTGeoVolumeAssembly(const string& name)  {
+    dd4hep_lock_t lock(geometry_lock());
     geo_assembly_t* e = new geo_assembly_t(name.c_str()); // It is important to use the correct constructor!!
     e->SetUserExtension(new Assembly::Object());
     return e;
   }
   TGeoVolumeMulti* _createTGeoVolumeMulti(const string& name, TGeoMedium* medium)  {
+    dd4hep_lock_t lock(geometry_lock());
     TGeoVolumeMulti* e = new TGeoVolumeMulti(name.c_str(), medium);
     e->SetUserExtension(new VolumeMulti::Object());
     return e;
@@ -198,6 +210,7 @@ namespace {
   };
 
   TGeoVolume* MakeReflection(TGeoVolume* v, const char* newname=0)  {
+    dd4hep_lock_t lock(geometry_lock());
     static TMap map(100);
     TGeoVolume* vol = (TGeoVolume*)map.GetValue(v);
     if ( vol ) {
@@ -551,6 +564,11 @@ void Volume::enableCopyNumberCheck(bool value)    {
   s_verifyCopyNumbers = value;
 }
 
+/// Record the placements into the mother volume made by the calling thread
+void Volume::recordPlacements(Volume mother, vector<PlacedVolume>* placements)    {
+  s_recordPlacements = make_pair(placements ? mother.ptr() : nullptr, placements);
+}
+
 /// Check if placement is properly instrumented
 Volume::Object* Volume::data() const   {
   Volume::Object* o = _userExtension(*this);
@@ -617,6 +635,7 @@ Volume Volume::divide(const std::string& divname, int iaxis, int ndiv,
                       double start, double step, int numed, const char* option)   {
   TGeoVolume* p = m_element;
   if ( p )  {
+    dd4hep_lock_t lock(geometry_lock());
     TGeoVolume* mvp = p->Divide(divname.c_str(), iaxis, ndiv, start, step, numed, option);
     if ( mvp )   {
       VolumeImport imp;
@@ -641,6 +660,8 @@ PlacedVolume _addNode(TGeoVolume* par, TGeoVolume* daughter, int id, TGeoMatrix*
   else if ( !transform )   {
     except("dd4hep","Volume: Attempt to place volume without placement matrix.");
   }
+  // The matrix (e.g. the identity) and the assembly shapes may be shared between threads
+  dd4hep_lock_t lock(geometry_lock());
   if ( transform != detail::matrix::_identity() ) {
     string nam = string(daughter->GetName()) + "_placement";
     transform->SetName(nam.c_str());
@@ -689,6 +710,9 @@ PlacedVolume _addNode(TGeoVolume* par, TGeoVolume* daughter, int id, TGeoMatrix*
     printout(ERROR,"PlacedVolume","++ FAILED to place node %s",(const char*)nam_id);
   }
   n->geo_node_t::SetUserExtension(new PlacedVolume::Object());
+  if ( parent == s_recordPlacements.first )   {
+    s_recordPlacements.second->emplace_back(n);
+  }
   return PlacedVolume(n);
 }
 
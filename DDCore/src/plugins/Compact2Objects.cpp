@@ -49,7 +49,13 @@
 #include <TMath.h>
 
 // C/C++ include files
+#include <cmath>
 #include <climits>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <exception>
 #include <iostream>
 #include <iomanip>
 #include <set>
@@ -128,6 +134,13 @@ namespace {
     bool matrix       = false;
     bool surface      = false;
   } s_debug;
+
+  /// Memoize repeated expression strings while a compact description is processed
+  class ExpressionCacheGuard  {
+  public:
+    ExpressionCacheGuard()   {  set_expression_cache(true);   }
+    ~ExpressionCacheGuard()  {  set_expression_cache(false);  }
+  };
 }
 
 static Ref_t create_ConstantField(Detector& /* description */, xml_h e) {
@@ -260,6 +273,66 @@ static Ref_t create_MultipoleField(Detector& description, xml_h e) {
 }
 DECLARE_XMLELEMENT(MultipoleMagnet,create_MultipoleField)
 
+/** Grid field map: Either memory-mapped from a binary file or baked from the
+ *  field components of the same type defined before in the compact description.
+ *  The baked map replaces these components in the field overlay.
+ *
+ *  <field name="Map" type="FieldMap" field="magnetic" file="field.map"/>
+ *
+ *  <field name="Map" type="FieldMap" field="magnetic" bake="true"
+ *         coordinates="cylindrical" output="field.map">
+ *    <dimensions rmin="0*m" rmax="3*m" dr="1*cm" zmin="-4*m" zmax="4*m" dz="1*cm"/>
+ *  </field>
+ *
+ *  Cartesian grids (coordinates="cartesian", default) use the dimension attributes
+ *  xmin, xmax, dx, ymin, ymax, dy, zmin, zmax, dz.
+ */
+static Ref_t create_GridMapField(Detector& description, xml_h e) {
+  xml_dim_t c(e);
+  CartesianField obj;
+  GridMapField* ptr = new GridMapField();
+  string t = c.hasAttr(_U(field)) ? c.attr<string>(_U(field)) : string("magnetic");
+  ptr->type = ::toupper(t[0]) == 'E' ? CartesianField::ELECTRIC : CartesianField::MAGNETIC;
+  obj.assign(ptr, c.nameStr(), c.typeStr());
+  if ( c.hasAttr(_U(file)) )  {
+    ptr->load(c.attr<string>(_U(file)));
+  }
+  else if ( c.hasAttr(_Unicode(bake)) && c.attr<bool>(_Unicode(bake)) )  {
+    xml_dim_t dim = c.child(_U(dimensions));
+    string    crd = c.hasAttr(_Unicode(coordinates)) ? c.attr<string>(_Unicode(coordinates)) : string("cartesian");
+    ptr->coordinates = GridMapField::coordinateSystem(crd);
+    auto axis = [ptr](int i, double lo, double hi, double stp)  {
+      ptr->lower[i] = lo;
+      ptr->step[i]  = stp;
+      ptr->num[i]   = stp > 0e0 ? int(std::floor((hi-lo)/stp + 0.5)) + 1 : 0;
+    };
+    if ( ptr->coordinates == GridMapField::CYLINDRICAL )  {
+      axis(0, dim.rmin(0e0), dim.rmax(), dim.dr());
+    }
+    else  {
+      axis(0, dim.xmin(), dim.xmax(), dim.dx());
+      axis(1, dim.ymin(), dim.ymax(), dim.dy());
+    }
+    axis(2, dim.zmin(), dim.zmax(), dim.dz());
+    OverlayedField::Object* o = description.field().data<OverlayedField::Object>();
+    bool is_electric = ptr->type == CartesianField::ELECTRIC;
+    vector<CartesianField>& components = is_electric ? o->electric_components : o->magnetic_components;
+    ptr->bake(components);
+    // The baked grid replaces the original components in the overlay
+    components.clear();
+    (is_electric ? o->electric : o->magnetic) = CartesianField();
+    if ( c.hasAttr(_Unicode(output)) )  {
+      ptr->save(c.attr<string>(_Unicode(output)));
+    }
+  }
+  else  {
+    throw_print("Compact2Objects[ERROR]: A field map requires either the attribute "
+                "file or bake=\"true\" with the grid dimensions. [" + c.nameStr() + "]");
+  }
+  return obj;
+}
+DECLARE_XMLELEMENT(FieldMap,create_GridMapField)
+
 static long load_Compact(Detector& description, xml_h element) {
   Converter<Compact>converter(description);
   converter(element);
@@ -1216,24 +1289,130 @@ static void setChildTitles(const pair<string, DetElement>& e) {
   for_each(children.begin(), children.end(), setChildTitles);
 }
 
-template <> void Converter<DetElement>::operator()(xml_h element) const {
+namespace {
+
+  /// Work item to build one subdetector from its compact description
+  /**
+   *  \author  M.Frank
+   *  \version 1.0
+   *  \ingroup DD4HEP_XML
+   */
+  class DetectorBuild  {
+  public:
+    /// Compact element of the subdetector
+    xml_h              element   { 0 };
+    /// Subdetector name and factory type
+    string             name, type;
+    /// Sensitive detector and segmentation if a readout is attached
+    SensitiveDetector  sd;
+    Segmentation       seg;
+    /// Resulting detector element
+    DetElement         det;
+    /// Placements into the world volume made by a concurrently executed factory
+    vector<PlacedVolume> placements;
+    /// Exception raised by the factory when executed on a worker thread
+    exception_ptr      error;
+    /// Time spent in the detector factory
+    double             seconds   { 0e0 };
+    /// Flag if the factory was executed concurrently with others
+    bool               concurrent { false };
+  };
+
+  /// Helper to drive the construction of all subdetectors of a compact description
+  /**
+   *  Subdetectors are set up and registered sequentially in document order.
+   *  If more than one thread is requested, consecutive subdetectors with a factory
+   *  declared with DECLARE_THREADSAFE_DETELEMENT and without parent detector are
+   *  collected and their factories are executed concurrently on a pool of threads.
+   *  Creating TGeo objects is serialized by dd4hep::geometry_lock(). The placements
+   *  of these subdetectors into the world volume are reordered when the subdetectors
+   *  are registered, so that the geometry tree does not depend on the thread timing.
+   *
+   *  The builder of the outermost compact file is shared by all included files.
+   *  Documents holding pending subdetectors are kept until the factories ran.
+   *  Included compact files finish their pending subdetectors before they return,
+   *  because their document is released by the caller.
+   *
+   *  \author  M.Frank
+   *  \version 1.0
+   *  \ingroup DD4HEP_XML
+   */
+  class DetectorBuilder  {
+  public:
+    typedef chrono::steady_clock clock_type;
+    /// Reference to the detector description
+    Detector&                          description;
+    /// Subdetectors waiting for concurrent construction
+    vector<unique_ptr<DetectorBuild> > pending;
+    /// Subdetectors built so far (used for the timing report)
+    vector<unique_ptr<DetectorBuild> > done;
+    /// Included documents referenced by pending subdetectors
+    vector<unique_ptr<xml::DocumentHolder> > documents;
+    /// Start time of the detector conversion
+    clock_type::time_point             start { clock_type::now() };
+    /// Number of threads to execute thread-safe factories
+    size_t                             num_threads { 0 };
+    /// Flag to print the construction time of each subdetector
+    bool                               timing { false };
+
+  public:
+    /// Initializing constructor
+    DetectorBuilder(Detector& d, size_t threads = 0, bool time = false)
+      : description(d), num_threads(threads), timing(time) {}
+    /// Setup the subdetector: apply selections, declare parent and sensitive detector
+    bool prepare(xml_h element, DetectorBuild& item)  const;
+    /// Execute the subdetector factory
+    void build(DetectorBuild& item)  const;
+    /// Register the subdetector with the detector description
+    void publish(DetectorBuild& item)  const;
+    /// Convert one subdetector. Thread-safe factories may be deferred
+    void convert(xml_h element);
+    /// Keep an included document alive while subdetectors are pending
+    void adopt(xml::DocumentHolder& doc);
+    /// Execute all pending factories concurrently and register the results
+    void flush();
+    /// Print the construction time of all subdetectors
+    void report()  const;
+  };
+
+  /// Builder of the compact description currently processed by this thread
+  thread_local DetectorBuilder* s_detectorBuilder = nullptr;
+
+  /// Install a subdetector builder for the outermost compact file
+  class DetectorBuilderGuard  {
+  public:
+    unique_ptr<DetectorBuilder> builder;
+    DetectorBuilderGuard(Detector& description, size_t threads, bool timing)  {
+      if ( !s_detectorBuilder )  {
+        builder = make_unique<DetectorBuilder>(description, threads, timing);
+        s_detectorBuilder = builder.get();
+      }
+    }
+    ~DetectorBuilderGuard()  {
+      if ( builder )  s_detectorBuilder = nullptr;
+    }
+  };
+}
+
+/// Setup the subdetector: apply selections, declare parent and sensitive detector
+bool DetectorBuilder::prepare(xml_h element, DetectorBuild& item)  const  {
   static const char* req_dets = ::getenv("REQUIRED_DETECTORS");
   static const char* req_typs = ::getenv("REQUIRED_DETECTOR_TYPES");
   static const char* ign_dets = ::getenv("IGNORED_DETECTORS");
   static const char* ign_typs = ::getenv("IGNORED_DETECTOR_TYPES");
-  string type = element.attr<string>(_U(type));
-  string name = element.attr<string>(_U(name));
+  const string& type = item.type;
+  const string& name = item.name;
   string name_match = ":" + name + ":";
   string type_match = ":" + type + ":";
 
   if (req_dets && !strstr(req_dets, name_match.c_str()))
-    return;
+    return false;
   if (req_typs && !strstr(req_typs, type_match.c_str()))
-    return;
+    return false;
   if (ign_dets && strstr(ign_dets, name_match.c_str()))
-    return;
+    return false;
   if (ign_typs && strstr(ign_typs, type_match.c_str()))
-    return;
+    return false;
   xml_attr_t attr_ignore = element.attr_nothrow(_U(ignore));
   if ( attr_ignore )   {
     bool ignore_det = element.attr<bool>(_U(ignore));
@@ -1241,67 +1420,134 @@ template <> void Converter<DetElement>::operator()(xml_h element) const {
       printout(INFO, "Compact",
                "+++ Do not build subdetector:%s [ignore flag set]",
                name.c_str());
-      return;
+      return false;
     }
   }
-  try {
-    string par_name;
-    xml_attr_t attr_par = element.attr_nothrow(_U(parent));
-    xml_elt_t  elt_par(0);
-    if (attr_par)
-      par_name = element.attr<string>(attr_par);
-    else if ( (elt_par=element.child(_U(parent),false)) )
-      par_name = elt_par.attr<string>(_U(name));
-    if ( !par_name.empty() ) {
-      // We have here a nested detector. If the mother volume is not yet registered
-      // it must be done here, so that the detector constructor gets the correct answer from
-      // the call to Detector::pickMotherVolume(DetElement).
-      if ( par_name[0] == '$' ) par_name = xml::getEnviron(par_name);
-      DetElement parent = description.detector(par_name);
-      if ( !parent.isValid() )  {
-        except("Compact","Failed to access valid parent detector of %s",name.c_str());
-      }
-      description.declareParent(name, parent);
+  string par_name;
+  xml_attr_t attr_par = element.attr_nothrow(_U(parent));
+  xml_elt_t  elt_par(0);
+  if (attr_par)
+    par_name = element.attr<string>(attr_par);
+  else if ( (elt_par=element.child(_U(parent),false)) )
+    par_name = elt_par.attr<string>(_U(name));
+  if ( !par_name.empty() ) {
+    // We have here a nested detector. If the mother volume is not yet registered
+    // it must be done here, so that the detector constructor gets the correct answer from
+    // the call to Detector::pickMotherVolume(DetElement).
+    if ( par_name[0] == '$' ) par_name = xml::getEnviron(par_name);
+    DetElement parent = description.detector(par_name);
+    if ( !parent.isValid() )  {
+      except("Compact","Failed to access valid parent detector of %s",name.c_str());
     }
-    xml_attr_t attr_ro  = element.attr_nothrow(_U(readout));
-    SensitiveDetector sd;
-    Segmentation seg;
-    if ( attr_ro )   {
-      Readout ro = description.readout(element.attr<string>(attr_ro));
-      if (!ro.isValid()) {
-        throw runtime_error("No Readout structure present for detector:" + name);
-      }
-      seg = ro.segmentation();
-      sd = SensitiveDetector(name, "sensitive");
-      sd.setHitsCollection(ro.name());
-      sd.setReadout(ro);
-      description.addSensitiveDetector(sd);
-    }
-    Ref_t sens = sd;
-    DetElement det(Ref_t(PluginService::Create<NamedObject*>(type, &description, &element, &sens)));
-    if (det.isValid()) {
-      setChildTitles(make_pair(name, det));
-      if ( sd.isValid() )  {
-        det->flag |= DetElement::Object::HAVE_SENSITIVE_DETECTOR;
-      }
-      if ( seg.isValid() )  {
-        seg->sensitive = sd;
-        seg->detector  = det;
-      }
+    description.declareParent(name, parent);
+  }
+  xml_attr_t attr_ro  = element.attr_nothrow(_U(readout));
+  if ( attr_ro )   {
+    Readout ro = description.readout(element.attr<string>(attr_ro));
+    if (!ro.isValid()) {
+      throw runtime_error("No Readout structure present for detector:" + name);
     }
-    printout(det.isValid() ? INFO : ERROR, "Compact", "%s subdetector:%s of type %s %s",
-             (det.isValid() ? "++ Converted" : "FAILED    "), name.c_str(), type.c_str(),
-             (sd.isValid() ? ("[" + sd.type() + "]").c_str() : ""));
+    item.seg = ro.segmentation();
+    item.sd = SensitiveDetector(name, "sensitive");
+    item.sd.setHitsCollection(ro.name());
+    item.sd.setReadout(ro);
+    description.addSensitiveDetector(item.sd);
+  }
+  item.element = element;
+  return true;
+}
 
-    if (!det.isValid())  {
-      PluginDebug dbg;
-      PluginService::Create<NamedObject*>(type, &description, &element, &sens);
-      throw runtime_error("Failed to execute subdetector creation plugin. " + dbg.missingFactory(type));
+/// Execute the subdetector factory
+void DetectorBuilder::build(DetectorBuild& item)  const  {
+  auto   begin = clock_type::now();
+  Ref_t  sens  = item.sd;
+  NamedObject* obj = nullptr;
+  if ( item.concurrent )   {
+    Volume::recordPlacements(description.worldVolume(), &item.placements);
+  }
+  try  {
+    obj = PluginService::Create<NamedObject*>(item.type, &description, &item.element, &sens);
+  }
+  catch(...)  {
+    Volume::recordPlacements(Volume(), nullptr);
+    throw;
+  }
+  Volume::recordPlacements(Volume(), nullptr);
+  DetElement det(obj);
+  if (det.isValid()) {
+    setChildTitles(make_pair(item.name, det));
+    if ( item.sd.isValid() )  {
+      det->flag |= DetElement::Object::HAVE_SENSITIVE_DETECTOR;
     }
-    description.addDetector(det);
+    if ( item.seg.isValid() )  {
+      item.seg->sensitive = item.sd;
+      item.seg->detector  = det;
+    }
+  }
+  item.det = det;
+  item.seconds = chrono::duration<double>(clock_type::now() - begin).count();
+}
+
+/// Register the subdetector with the detector description
+void DetectorBuilder::publish(DetectorBuild& item)  const  {
+  const string&     name = item.name;
+  const string&     type = item.type;
+  SensitiveDetector sd   = item.sd;
+  DetElement        det  = item.det;
+  if ( item.error )  {
+    rethrow_exception(item.error);
+  }
+  printout(det.isValid() ? INFO : ERROR, "Compact", "%s subdetector:%s of type %s %s",
+           (det.isValid() ? "++ Converted" : "FAILED    "), name.c_str(), type.c_str(),
+           (sd.isValid() ? ("[" + sd.type() + "]").c_str() : ""));
+
+  if (!det.isValid())  {
+    PluginDebug dbg;
+    Ref_t sens = sd;
+    PluginService::Create<NamedObject*>(type, &description, &item.element, &sens);
+    throw runtime_error("Failed to execute subdetector creation plugin. " + dbg.missingFactory(type));
+  }
+  // Place concurrently built subdetectors into the world volume in document order
+  if ( !item.placements.empty() )   {
+    TObjArray* nodes = description.worldVolume()->GetNodes();
+    for( PlacedVolume pv : item.placements )
+      nodes->Remove(pv.ptr());
+    nodes->Compress();
+    for( PlacedVolume pv : item.placements )
+      nodes->Add(pv.ptr());
+  }
+  description.addDetector(det);
 #if ROOT_VERSION_CODE >= ROOT_VERSION(6,17,0)
-    description.surfaceManager().registerSurfaces(det);
+  description.surfaceManager().registerSurfaces(det);
 #endif
+}
+
+/// Convert one subdetector. Thread-safe factories may be deferred
+void DetectorBuilder::convert(xml_h element)  {
+  auto   item = make_unique<DetectorBuild>();
+  string name  = element.attr<string>(_U(name));
+  try {
+    item->type = element.attr<string>(_U(type));
+    item->name = name;
+    if ( num_threads > 1 && !element.hasAttr(_U(parent)) && !element.hasChild(_U(parent)) )  {
+      // Load the factory library here: it declares if the factory is thread-safe
+      PluginService::getCreator(item->type, typeid(NamedObject*(Detector*,xml_h*,Ref_t*)));
+      item->concurrent = is_thread_safe_factory(item->type);
+    }
+    // Nested and not thread-safe subdetectors need all previous subdetectors registered
+    if ( !item->concurrent )   {
+      flush();
+    }
+    if ( !prepare(element, *item) )   {
+      return;
+    }
+    if ( item->concurrent )   {
+      pending.emplace_back(move(item));
+      return;
+    }
+    this->build(*item);
+    publish(*item);
+    done.emplace_back(move(item));
     return;
   }
   catch (const exception& e)  {
@@ -1314,6 +1560,81 @@ template <> void Converter<DetElement>::operator()(xml_h element) const {
   }
 }
 
+/// Keep an included document alive while subdetectors are pending
+void DetectorBuilder::adopt(xml::DocumentHolder& doc)   {
+  if ( !pending.empty() && doc.m_doc )   {
+    documents.emplace_back(make_unique<xml::DocumentHolder>(doc.m_doc));
+    doc.m_doc = 0;
+  }
+}
+
+/// Execute all pending factories concurrently and register the results
+void DetectorBuilder::flush()   {
+  if ( pending.empty() )   {
+    return;
+  }
+  atomic<size_t> next(0);
+  auto worker = [this, &next]()  {
+    for( size_t i = next++; i < pending.size(); i = next++ )   {
+      try  {
+        this->build(*pending[i]);
+      }
+      catch(...)  {
+        pending[i]->error = current_exception();
+      }
+    }
+  };
+  vector<thread> threads;
+  for( size_t i = 1; i < min(num_threads, pending.size()); ++i )
+    threads.emplace_back(worker);
+  worker();
+  for( auto& t : threads ) t.join();
+
+  // Registration is sequential and in document order
+  for( auto& item : pending )   {
+    try  {
+      publish(*item);
+    }
+    catch (const exception& e)  {
+      printout(ERROR, "Compact", "++ FAILED    to convert subdetector: %s: %s", item->name.c_str(), e.what());
+      terminate();
+    }
+    catch (...)  {
+      printout(ERROR, "Compact", "++ FAILED    to convert subdetector: %s: %s", item->name.c_str(), "UNKNONW Exception");
+      terminate();
+    }
+    done.emplace_back(move(item));
+  }
+  pending.clear();
+  documents.clear();
+}
+
+/// Print the construction time of all subdetectors
+void DetectorBuilder::report()  const  {
+  double total = 0e0;
+  double elapsed = chrono::duration<double>(clock_type::now() - start).count();
+  if ( !timing || done.empty() )   {
+    return;
+  }
+  printout(ALWAYS, "Compact", "+++ Subdetector construction times:");
+  for( const auto& item : done )   {
+    printout(ALWAYS, "Compact", "+++   %-32s %-40s %9.3f sec %s",
+             item->name.c_str(), item->type.c_str(), item->seconds,
+             item->concurrent ? "[concurrent]" : "");
+    total += item->seconds;
+  }
+  printout(ALWAYS, "Compact", "+++ Built %ld subdetectors with %ld threads in %.3f sec [Sum of factories: %.3f sec]",
+           long(done.size()), long(max(num_threads, size_t(1))), elapsed, total);
+}
+
+template <> void Converter<DetElement>::operator()(xml_h element) const {
+  if ( s_detectorBuilder )   {
+    s_detectorBuilder->convert(element);
+    return;
+  }
+  DetectorBuilder(description).convert(element);
+}
+
 /// Read material entries from a seperate file in one of the include sections of the geometry
 template <> void Converter<IncludeFile>::operator()(xml_h element) const   {
   xml::DocumentHolder doc(xml::DocumentHandler().load(element, element.attr_value(_U(ref))));
@@ -1439,6 +1760,8 @@ template <> void Converter<DetElementInclude>::operator()(xml_h element) const {
       Converter<DetElement>(this->description)(node);
     else if ( tag == "detectors" )
       xml_coll_t(node,_U(detector)).for_each(Converter<DetElement>(this->description));
+    if ( s_detectorBuilder )
+      s_detectorBuilder->adopt(doc);
   }
   else if ( type == "json" )  {
     Converter<JsonFile>(this->description)(element);
@@ -1460,6 +1783,7 @@ template <> void Converter<DetElementInclude>::operator()(xml_h element) const {
 template <> void Converter<Compact>::operator()(xml_h element) const {
   static int num_calls = 0;
   char text[32];
+  ExpressionCacheGuard expression_cache;
 
   ++num_calls;
   xml_elt_t compact(element);
@@ -1468,6 +1792,8 @@ template <> void Converter<Compact>::operator()(xml_h element) const {
   bool close_document = true;
   bool close_geometry = true;
   bool build_reflections = false;
+  bool build_timing = false;
+  int  build_threads = 0;
 
   if (element.hasChild(_U(debug)))
     (Converter<Debug>(description))(xml_h(compact.child(_U(debug))));
@@ -1480,6 +1806,11 @@ template <> void Converter<Compact>::operator()(xml_h element) const {
       close_document = steer.attr<bool>(_U(close));
     if ( steer.hasAttr(_U(reflect)) )
       build_reflections = steer.attr<bool>(_U(reflect));
+    if ( steer.hasAttr(_Unicode(threads)) )
+      build_threads = steer.attr<int>(_Unicode(threads));
+    build_timing = build_threads > 1;
+    if ( steer.hasAttr(_Unicode(timing)) )
+      build_timing = steer.attr<bool>(_Unicode(timing));
     for (xml_coll_t clr(steer, _U(clear)); clr; ++clr) {
       string nam = clr.hasAttr(_U(name)) ? clr.attr<string>(_U(name)) : string();
       if ( nam.substr(0,6) == "elemen" )   {
@@ -1538,6 +1869,7 @@ template <> void Converter<Compact>::operator()(xml_h element) const {
     (Converter<World>(description))(xml_h(compact.child(_U(world))));
 
   if ( open_geometry ) description.init();
+  DetectorBuilderGuard detector_builder(description, size_t(max(build_threads, 0)), build_timing);
   xml_coll_t(compact, _U(limits)).for_each(_U(limitset), Converter<LimitSet>(description));
 
   printout(DEBUG, "Compact", "++ Converting readout  structures...");
@@ -1550,7 +1882,14 @@ template <> void Converter<Compact>::operator()(xml_h element) const {
   xml_coll_t(compact, _U(detectors)).for_each(_U(detector), Converter<DetElement>(description));
   xml_coll_t(compact, _U(include)).for_each(Converter<DetElementInclude>(this->description));
 
+  // The following sections may access the subdetectors: finish pending constructions.
+  // Nested compact files must flush as well: their document is released on return.
+  s_detectorBuilder->flush();
   xml_coll_t(compact, _U(includes)).for_each(_U(xml), Converter<XMLFile>(description));
+  s_detectorBuilder->flush();
+  if ( detector_builder.builder )  {
+    s_detectorBuilder->report();
+  }
   xml_coll_t(compact, _U(fields)).for_each(_U(field), Converter<CartesianField>(description));
   xml_coll_t(compact, _U(sensitive_detectors)).for_each(_U(sd), Converter<SensitiveDetector>(description));
   xml_coll_t(compact, _U(parallelworld_volume)).for_each(Converter<Parallelworld_Volume>(description));
@@ -15,6 +15,16 @@
 #include "DD4hep/FieldTypes.h"
 #include "DD4hep/MatrixHelpers.h"
 #include "DD4hep/DetFactoryHelper.h"
+#include "DD4hep/Printout.h"
+
+// ROOT include files
+#include "TTimeStamp.h"
+
+// C/C++ include files
+#include <cmath>
+#include <random>
+#include <cstring>
+#include <functional>
 
 using namespace dd4hep;
 
@@ -121,3 +131,88 @@ static Handle<NamedObject> convert_multipole(Detector&, xml_h field, Handle<Name
   return object;
 }
 DECLARE_XML_PROCESSOR(MultipoleMagnet_Convert2Detector,convert_multipole)
+
+/// Benchmark the evaluation of a grid field map against a reference field
+/**
+ *  Factory: DD4hep_FieldMapBenchmark
+ *
+ *  Evaluates the field map and the reference field at the same random
+ *  points inside the grid: once point by point like a stepper would do
+ *  and once using the batch interface of the grid map.
+ *
+ *  Arguments:
+ *  -map       <name>   Name of the GridMapField field (type FieldMap)
+ *  -reference <name>   Name of the reference field (optional)
+ *  -points    <num>    Number of evaluated points (default: 1000000)
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ */
+static long field_map_benchmark(Detector& description, int argc, char** argv)  {
+  std::string map_name, ref_name;
+  size_t num_points = 1000000;
+  for(int i = 0; i < argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-map",argv[i],4) && (i+1)<argc )
+      map_name = argv[++i];
+    else if ( 0 == ::strncmp("-reference",argv[i],4) && (i+1)<argc )
+      ref_name = argv[++i];
+    else if ( 0 == ::strncmp("-points",argv[i],4) && (i+1)<argc )
+      num_points = ::atol(argv[++i]);
+  }
+  CartesianField map_field = description.field(map_name);
+  GridMapField*  grid = map_field.isValid() ? dynamic_cast<GridMapField*>(map_field.ptr()) : nullptr;
+  if ( !grid )  {
+    except("FieldMapBenchmark","+++ Field '%s' is no valid field map [type FieldMap].",map_name.c_str());
+  }
+  CartesianField ref_field;
+  if ( !ref_name.empty() )  {
+    ref_field = description.field(ref_name);
+    if ( !ref_field.isValid() )
+      except("FieldMapBenchmark","+++ Unknown reference field '%s'.",ref_name.c_str());
+  }
+  std::mt19937 engine(4711);
+  std::uniform_real_distribution<double> flat(0e0, 1e0);
+  std::vector<double> pos(3*num_points), ref(3*num_points, 0e0), map(3*num_points, 0e0), batch(3*num_points, 0e0);
+  for(size_t i = 0; i < num_points; ++i)  {
+    double* p = &pos[3*i];
+    if ( grid->coordinates == GridMapField::CYLINDRICAL )  {
+      double r   = grid->lower[0] + flat(engine)*grid->step[0]*(grid->num[0]-1);
+      double phi = 2e0*M_PI*flat(engine);
+      p[0] = r*std::cos(phi);
+      p[1] = r*std::sin(phi);
+    }
+    else  {
+      p[0] = grid->lower[0] + flat(engine)*grid->step[0]*(grid->num[0]-1);
+      p[1] = grid->lower[1] + flat(engine)*grid->step[1]*(grid->num[1]-1);
+    }
+    p[2] = grid->lower[2] + flat(engine)*grid->step[2]*(grid->num[2]-1);
+  }
+  auto time_it = [](const std::function<void()>& call)  {
+    TTimeStamp start;
+    call();
+    TTimeStamp stop;
+    return stop.AsDouble()-start.AsDouble();
+  };
+  double t_map = time_it([&]()  {
+      for(size_t i = 0; i < num_points; ++i) map_field.value(&pos[3*i], &map[3*i]);
+    });
+  double t_batch = time_it([&]()  {  grid->fieldComponents(num_points, pos.data(), batch.data());  });
+  printout(ALWAYS,"FieldMapBenchmark","+++ %-24s %10ld points in %8.3f seconds: %8.1f nsec/point",
+           "Field map (single):", num_points, t_map, 1e9*t_map/double(num_points));
+  printout(ALWAYS,"FieldMapBenchmark","+++ %-24s %10ld points in %8.3f seconds: %8.1f nsec/point",
+           "Field map (batch):", num_points, t_batch, 1e9*t_batch/double(num_points));
+  if ( ref_field.isValid() )  {
+    double max_dev = 0e0;
+    double t_ref = time_it([&]()  {
+        for(size_t i = 0; i < num_points; ++i) ref_field.value(&pos[3*i], &ref[3*i]);
+      });
+    for(size_t i = 0; i < 3*num_points; ++i)
+      max_dev = std::max(max_dev, std::fabs(ref[i]-map[i]));
+    printout(ALWAYS,"FieldMapBenchmark","+++ %-24s %10ld points in %8.3f seconds: %8.1f nsec/point",
+             "Reference field:", num_points, t_ref, 1e9*t_ref/double(num_points));
+    printout(ALWAYS,"FieldMapBenchmark","+++ Maximal deviation map - reference: %g tesla",
+             max_dev/dd4hep::tesla);
+  }
+  return 1;
+}
+DECLARE_APPLY(DD4hep_FieldMapBenchmark,field_map_benchmark)
@@ -768,16 +768,25 @@ DECLARE_APPLY(DD4hep_XMLProcessor,process_xml_doc)
 /**
  *  Factory: DD4hep_VolumeManager
  *
+ *  Optional arguments:
+ *  -flat   Compile the populated volume manager into a flat lookup index
+ *          (see VolumeManager::freeze)
+ *
  *  \author  M.Frank
  *  \version 1.0
  *  \date    01/04/2014
  */
-static long load_volmgr(Detector& description, int, char**) {
+static long load_volmgr(Detector& description, int argc, char** argv) {
   printout(INFO,"DD4hepVolumeManager","**** running plugin DD4hepVolumeManager ! " );
   try {
     DetectorImp* imp = dynamic_cast<DetectorImp*>(&description);
     if ( imp )  {
-      imp->imp_loadVolumeManager();
+      int flags = VolumeManager::TREE;
+      for(int i = 0; i < argc && argv[i]; ++i)  {
+        if ( 0 == ::strncmp("-flat",argv[i],5) )
+          flags |= VolumeManager::FLAT;
+      }
+      imp->imp_loadVolumeManager(flags);
       printout(INFO,"VolumeManager","+++ Volume manager populated and loaded.");
       return 1;
     }
@@ -22,7 +22,12 @@
 #include "DD4hep/AlignmentsNominalMap.h"
 #include "DD4hep/detail/VolumeManagerInterna.h"
 
+// ROOT include files
+#include "TTimeStamp.h"
+
 // C/C++ include files
+#include <random>
+#include <cstring>
 #include <stdexcept>
 #include <algorithm>
 
@@ -323,3 +328,80 @@ long VolIDTest::run(Detector& description,int argc,char** argv)    {
 }
 
 DECLARE_APPLY(DD4hep_VolumeMgrTest,VolIDTest::run)
+
+namespace  {
+  /** @class VolumeMgrBenchmark
+   *
+   *  Compare the lookup speed of the std::map based volume manager
+   *  with the flat lookup index created by VolumeManager::freeze().
+   *  All registered volume identifiers are looked up in random order.
+   *
+   *  Arguments:  -turns <number>   Number of passes over all identifiers (default: 10)
+   *
+   *  @author  M.Frank
+   *  @version 1.0
+   */
+  struct VolumeMgrBenchmark  {
+    /// Action routine to execute the benchmark
+    static long run(Detector& description,int argc,char** argv);
+  };
+}
+
+/// Action routine to execute the benchmark
+long VolumeMgrBenchmark::run(Detector& description,int argc,char** argv)    {
+  size_t turns = 10;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-turns",argv[i],4) && (i+1)<argc )
+      turns = ::atol(argv[++i]);
+  }
+  VolumeManager mgr = VolumeManager::getVolumeManager(description);
+  VolumeManager::Object& obj = *mgr.data<VolumeManager::Object>();
+  vector<VolumeID> ids;
+  for( const auto& v : obj.volumes )
+    ids.emplace_back(v.first);
+  for( const auto& s : obj.subdetectors )  {
+    for( const auto& v : s.second->volumes )
+      ids.emplace_back(v.first);
+  }
+  if ( ids.empty() )  {
+    except("VolumeMgrBenchmark","++ The volume manager has no registered placements.");
+  }
+  shuffle(ids.begin(), ids.end(), mt19937(12345));
+
+  /// Run a number of lookup passes and return the elapsed time
+  auto time_lookups = [&ids, &mgr, turns](vector<VolumeManagerContext*>& result)  {
+    TTimeStamp start;
+    for( size_t t=0; t<turns; ++t )  {
+      for( size_t i=0; i<ids.size(); ++i )
+        result[i] = mgr.lookupContext(ids[i]);
+    }
+    TTimeStamp stop;
+    return stop.AsDouble()-start.AsDouble();
+  };
+  vector<VolumeManagerContext*> map_result(ids.size()), flat_result(ids.size());
+  vector<VolumeManagerFlatSection> saved_index;
+  saved_index.swap(obj.flat);
+
+  double map_time = time_lookups(map_result);
+  TTimeStamp start;
+  size_t num_indexed = mgr.freeze();
+  TTimeStamp stop;
+  double flat_time = time_lookups(flat_result);
+  size_t num_lookups = turns*ids.size();
+  size_t num_errors  = 0;
+  for( size_t i=0; i<ids.size(); ++i )
+    num_errors += (map_result[i] != flat_result[i]) ? 1 : 0;
+
+  printout(ALWAYS,"VolumeMgrBenchmark","+++ Flat index: %ld entries in %ld sections built in %8.3f seconds.",
+           num_indexed, obj.flat.size(), stop.AsDouble()-start.AsDouble());
+  printout(ALWAYS,"VolumeMgrBenchmark","+++ %-12s %10ld lookups in %8.3f seconds: %8.1f nsec/lookup",
+           "std::map:", num_lookups, map_time, 1e9*map_time/double(num_lookups));
+  printout(ALWAYS,"VolumeMgrBenchmark","+++ %-12s %10ld lookups in %8.3f seconds: %8.1f nsec/lookup",
+           "flat index:", num_lookups, flat_time, 1e9*flat_time/double(num_lookups));
+  if ( saved_index.empty() ) obj.flat.clear();
+  printout(ALWAYS,"VolumeMgrBenchmark","+++ %s: Checked %ld identifiers. Num.Errors:%ld",
+           num_errors == 0 ? "PASSED" : "FAILED", ids.size(), num_errors);
+  return 1;
+}
+
+DECLARE_APPLY(DD4hep_VolumeMgrBenchmark,VolumeMgrBenchmark::run)
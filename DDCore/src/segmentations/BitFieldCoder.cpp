@@ -71,6 +71,87 @@ namespace dd4hep{
 
 
 
+    void BitFieldKernel::throwOutOfRange(const std::string& name, long64 in, unsigned width) {
+      std::stringstream s ;
+      s << " BitFieldElement '" << name << "': out of range : " << in 
+        << " for width " << width  ; 
+      throw( std::runtime_error( s.str() ) );
+    }
+
+
+
+    void BitFieldCoder::decode(const long64* bitfields, size_t count, long64* const* columns) const {
+
+      for(unsigned i=0;i<_fields.size();i++){
+
+        const BitFieldElement& f = _fields[i] ;
+        ulong64 lowMask = f.mask() >> f.offset() ;
+
+        if( f.isSigned() )
+          BitFieldKernel::decodeSigned( bitfields, count, columns[i], f.offset(), lowMask, 1ULL << ( f.width() - 1 ) ) ;
+        else
+          BitFieldKernel::decode( bitfields, count, columns[i], f.offset(), lowMask ) ;
+      }
+    }
+
+    void BitFieldCoder::decode(const std::vector<long64>& bitfields, std::vector<std::vector<long64> >& columns) const {
+
+      std::vector<long64*> cols( _fields.size() ) ;
+      columns.resize( _fields.size() ) ;
+
+      for(unsigned i=0;i<_fields.size();i++){
+        columns[i].resize( bitfields.size() ) ;
+        cols[i] = columns[i].data() ;
+      }
+      decode( bitfields.data(), bitfields.size(), cols.data() ) ;
+    }
+
+    void BitFieldCoder::encode(long64* bitfields, size_t count, const long64* const* columns) const {
+
+      // check all ranges first: the bit fields are untouched on failure
+      for(unsigned i=0;i<_fields.size();i++){
+
+        const BitFieldElement& f = _fields[i] ;
+        size_t bad = BitFieldKernel::outOfRange( columns[i], count, f.minValue(), f.maxValue() ) ;
+
+        if( bad != count )
+          BitFieldKernel::throwOutOfRange( f.name(), columns[i][bad], f.width() ) ;
+      }
+
+      std::fill( bitfields, bitfields+count, 0 ) ;
+
+      for(unsigned i=0;i<_fields.size();i++)
+        BitFieldKernel::encode( bitfields, count, columns[i], _fields[i].offset(), _fields[i].mask() ) ;
+    }
+
+    void BitFieldCoder::encode(const std::vector<std::vector<long64> >& columns, std::vector<long64>& bitfields) const {
+
+      if( columns.size() != _fields.size() ) {
+        std::stringstream s ;
+        s << " BitFieldCoder::encode: got " << columns.size() << " columns for " 
+          << _fields.size() << " fields" ;
+        throw( std::runtime_error( s.str() ) ) ;
+      }
+
+      std::vector<const long64*> cols( _fields.size() ) ;
+      size_t count = columns.empty() ? 0 : columns[0].size() ;
+
+      for(unsigned i=0;i<_fields.size();i++){
+
+        if( columns[i].size() != count ) {
+          std::stringstream s ;
+          s << " BitFieldCoder::encode: column '" << _fields[i].name() << "' has " 
+            << columns[i].size() << " values. Expected: " << count ;
+          throw( std::runtime_error( s.str() ) ) ;
+        }
+        cols[i] = columns[i].data() ;
+      }
+      bitfields.resize( count ) ;
+      encode( bitfields.data(), count, cols.data() ) ;
+    }
+
+
+
     size_t BitFieldCoder::index( const std::string& name) const {
     
       IndexMap::const_iterator it = _map.find( name ) ;
@@ -100,5 +100,5 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
   return sdet;
 }
 
-DECLARE_DETELEMENT(DD4hep_CylindricalEndcapCalorimeter,create_detector)
+DECLARE_THREADSAFE_DETELEMENT(DD4hep_CylindricalEndcapCalorimeter,create_detector)
 DECLARE_DEPRECATED_DETELEMENT(CylindricalEndcapCalorimeter,create_detector)
@@ -0,0 +1,202 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "DD4hep/InstanceCount.h"
+#include "DDDigi/DigiROOTInput.h"
+#include "DDDigi/DigiContext.h"
+#include "DDDigi/DigiFactories.h"
+#include "DDG4/Geant4Data.h"
+
+// ROOT include files
+#include "TClass.h"
+
+// C/C++ include files
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::digi;
+
+typedef sim::Geant4Tracker::Hit     TrackerHit;
+typedef sim::Geant4Calorimeter::Hit CaloHit;
+
+namespace {
+  template <typename T> const T* hit(const void* ptr)  {
+    return (const T*)ptr;
+  }
+  /// Time of a calorimeter hit: earliest contribution
+  double caloTime(const CaloHit* h)  {
+    if ( h->truth.empty() ) return 0e0;
+    double t = h->truth.front().time;
+    for( const auto& c : h->truth ) t = min(t, c.time);
+    return t;
+  }
+  const TrackerDeposit::FunctionTable* trackerTable()  {
+    static TrackerDeposit::FunctionTable table = []  {
+      TrackerDeposit::FunctionTable t;
+      t.cellID   = [](const void* p) { return hit<TrackerHit>(p)->cellID;         };
+      t.flag     = [](const void* p) { return hit<TrackerHit>(p)->flag;           };
+      t.position = [](const void* p) -> const Position&  { return hit<TrackerHit>(p)->position; };
+      t.momentum = [](const void* p) -> const Direction& { return hit<TrackerHit>(p)->momentum; };
+      t.deposit  = [](const void* p) { return hit<TrackerHit>(p)->energyDeposit;  };
+      t.length   = [](const void* p) { return hit<TrackerHit>(p)->length;         };
+      t.time     = [](const void* p) { return hit<TrackerHit>(p)->truth.time;     };
+      return t;
+    }();
+    return &table;
+  }
+  const CaloDeposit::FunctionTable* caloTable()  {
+    static CaloDeposit::FunctionTable table = []  {
+      CaloDeposit::FunctionTable t;
+      t.cellID   = [](const void* p) { return hit<CaloHit>(p)->cellID;            };
+      t.flag     = [](const void* p) { return hit<CaloHit>(p)->flag;              };
+      t.position = [](const void* p) -> const Position&  { return hit<CaloHit>(p)->position; };
+      t.deposit  = [](const void* p) { return hit<CaloHit>(p)->energyDeposit;     };
+      t.time     = [](const void* p) { return caloTime(hit<CaloHit>(p));          };
+      return t;
+    }();
+    return &table;
+  }
+}
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Function table of DDG4 tracker hits
+    template <> const EnergyDeposit::FunctionTable*
+    EnergyDeposit::vtable<EnergyDeposit::FunctionTable, TrackerHit>()  {
+      return trackerTable();
+    }
+    /// Function table of DDG4 tracker hits
+    template <> const TrackerDeposit::FunctionTable*
+    EnergyDeposit::vtable<TrackerDeposit::FunctionTable, TrackerHit>()  {
+      return trackerTable();
+    }
+    /// Function table of DDG4 calorimeter hits
+    template <> const EnergyDeposit::FunctionTable*
+    EnergyDeposit::vtable<EnergyDeposit::FunctionTable, CaloHit>()  {
+      return caloTable();
+    }
+    /// Function table of DDG4 calorimeter hits
+    template <> const CaloDeposit::FunctionTable*
+    EnergyDeposit::vtable<CaloDeposit::FunctionTable, CaloHit>()  {
+      return caloTable();
+    }
+
+    /// Energy deposit container owning the DDG4 hits read from file
+    /**
+     *  The deposit wrappers are kept in one contiguous block allocated
+     *  once per container. Hence the conversion does not allocate per hit.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    template <typename HIT, typename DEPOSIT> class DDG4Deposits : public DigiEnergyDeposits  {
+    public:
+      /// Hits read from file
+      unique_ptr<vector<HIT*> > hits;
+      /// Deposit wrappers of the hits
+      vector<DEPOSIT>           deposits;
+    public:
+      /// Initializing constructor
+      DDG4Deposits(const string& nam, vector<HIT*>* h) : DigiEnergyDeposits(nam), hits(h)  {
+        deposits.reserve(hits->size());
+        this->reserve(hits->size());
+        for( const HIT* p : *hits )   {
+          deposits.emplace_back(p);
+          this->push_back(&deposits.back());
+        }
+      }
+      /// Inhibit copy constructor
+      DDG4Deposits(const DDG4Deposits& copy) = delete;
+      /// Default destructor
+      virtual ~DDG4Deposits()  {
+        for( HIT* p : *hits ) delete p;
+      }
+    };
+
+    /// Input action to read DDG4 simulation output written by Geant4Output2ROOT
+    /**
+     *  Tracker and calorimeter hit collections are converted to TrackerDeposit
+     *  and CaloDeposit objects. They are stored in event data slots of type
+     *  DigiEnergyDeposits with the key (Mask, collection name).
+     *  All other branches are handled by the base class.
+     *
+     *  Note: positions and energies are in the Geant4 units used by DDG4.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiDDG4Input : public DigiROOTInput  {
+    protected:
+      /// Dictionary of the tracker hit collections
+      TClass* m_tracker_hits = 0;
+      /// Dictionary of the calorimeter hit collections
+      TClass* m_calo_hits    = 0;
+
+    protected:
+      /// Define standard assignments and constructors
+      DDDIGI_DEFINE_ACTION_CONSTRUCTORS(DigiDDG4Input);
+
+      /// Store the deposits of one hit collection in the event
+      template <typename HIT, typename DEPOSIT>
+      void store(DigiContext& context, container_t& cont)  const   {
+        vector<HIT*>* hits = (vector<HIT*>*)cont.object;
+        shared_ptr<DigiEnergyDeposits> deposits(new DDG4Deposits<HIT, DEPOSIT>(cont.name, hits));
+        cont.object = 0;
+        debug("+++ %-24s %6ld deposits", cont.name.c_str(), deposits->size());
+        context.event().put(DigiSlot<DigiEnergyDeposits>(cont.slot), move(deposits));
+      }
+
+      /// Hit collections are stored as energy deposits
+      virtual const type_info& containerType(TClass* clazz)  const override  {
+        if ( clazz == m_tracker_hits || clazz == m_calo_hits )
+          return typeid(DigiEnergyDeposits);
+        return this->DigiROOTInput::containerType(clazz);
+      }
+
+      /// Convert and store the data of one branch. Takes ownership of the object.
+      virtual void convert(DigiContext& context, container_t& cont)  const override  {
+        if ( cont.clazz == m_tracker_hits )
+          store<TrackerHit, TrackerDeposit>(context, cont);
+        else if ( cont.clazz == m_calo_hits )
+          store<CaloHit, CaloDeposit>(context, cont);
+        else
+          this->DigiROOTInput::convert(context, cont);
+      }
+
+    public:
+      /// Standard constructor
+      DigiDDG4Input(const DigiKernel& kernel, const string& nam)
+        : DigiROOTInput(kernel, nam)
+      {
+        m_tracker_hits = TClass::GetClass(typeid(vector<TrackerHit*>));
+        m_calo_hits    = TClass::GetClass(typeid(vector<CaloHit*>));
+        InstanceCount::increment(this);
+      }
+      /// Default destructor
+      virtual ~DigiDDG4Input()   {
+        InstanceCount::decrement(this);
+      }
+    };
+  }    // End namespace digi
+}      // End namespace dd4hep
+
+DECLARE_DIGIEVENTACTION_NS(dd4hep::digi,DigiDDG4Input)
@@ -25,6 +25,7 @@
 #include <stdexcept>
 #include <cstdint>
 #include <memory>
+#include <vector>
 #include <map>
 
 /// Namespace for the AIDA detector description toolkit
@@ -75,8 +76,11 @@ namespace dd4hep {
       class FunctionTable   {
         friend class EnergyDeposit;
       public:
-        std::function<long long int(const void*)> cellID;
-        std::function<long(const void*)>          flag;
+        std::function<long long int(const void*)>    cellID;
+        std::function<long(const void*)>             flag;
+        std::function<const Position& (const void*)> position;
+        std::function<double(const void*)>           deposit;
+        std::function<double(const void*)>           time;
         FunctionTable() = default;
         ~FunctionTable() = default;
       };
@@ -99,8 +103,11 @@ namespace dd4hep {
       /// Disable copy assignment
       EnergyDeposit& operator=(const EnergyDeposit& copy) = default;      
 
-      long long int cellID()  const    {   return object.second->cellID(object.first);     }
-      long          flag()  const      {   return object.second->flag(object.first);       }
+      long long int   cellID()  const    {   return object.second->cellID(object.first);     }
+      long            flag()  const      {   return object.second->flag(object.first);       }
+      const Position& position()  const  {   return object.second->position(object.first);   }
+      double          deposit()  const   {   return object.second->deposit(object.first);    }
+      double          time()  const      {   return object.second->time(object.first);       }
     };
 
     template <typename T> inline EnergyDeposit::EnergyDeposit(const T* ptr)
@@ -121,9 +128,7 @@ namespace dd4hep {
         friend class TrackerDeposit;
         friend class EnergyDeposit;
       public:
-        std::function<const Position& (const void*)>  position;
         std::function<const Direction& (const void*)> momentum;
-        std::function<double(const void*)>            deposit;
         std::function<double(const void*)>            length;
         FunctionTable() = default;
         ~FunctionTable() = default;
@@ -153,7 +158,7 @@ namespace dd4hep {
     };
 
     template <typename T> inline TrackerDeposit::TrackerDeposit(const T* ptr)
-      : object(ptr, vtable<TrackerDeposit::FunctionTable,T>())
+      : EnergyDeposit(ptr), object(ptr, vtable<TrackerDeposit::FunctionTable,T>())
     {
     }
 
@@ -170,8 +175,6 @@ namespace dd4hep {
         friend class CaloDeposit;
         friend class EnergyDeposit;
       public:
-        std::function<const Position& (const void*)>  position;
-        std::function<double(const void*)>            deposit;
         FunctionTable() = default;
         ~FunctionTable() = default;
       };
@@ -198,7 +201,7 @@ namespace dd4hep {
     };
 
     template <typename T> inline CaloDeposit::CaloDeposit(const T* ptr)
-      : object(ptr, vtable<CaloDeposit::FunctionTable,T>())
+      : EnergyDeposit(ptr), object(ptr, vtable<CaloDeposit::FunctionTable,T>())
     {
     }
     
@@ -228,6 +231,59 @@ namespace dd4hep {
     typedef DigiContainer<EnergyDeposit*> DigiEnergyDeposits;
     typedef DigiContainer<DigiCount*>     DigiCounts;
 
+    /// Energy deposit of one cell merged from several deposits
+    /*
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiCellDeposit   {
+    public:
+      /// Cell identifier
+      long long int cellID  = 0;
+      /// Or-ed flags of the merged deposits
+      long          flag    = 0;
+      /// Position of the first merged deposit
+      Position      position;
+      /// Total energy deposit
+      double        deposit = 0e0;
+      /// Earliest time of the merged deposits
+      double        time    = 0e0;
+      /// Number of merged deposits
+      int           contributions = 0;
+    };
+    template <> const EnergyDeposit::FunctionTable*
+    EnergyDeposit::vtable<EnergyDeposit::FunctionTable, DigiCellDeposit>();
+    template <> const CaloDeposit::FunctionTable*
+    EnergyDeposit::vtable<CaloDeposit::FunctionTable, DigiCellDeposit>();
+
+    /// Container of merged cell deposits
+    /*
+     *  The cells are filled first. publish() then creates the deposit
+     *  wrappers in one block and makes them visible in the container.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiCellDeposits : public DigiEnergyDeposits   {
+    public:
+      /// Merged cell deposits
+      std::vector<DigiCellDeposit> cells;
+      /// Deposit wrappers of the cells
+      std::vector<CaloDeposit>     deposits;
+    public:
+      /// Initializing constructor
+      DigiCellDeposits(const std::string& nam) : DigiEnergyDeposits(nam) {}
+      /// Inhibit copy constructor
+      DigiCellDeposits(const DigiCellDeposits& copy) = delete;
+      /// Default destructor
+      virtual ~DigiCellDeposits() = default;
+      /// Create the deposit wrappers of all cells
+      void publish();
+    };
+
     ///  Key defintion to access the event data
     /**
      *  Helper to convert item and mask to a 64 bit integer
@@ -254,21 +310,31 @@ namespace dd4hep {
       key_type toLong()  const  {  return key; }
       void set(const std::string& name, int mask);
     };
-  }    // End namespace digi
-}      // End namespace dd4hep
-    
 
-/// <any> is not properly processed by cling.
-/// We need to exclude any reference to it.
-#if !defined(DD4HEP_INTERPRETER_MODE)
-#include "DD4hep/Any.h"
-#endif
-
-/// Namespace for the AIDA detector description toolkit
-namespace dd4hep {
-
-  /// Namespace for the Digitization part of the AIDA detector description toolkit
-  namespace digi {
+    ///  Typed handle to an event data slot
+    /**
+     *  Slots are obtained from the slot registry of the kernel at
+     *  configuration time (see DigiEventAction::declareInput/declareOutput).
+     *  The slot index addresses the data store of the event directly.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    template <typename T> class DigiSlot   {
+    public:
+      /// Type of the data item
+      typedef T value_type;
+      /// Slot index in the event data store
+      int index = -1;
+    public:
+      /// Default constructor
+      DigiSlot() = default;
+      /// Initializing constructor
+      explicit DigiSlot(int idx) : index(idx) {}
+      /// Check if the slot is registered
+      bool isValid()  const  {  return index >= 0; }
+    };
 
     ///  User event data for DDDigi
     /**
@@ -281,15 +347,10 @@ namespace dd4hep {
     public:
       /// Forward definition of the key type
       typedef Key::key_type key_type;
-      std::map<unsigned long, std::shared_ptr<DigiEnergyDeposits> >  energyDeposits;
-      std::map<unsigned long, std::shared_ptr<DigiCounts> >          digitizations;
 
       int eventNumber = 0;
-#if defined(DD4HEP_INTERPRETER_MODE)
-      std::map<key_type, long>  data;
-#else
-      std::map<key_type, dd4hep::any>  data;
-#endif
+      /// Slot based event data store. One entry for each slot registered to the kernel
+      std::vector<std::shared_ptr<void> > slots;
     public:
 #if defined(DD4HEP_INTERPRETER_MODE) || defined(G__ROOT)
       /// Inhibit default constructor
@@ -301,42 +362,47 @@ namespace dd4hep {
       DigiEvent(const DigiEvent& copy) = delete;
       /// Intializing constructor
       DigiEvent(int num);
+      /// Intializing constructor with the number of registered data slots
+      DigiEvent(int num, std::size_t num_slots);
       /// Default destructor
       virtual ~DigiEvent();
 
-#if !defined(DD4HEP_INTERPRETER_MODE)
-      /// Add item by key to the data 
-      template<typename T> bool put(const Key& key, T&& object)     {
-        bool ret = data.emplace(key.toLong(),make_any<T>(object)).second;
-        if ( ret ) return ret;
-        except("DigiEvent","Invalid requested to store data in event container. Key:%ld",key.toLong());
+      /// Access slot data with range check
+      std::shared_ptr<void>& slotData(int slot);
+      /// Access slot data with range check
+      const std::shared_ptr<void>& slotData(int slot)  const;
+
+      /// Add item to the slot based data store. Each slot may only be written once.
+      /**
+       *  Different slots may be filled concurrently without locking.
+       */
+      template<typename T> T& put(const DigiSlot<T>& slot, std::shared_ptr<T> object)   {
+        std::shared_ptr<void>& entry = slotData(slot.index);
+        if ( !entry && object )   {
+          entry = std::move(object);
+          return *static_cast<T*>(entry.get());
+        }
+        except("DigiEvent","Invalid request to store data in event slot %d [%s].",
+               slot.index, object ? "slot already filled" : "invalid object");
         throw std::runtime_error("DigiEvent"); // Will never get here!
       }
 
-      /// Retrieve item by key from the event data container
-      template<typename T> T& get(const Key& key)     {
-        auto iter = data.find(key.toLong());
-        if ( iter != data.end() )  {
-          T* ptr = dd4hep::any_cast<T>(&(*iter).second);
-          if ( ptr ) return *ptr;
-          except("DigiEvent","Invalid data requested from event container [cast failed]. Key:%ld",key.toLong());
-        }
-        except("DigiEvent","Invalid data requested from event container. Key:%ld",key.toLong());
+      /// Retrieve item from the slot based data store
+      template<typename T> T& get(const DigiSlot<T>& slot)   {
+        std::shared_ptr<void>& entry = slotData(slot.index);
+        if ( entry ) return *static_cast<T*>(entry.get());
+        except("DigiEvent","Invalid data requested from event slot %d [slot empty].",slot.index);
         throw std::runtime_error("DigiEvent"); // Will never get here!
       }
 
-      /// Retrieve item by key from the event data container
-      template<typename T> const T& get(const Key& key)  const    {
-        std::map<key_type, dd4hep::any>::const_iterator iter = data.find(key.toLong());
-        if ( iter != data.end() )  {
-          const T* ptr = dd4hep::any_cast<T>(&(*iter).second);
-          if ( ptr ) return *ptr;
-          except("DigiEvent","Invalid data requested from event container [cast failed]. Key:%ld",key.toLong());
-        }
-        except("DigiEvent","Invalid data requested from event container. Key:%ld",key.toLong());
+      /// Retrieve item from the slot based data store
+      template<typename T> const T& get(const DigiSlot<T>& slot)  const   {
+        const std::shared_ptr<void>& entry = slotData(slot.index);
+        if ( entry ) return *static_cast<const T*>(entry.get());
+        except("DigiEvent","Invalid data requested from event slot %d [slot empty].",slot.index);
         throw std::runtime_error("DigiEvent"); // Will never get here!
       }
-#endif
+
       /// Add an extension object to the detector element
       void* addExtension(unsigned long long int k, ExtensionEntry* e)  {
         return ObjectExtensions::addExtension(k, e);
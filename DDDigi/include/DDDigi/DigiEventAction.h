@@ -15,7 +15,12 @@
 
 // Framework include files
 #include "DDDigi/DigiAction.h"
+#include "DDDigi/DigiData.h"
 
+// C/C++ include files
+#include <typeinfo>
+#include <vector>
+#include <set>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -38,6 +43,10 @@ namespace dd4hep {
     protected:
       /// Property: Support parallel execution
       bool               m_parallel    = false;
+      /// Event data slots read by this action
+      std::vector<int>   m_inputs;
+      /// Event data slots written by this action
+      std::vector<int>   m_outputs;
 
     protected:
       /// Define standard assignments and constructors
@@ -46,6 +55,17 @@ namespace dd4hep {
       /// Default destructor
       virtual ~DigiEventAction();
 
+      /// Register an event data slot read or written by this action
+      int declareSlot(const Key& key, const std::string& nam, const std::type_info& typ, bool output);
+      /// Declare an event data item read by this action. Must be called before the kernel is initialized
+      template <typename T> DigiSlot<T> declareInput(const std::string& nam, int mask = 0)   {
+        return DigiSlot<T>(declareSlot(Key(mask, nam), nam, typeid(T), false));
+      }
+      /// Declare an event data item written by this action. Must be called before the kernel is initialized
+      template <typename T> DigiSlot<T> declareOutput(const std::string& nam, int mask = 0)   {
+        return DigiSlot<T>(declareSlot(Key(mask, nam), nam, typeid(T), true));
+      }
+
     public:
       /// Standard constructor
       DigiEventAction(const DigiKernel& kernel, const std::string& nam);
@@ -55,6 +75,10 @@ namespace dd4hep {
       }      
       /// Set the parallization flag; returns previous value
       bool setExecuteParallel(bool new_value);
+      /// Collect the event data slots read and written by this action
+      virtual void dataDependencies(std::set<int>& inputs, std::set<int>& outputs)  const;
+      /// Check the data dependencies of concurrently executing actions. Default: nothing to check
+      virtual void checkDependencies()  const;
       /// Main functional callback
       virtual void execute(DigiContext& context)   const = 0;
     };
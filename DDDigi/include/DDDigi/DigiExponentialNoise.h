@@ -44,6 +44,12 @@ namespace dd4hep {
       virtual ~DigiExponentialNoise();
       /// Callback to read event exponentialnoise
       virtual double operator()(DigiCellContext& context)  const  override;
+      /// Batched callback: compute the noise of n cells with the given signals
+      virtual void process(DigiContext& context, const double* signals, double* noise, std::size_t n)  const  override;
+      /// Probability that the noise of a channel without signal exceeds the threshold
+      virtual double tailProbability(double threshold)  const  override;
+      /// Draw the noise of a channel without signal under the condition that it exceeds the threshold
+      virtual double drawAbove(DigiContext& context, double threshold)  const  override;
     };
   }    // End namespace digi
 }      // End namespace dd4hep
@@ -28,6 +28,7 @@ namespace dd4hep {
 
     /// Forward declarations
     class DigiActionSequence;
+    class DigiSlotRegistry;
     
     /// Class, which allows all DigiAction derivatives to access the DDG4 kernel structures.
     /**
@@ -105,6 +106,10 @@ namespace dd4hep {
       /** Output level settings                       */
       /// Access the output level
       PrintLevel outputLevel() const;
+      /// Access to the maximum number of events processed in parallel
+      int maxEventsParallel() const;
+      /// Access to the number of worker threads
+      int numThreads() const;
       /// Set the global output level of the kernel object; returns previous value
       PrintLevel setOutputLevel(PrintLevel new_level);
       /// Fill cache with the global output level of a named object. Must be set before instantiation
@@ -132,6 +137,8 @@ namespace dd4hep {
       DigiActionSequence& eventAction() const;
       /// Access to the main output action sequence from the kernel object
       DigiActionSequence& outputAction() const;
+      /// Access to the registry of the event data slots
+      DigiSlotRegistry& slotRegistry() const;
       /// Submit a bunch of actions to be executed in parallel
       virtual void submit (const DigiAction::Actors<DigiEventAction>& algorithms, DigiContext& context)  const;
       /// Submit a bunch of actions to be executed serially
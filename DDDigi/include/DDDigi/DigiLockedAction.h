@@ -54,6 +54,10 @@ namespace dd4hep {
       virtual ~DigiLockedAction();
       /// Underlying object to be used during the locked execution
       void use(DigiEventAction* action);
+      /// Initialize the underlying action
+      virtual void initialize()  override;
+      /// Collect the event data slots of the underlying action
+      virtual void dataDependencies(std::set<int>& inputs, std::set<int>& outputs)  const override;
       /// Callback to read event locked
       virtual void execute(DigiContext& context)  const override;
     };
@@ -0,0 +1,141 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_DIGIOVERLAYMIXER_H
+#define DDDIGI_DIGIOVERLAYMIXER_H
+
+/// Framework include files
+#include "DDDigi/DigiSynchronize.h"
+
+/// C/C++ include files
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <map>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    // Forward declarations
+    class DigiOverlayMixer;
+
+    /// Overlay of background events on the signal event of a bunch train
+    /**
+     *  The adopted actions are background sources (e.g. pileup, beam background).
+     *  They are not executed for every event: at the first event each source
+     *  fills a pool of background events, which is afterwards shared read-only
+     *  by all event threads.
+     *
+     *  For every bunch crossing in [FirstBunch, LastBunch] and every source a
+     *  number of events (Poisson distributed with mean Mean[source] or fixed)
+     *  is drawn from the pool and shifted in time by
+     *      bunch * BunchSpacing + TimeOffset[source].
+     *  The energy deposits of the signal event (bunch 0, no time shift) and of
+     *  the drawn background events are merged by cellID into DigiCellDeposits
+     *  containers, which are stored in the event with the mask Mask.
+     *
+     *  The deposit containers are event data slots of type DigiEnergyDeposits.
+     *  The signal containers are read with the mask InputMask. The sources
+     *  must use masks different from InputMask and Mask. By default all
+     *  deposit containers of the signal and of the sources are merged,
+     *  otherwise only the containers listed in the property Containers.
+     *  The signal input must precede the mixer, otherwise its containers are
+     *  not known at initialization and the mixer refuses the configuration.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiOverlayMixer : public DigiSynchronize {
+    public:
+      /// Pool of background events of all sources
+      class pool_t;
+      /// Event data slots of one merged deposit container
+      class item_t  {
+      public:
+        /// Name of the container
+        std::string                  name;
+        /// Deposits of the signal event (invalid if the signal has no such container)
+        DigiSlot<DigiEnergyDeposits> input;
+        /// Merged deposits
+        DigiSlot<DigiEnergyDeposits> output;
+        /// Slots of the container in the pool events by source (-1 if absent)
+        std::vector<int>             sources;
+      };
+
+    protected:
+      /// Property: Mean number of events per bunch crossing by source name
+      std::map<std::string, double> m_mean;
+      /// Property: Time offset by source name
+      std::map<std::string, double> m_offset;
+      /// Property: Pool size by source name
+      std::map<std::string, int>    m_pool_size;
+      /// Property: Default pool size
+      int    m_default_pool_size  = 100;
+      /// Property: First bunch crossing of the train relative to the signal
+      int    m_first_bunch        = 0;
+      /// Property: Last bunch crossing of the train relative to the signal
+      int    m_last_bunch         = 0;
+      /// Property: Time between two bunch crossings
+      double m_bunch_spacing      = 25e0;
+      /// Property: Poisson fluctuations of the number of background events
+      bool   m_poisson            = true;
+      /// Property: Names of the deposit containers to be merged. If empty all are merged
+      std::vector<std::string> m_containers;
+      /// Property: Mask of the signal deposit containers
+      int    m_input_mask         = 0;
+      /// Property: Mask of the merged deposit containers
+      int    m_mask               = 1;
+
+      /// Merged deposit containers
+      std::vector<item_t>           m_items;
+
+      /// Shared background pool
+      std::shared_ptr<const pool_t> m_pool;
+      /// Flag to fill the pool once
+      std::once_flag                m_pool_filled;
+      /// Throughput statistics
+      mutable std::mutex            m_stat_lock;
+      mutable std::size_t           m_num_events   = 0;
+      mutable std::size_t           m_num_deposits = 0;
+      mutable double                m_mix_time     = 0e0;
+      mutable double                m_first_start  = -1e0;
+      mutable double                m_last_end     = 0e0;
+
+    protected:
+      /// Define standard assignments and constructors
+      DDDIGI_DEFINE_ACTION_CONSTRUCTORS(DigiOverlayMixer);
+
+      /// Fill the background pools of all sources
+      void fillPool();
+
+    public:
+      /// Standard constructor
+      DigiOverlayMixer(const DigiKernel& kernel, const std::string& nam);
+      /// Default destructor
+      virtual ~DigiOverlayMixer();
+      /// Declare the event data slots of the signal and the merged deposits
+      virtual void initialize()  override;
+      /// Only the slots of the mixer are used by the event. The sources fill the pool
+      virtual void dataDependencies(std::set<int>& inputs, std::set<int>& outputs)  const  override;
+      /// The sources are executed sequentially when filling the pool: nothing to check
+      virtual void checkDependencies()  const  override;
+      /// Overlay the background events on the signal event
+      virtual void execute(DigiContext& context)  const override;
+    };
+
+  }    // End namespace digi
+}      // End namespace dd4hep
+#endif // DDDIGI_DIGIOVERLAYMIXER_H
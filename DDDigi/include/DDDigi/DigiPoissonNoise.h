@@ -49,6 +49,8 @@ namespace dd4hep {
       virtual ~DigiPoissonNoise();
       /// Callback to read event poissonnoise
       virtual double operator()(DigiCellContext& context)  const  override;
+      /// Batched callback: compute the noise of n cells with the given signals
+      virtual void process(DigiContext& context, const double* signals, double* noise, std::size_t n)  const  override;
     };
   }    // End namespace digi
 }      // End namespace dd4hep
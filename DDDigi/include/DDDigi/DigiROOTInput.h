@@ -0,0 +1,113 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_DIGIROOTINPUT_H
+#define DDDIGI_DIGIROOTINPUT_H
+
+/// Framework include files
+#include "DDDigi/DigiData.h"
+#include "DDDigi/DigiInputAction.h"
+
+/// C/C++ include files
+#include <typeinfo>
+#include <memory>
+#include <map>
+
+/// Forward declarations
+class TClass;
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    // Forward declarations
+    class DigiROOTInput;
+
+    /// Base class to read event data from ROOT trees with read-ahead
+    /**
+     *  The entries of the input tree are read, decompressed and deserialized
+     *  by dedicated I/O threads while the previous events are processed.
+     *  Each I/O thread uses its own file handles and reads every n-th entry.
+     *  The number of entries buffered ahead of the consumer is bounded by
+     *  the property "ReadAhead" (default: maxEventsParallel of the kernel).
+     *
+     *  The entries are handed to the events in the order of the input files.
+     *  The objects of every branch are passed to the callback convert, which
+     *  takes ownership and stores the data in the event. Objects stored in
+     *  collections of pointers are deleted together with the collection.
+     *
+     *  At initialization the branches of the first input file are declared
+     *  as output event data slots with the key (Mask, branch name). The type
+     *  of each slot is given by the callback containerType.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiROOTInput : public DigiInputAction {
+    public:
+      /// Definition of a deserialized branch object of one input entry
+      class container_t  {
+      public:
+        /// Branch name
+        std::string name;
+        /// Event data slot of the container
+        int         slot   = -1;
+        /// Class of the deserialized object
+        TClass*     clazz  = 0;
+        /// Pointer to the deserialized object
+        void*       object = 0;
+      };
+      /// Internal implementation: I/O threads and read-ahead buffer
+      class internals_t;
+
+    protected:
+      /// Property: Name of the tree to be read
+      std::string              m_tree_name;
+      /// Property: Names of the branches to be read. If empty all branches are read
+      std::vector<std::string> m_containers;
+      /// Property: Event data mask of the containers
+      int                      m_mask        = 0;
+      /// Property: Number of entries read ahead (0: maxEventsParallel of the kernel)
+      int                      m_read_ahead  = 0;
+      /// Property: Number of I/O threads
+      int                      m_io_threads  = 1;
+      /// Event data slots of the containers by branch name
+      std::map<std::string, int> m_slots;
+      /// Reference to the internal implementation
+      std::unique_ptr<internals_t> imp;
+
+    protected:
+      /// Define standard assignments and constructors
+      DDDIGI_DEFINE_ACTION_CONSTRUCTORS(DigiROOTInput);
+
+      /// Type of the event data slot of a branch. Default: the branch class
+      virtual const std::type_info& containerType(TClass* clazz)  const;
+      /// Convert and store the data of one branch. Takes ownership of the object.
+      virtual void convert(DigiContext& context, container_t& container)  const;
+
+    public:
+      /// Standard constructor
+      DigiROOTInput(const DigiKernel& kernel, const std::string& nam);
+      /// Default destructor
+      virtual ~DigiROOTInput();
+      /// Declare the event data slots of the input branches
+      virtual void initialize()  override;
+      /// Callback to read event input
+      virtual void execute(DigiContext& context)  const override;
+    };
+
+  }    // End namespace digi
+}      // End namespace dd4hep
+#endif // DDDIGI_DIGIROOTINPUT_H
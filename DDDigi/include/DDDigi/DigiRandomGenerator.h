@@ -17,6 +17,8 @@
 
 /// C/C++ include files
 #include <functional>
+#include <cstdint>
+#include <atomic>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -45,6 +47,11 @@ namespace dd4hep {
      *  I know this is not nice, but I did not see any other way to overcome
      *  the virtualization mechanism
      * 
+     *  Batched calls:
+     *  ==============
+     *  The calls filling arrays do not use the engine, but the counter based
+     *  generator Philox4x32 with the given key. Blocks of counters are reserved
+     *  atomically, hence the arrays may be filled concurrently.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -53,6 +60,10 @@ namespace dd4hep {
     class DigiRandomGenerator {
     public:
       std::function<double()>  engine;
+      /// Key of the counter based generator used by the batched calls
+      std::uint64_t            key = 0;
+      /// Next free counter of the counter based generator
+      mutable std::atomic<std::uint64_t> counter { 0 };
     public:
       /// Initializing constructor
       DigiRandomGenerator() = default;
@@ -71,6 +82,19 @@ namespace dd4hep {
       void	 rannor(double& a, double& b)   const;
       void   sphere(double& x, double& y, double& z, double r)   const;
       void   circle(double &x, double &y, double r)  const;
+
+      /// Batched call: fill array with uniform numbers in ]0, 1]
+      void random     (double* values, std::size_t n)  const;
+      /// Batched call: fill array with uniform numbers in ]x1, x2]
+      void uniform    (double* values, std::size_t n, double x1, double x2)  const;
+      /// Batched call: fill array with exponentially distributed numbers
+      void exponential(double* values, std::size_t n, double tau)  const;
+      /// Batched call: fill array with gaussian numbers (Box-Muller)
+      void gaussian   (double* values, std::size_t n, double mean, double sigma)  const;
+      /// Batched call: fill array with landau distributed numbers
+      void landau     (double* values, std::size_t n, double mean, double sigma)  const;
+      /// Batched call: fill array with poisson distributed numbers
+      void poisson    (double* values, std::size_t n, double mean)  const;
     };
   }    // End namespace digi
 }      // End namespace dd4hep
@@ -20,6 +20,11 @@
 
 /// C/C++ include files
 #include <functional>
+#include <utility>
+#include <vector>
+#include <mutex>
+#include <cmath>
+#include <map>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -30,7 +35,6 @@ namespace dd4hep {
     /// Forward declarations
     class DigiContext;
     class DigiSegmentation;
-    template <typename SEGMENTATION> class cell_data;
     template <typename SEGMENTATION> class segmentation_data;    
     
     /// 
@@ -63,10 +67,55 @@ namespace dd4hep {
     };
 
     template <typename SEGMENTATION> 
-    void init_segmentation_data(segmentation_data<SEGMENTATION>& data, const Segmentation& seg);
+    void init_segmentation_data(segmentation_data<SEGMENTATION>& data, const DDSegmentation::Segmentation* seg);
 
-    /// 
+    /// Binning of one cell identifier field of a grid segmentation
+    /**
+     *  Bins and positions follow DDSegmentation::Segmentation::positionToBin
+     *  and binToPosition. Bins, which cannot be encoded in the field, are
+     *  excluded.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiCellAxis  {
+    public:
+      double grid_size  { 0.0 };
+      double offset     { 0.0 };
+      CellID mask       { 0 };
+      int    f_offset   { 0 };
+      long   min_bin    { 0 };
+      long   max_bin    { 0 };
+    public:
+      /// Default constructor
+      DigiCellAxis() = default;
+      /// Initializing constructor
+      DigiCellAxis(const DDSegmentation::BitFieldElement& field, double size, double off);
+      /// Bin of a local coordinate
+      long bin(double pos)  const  {
+        return long(std::floor((pos + 0.5 * grid_size - offset) / grid_size));
+      }
+      /// Local coordinate of the bin center
+      double position(long b)  const  {
+        return double(b) * grid_size + offset;
+      }
+      /// Cell identifier bits of a bin
+      CellID cell_id(long b)  const  {
+        return (CellID(b) << f_offset) & mask;
+      }
+      /// Range of bins [first, last] covering the interval [lo, hi]
+      std::pair<long, long> bins(double lo, double hi)  const;
+    };
+
+    /// Scanner of all cells of a sensitive volume
     /**
+     *  The cells contained in a solid are enumerated once per distinct solid
+     *  and cached. Scanning a placement only combines the cached cell bits
+     *  with the volume identifier. scan() is a template: the cell handler
+     *  is inlined and no std::function is involved.
+     *
+     *  The cache may be filled upfront with cells() and is thread safe.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -75,10 +124,43 @@ namespace dd4hep {
     class DigiCellScanner  {
     public:
       typedef std::function<void(DigiContext& context, const DigiCellScanner& env, const DigiCellData&)> cell_handler_t;
+      /// Segmentation bits of the cells contained in one solid
+      typedef std::vector<CellID> cells_t;
+
+    protected:
+      /// Cache of the contained cells by solid and sub-segmentation key
+      mutable std::map<std::pair<const TGeoShape*, long>, cells_t> m_cells;
+      /// Lock to protect the cell cache
+      mutable std::mutex m_cells_lock;
+
+      /// Enumerate the cells contained in the solid of a sensitive volume
+      virtual void build_cells(Solid solid, VolumeID vid, cells_t& cells)  const = 0;
+      /// Cache key in addition to the solid (e.g. the sub-segmentation). Default: 0
+      virtual long cache_key(VolumeID vid)  const;
+
     public:
+      /// Default constructor
       DigiCellScanner() = default;
+      /// Default destructor
       virtual ~DigiCellScanner() = default;
-      virtual void operator()(DigiContext& context, PlacedVolume pv, VolumeID vid, const cell_handler_t& cell_handler) = 0;
+      /// Access the cells contained in a solid. Builds the cache entry if required
+      const cells_t& cells(Solid solid, VolumeID vid)  const;
+      /// Call the handler for all cells of the placement
+      template <typename HANDLER>
+      void scan(DigiContext& context, PlacedVolume pv, VolumeID vid, HANDLER&& handler)  const  {
+        DigiCellData data;
+        data.placement = pv;
+        data.volume    = pv.volume();
+        data.solid     = data.volume.solid();
+        for( CellID cell : this->cells(data.solid, vid) )   {
+          data.cell_id = vid | cell;
+          handler(context, *this, data);
+        }
+      }
+      /// Call the handler for all cells of the placement (type erased handler)
+      void operator()(DigiContext& context, PlacedVolume pv, VolumeID vid, const cell_handler_t& cell_handler)  const  {
+        this->scan(context, pv, vid, cell_handler);
+      }
     };
     std::shared_ptr<DigiCellScanner> create_cell_scanner(Solid solid, Segmentation segment);
     std::shared_ptr<DigiCellScanner> create_cell_scanner(const std::string& typ, Segmentation segment);
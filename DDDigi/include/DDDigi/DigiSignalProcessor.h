@@ -17,6 +17,9 @@
 #include "DDDigi/DigiAction.h"
 #include "DDDigi/DigiData.h"
 
+/// C/C++ include files
+#include <vector>
+
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
 
@@ -46,6 +49,14 @@ namespace dd4hep {
 
     /// Base class for signal processing actions to the digitization
     /**
+     *  Besides the callback for single cells signal processors may support
+     *  - batched processing: the noise of many cells is computed in one call.
+     *    The default implementation calls the single cell callback.
+     *  - sparse noise: for channels without signal only the channels, where the
+     *    noise exceeds a threshold, are generated. The number of such channels
+     *    follows from the tail probability of the noise distribution. Hence
+     *    the cost is proportional to the number of channels above threshold
+     *    rather than to the total number of channels.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -68,6 +79,17 @@ namespace dd4hep {
       virtual void initialize();
       /// Callback to read event signalprocessor
       virtual double operator()(DigiCellContext& context)  const = 0;
+      /// Batched callback: compute the noise of n cells with the given signals
+      virtual void process(DigiContext& context, const double* signals, double* noise, std::size_t n)  const;
+      /// Probability that the noise of a channel without signal exceeds the threshold (<0: not supported)
+      virtual double tailProbability(double threshold)  const;
+      /// Draw the noise of a channel without signal under the condition that it exceeds the threshold
+      virtual double drawAbove(DigiContext& context, double threshold)  const;
+      /// Sparse noise: collect the channels out of num_channels without signal with noise above threshold
+      std::size_t sparse(DigiContext& context,
+                         std::size_t num_channels,
+                         double threshold,
+                         std::vector<std::pair<std::size_t, double> >& channels)  const;
     };
   }    // End namespace digi
 }      // End namespace dd4hep
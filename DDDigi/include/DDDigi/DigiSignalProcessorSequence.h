@@ -58,6 +58,8 @@ namespace dd4hep {
       void adopt(DigiSignalProcessor* action);
       /// Begin-of-event callback
       virtual double operator()(DigiCellContext& context)  const override;
+      /// Batched callback: sum of the signals and the noise of all processors
+      virtual void process(DigiContext& context, const double* signals, double* values, std::size_t n)  const override;
     };
 
   }    // End namespace digi
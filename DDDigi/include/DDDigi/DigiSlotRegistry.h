@@ -0,0 +1,106 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_DIGISLOTREGISTRY_H
+#define DDDIGI_DIGISLOTREGISTRY_H
+
+/// Framework include files
+#include "DDDigi/DigiData.h"
+
+/// C/C++ include files
+#include <typeinfo>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <map>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Registry of the event data slots
+    /**
+     *  Event data items are registered once at configuration time by the
+     *  actions producing or consuming them. Each key is resolved to a slot
+     *  index, which addresses the data store of every DigiEvent directly.
+     *  Producers and consumers of each slot are recorded to allow the kernel
+     *  to detect data conflicts between actions executing concurrently.
+     *
+     *  The registry is frozen when the kernel is initialized. Afterwards
+     *  no further slots may be declared and the registry is read only.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiSlotRegistry  {
+    public:
+      /// Description of one event data slot
+      class Entry  {
+      public:
+        /// Key of the data item
+        Key                      key;
+        /// Name of the data item
+        std::string              name;
+        /// Type of the data item
+        const std::type_info*    type = 0;
+        /// Names of the actions writing the slot
+        std::vector<std::string> producers;
+        /// Names of the actions reading the slot
+        std::vector<std::string> consumers;
+      };
+
+    private:
+      /// Lock to protect the registration
+      mutable std::mutex         m_lock;
+      /// Slot descriptions indexed by the slot number
+      std::vector<Entry>         m_entries;
+      /// Slot numbers by key
+      std::map<Key::key_type, int> m_slots;
+      /// Flag to inhibit further registrations
+      bool                       m_frozen = false;
+
+      /// Access slot entry with range check. Requires the lock to be held
+      Entry& _entry(int slot);
+
+    public:
+      /// Default constructor
+      DigiSlotRegistry() = default;
+      /// Inhibit copy constructor
+      DigiSlotRegistry(const DigiSlotRegistry& copy) = delete;
+      /// Inhibit assignment
+      DigiSlotRegistry& operator=(const DigiSlotRegistry& copy) = delete;
+      /// Default destructor
+      ~DigiSlotRegistry() = default;
+
+      /// Register a data slot. Registering the same key again returns the existing slot
+      int add(const Key& key, const std::string& name, const std::type_info& type);
+      /// Declare an action writing the slot
+      void addProducer(int slot, const std::string& action);
+      /// Declare an action reading the slot
+      void addConsumer(int slot, const std::string& action);
+      /// Access the slot number of a key. Returns -1 if the key is not registered
+      int slot(const Key& key)  const;
+      /// Access the description of a slot
+      const Entry& entry(int slot)  const;
+      /// Number of registered slots
+      std::size_t size()  const;
+      /// Inhibit further registrations
+      void freeze();
+      /// Check if the registry is frozen
+      bool isFrozen()  const;
+    };
+  }    // End namespace digi
+}      // End namespace dd4hep
+#endif // DDDIGI_DIGISLOTREGISTRY_H
@@ -42,6 +42,9 @@ namespace dd4hep {
 
     /// Concrete implementation of the Digitization event action sequence
     /**
+     *  If the property "input" is set, the sequence declares the energy deposit
+     *  container of that name (mask "input_mask") as event data input on behalf
+     *  of the signal processors of the subdetector.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -68,6 +71,9 @@ namespace dd4hep {
       typedef std::map<std::pair<const TClass*,Segmentation>, std::shared_ptr<DigiCellScanner> > Scanners;
       std::string                    m_detectorName;
       std::string                    m_segmentName;
+      std::string                    m_inputName;
+      int                            m_inputMask = 0;
+      DigiSlot<DigiEnergyDeposits>   m_deposits;
       SensitiveDetector              m_sensDet;
       DetElement                     m_detector;
       IDDescriptor                   m_idDesc;
@@ -76,8 +82,6 @@ namespace dd4hep {
       std::map<VolumeID, Context>    m_parallelVid;
       Scanners                       m_scanners;
 
-      std::function<void(DigiContext& context, const DigiCellScanner&, const DigiCellData&)> m_cellHandler;
-
     protected:
       /// Define standard assignments and constructors
       DDDIGI_DEFINE_ACTION_CONSTRUCTORS(DigiSubdetectorSequence);
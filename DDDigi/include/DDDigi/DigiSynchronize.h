@@ -53,6 +53,12 @@ namespace dd4hep {
       }
       /// Adopt a new action as part of the sequence. Sequence takes ownership.
       virtual void adopt(DigiEventAction* action);
+      /// Initialize all children
+      virtual void initialize()  override;
+      /// Collect the event data slots read and written by this action and all children
+      virtual void dataDependencies(std::set<int>& inputs, std::set<int>& outputs)  const override;
+      /// Check that children executing in parallel do not write data used by their siblings
+      virtual void checkDependencies()  const override;
       /// Begin-of-event callback
       virtual void execute(DigiContext& context)  const override;
       ///
@@ -0,0 +1,84 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_PHILOX_H
+#define DDDIGI_PHILOX_H
+
+/// C/C++ include files
+#include <cstdint>
+#include <cstddef>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for implementation details of the AIDA detector description toolkit
+  namespace detail {
+
+    /// Counter based random number generator Philox4x32-10
+    /**
+     *  Each block of 4 random 32 bit words is a pure function of the counter
+     *  and the key. Arrays of random numbers may therefore be filled in
+     *  tight loops without generator state, which the compiler can vectorize,
+     *  and the numbers do not depend on the order in which they are consumed.
+     *
+     *  See: J.K.Salmon, M.A.Moraes, R.O.Dror, D.E.Shaw,
+     *       "Parallel random numbers: as easy as 1, 2, 3", SC'11.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class Philox4x32  {
+    public:
+      /// Generate one block of 4 random words from a 64 bit counter and a 64 bit key
+      static inline void generate(std::uint64_t counter, std::uint64_t key, std::uint32_t out[4])  {
+        const std::uint64_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+        const std::uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+        std::uint32_t c0 = std::uint32_t(counter), c1 = std::uint32_t(counter >> 32), c2 = 0, c3 = 0;
+        std::uint32_t k0 = std::uint32_t(key),     k1 = std::uint32_t(key >> 32);
+        for( int round = 0; round < 10; ++round )   {
+          std::uint64_t p0 = M0 * c0;
+          std::uint64_t p1 = M1 * c2;
+          std::uint32_t n0 = std::uint32_t(p1 >> 32) ^ c1 ^ k0;
+          std::uint32_t n2 = std::uint32_t(p0 >> 32) ^ c3 ^ k1;
+          c1 = std::uint32_t(p1);
+          c3 = std::uint32_t(p0);
+          c0 = n0;
+          c2 = n2;
+          k0 += W0;
+          k1 += W1;
+        }
+        out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+      }
+      /// Fill n uniform numbers in ]0, 1] using the blocks starting at counter 'first'
+      /**
+       *  Every block yields 2 numbers with 53 bit resolution.
+       *  (n+1)/2 blocks are used.
+       */
+      static inline void uniform(double* values, std::size_t n, std::uint64_t key, std::uint64_t first)  {
+        const double norm = 1.0 / 9007199254740992.0;  // 2**-53
+        std::uint32_t r[4];
+        std::size_t   m = n & ~std::size_t(1);
+        for( std::size_t i = 0; i < m; i += 2 )   {
+          generate(first + i/2, key, r);
+          values[i]   = (double(((std::uint64_t(r[0]) << 32) | r[1]) >> 11) + 1.0) * norm;
+          values[i+1] = (double(((std::uint64_t(r[2]) << 32) | r[3]) >> 11) + 1.0) * norm;
+        }
+        if ( m < n )   {
+          generate(first + m/2, key, r);
+          values[m]   = (double(((std::uint64_t(r[0]) << 32) | r[1]) >> 11) + 1.0) * norm;
+        }
+      }
+    };
+  }    // End namespace detail
+}      // End namespace dd4hep
+#endif // DDDIGI_PHILOX_H
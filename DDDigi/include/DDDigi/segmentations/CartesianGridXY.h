@@ -14,7 +14,7 @@
 #define DDDIGI_SEGMENTATIONS_CARTESIANGRIDXY_H
 
 /// Framework include files
-#include <DDDigi/DigiSegmentation.h>
+#include <DDDigi/segmentations/SegmentationScanner.h>
 #include <DD4hep/CartesianGridXY.h>
 #include <DDSegmentation/CartesianGridXY.h>
 
@@ -24,25 +24,40 @@ namespace dd4hep {
   /// Namespace for the Digitization part of the AIDA detector description toolkit
   namespace digi {
 
-    template <> class cell_data<CartesianGridXY> : public DigiCellData {
-    public:
-      CellID x_cid {0}, y_cid {0};
-      CellID x_bin {0}, y_bin {0};
-    };
-
     template <> class segmentation_data<CartesianGridXY> {
     public:
-      DDSegmentation::CartesianGridXY* segmentation_xy {0};
-      double x_grid_size {0.0};
-      double x_offset    {0.0};
-      double y_grid_size {0.0};
-      double y_offset    {0.0};
-      CellID x_mask      {0};
-      CellID y_mask      {0};
-      int    x_f_offset  {0};
-      int    y_f_offset  {0};
+      const DDSegmentation::CartesianGridXY* segmentation_xy {0};
+      DigiCellAxis x, y;
+
+      /// Enumerate the cells with center inside the solid. Z is taken at the center of the bounding box
+      template <typename SOLID> void enumerate(const TGeoShape* solid, DigiCellScanner::cells_t& cells)  const  {
+        const TGeoBBox* box = cell_bounding_box(solid);
+        const double*   org = box->GetOrigin();
+        double pos[3] = { org[0], org[1], org[2] };
+        auto x_bins = x.bins(org[0] - box->GetDX(), org[0] + box->GetDX());
+        auto y_bins = y.bins(org[1] - box->GetDY(), org[1] + box->GetDY());
+        for( long x_bin = x_bins.first; x_bin <= x_bins.second; ++x_bin )   {
+          CellID x_cid = x.cell_id(x_bin);
+          pos[0] = x.position(x_bin);
+          for( long y_bin = y_bins.first; y_bin <= y_bins.second; ++y_bin )   {
+            pos[1] = y.position(y_bin);
+            if ( cell_contained<SOLID>(solid, pos) )
+              cells.push_back(x_cid | y.cell_id(y_bin));
+          }
+        }
+      }
     };
 
+    template <> inline void
+    init_segmentation_data<CartesianGridXY>(segmentation_data<CartesianGridXY>& data, const DDSegmentation::Segmentation* seg)  {
+      const auto* s = dynamic_cast<const DDSegmentation::CartesianGridXY*>(seg);
+      if ( !s )   {
+        except("DigiCellScanner","+++ Invalid segmentation: expected CartesianGridXY.");
+      }
+      data.segmentation_xy = s;
+      data.x = DigiCellAxis((*s->decoder())[s->fieldNameX()], s->gridSizeX(), s->offsetX());
+      data.y = DigiCellAxis((*s->decoder())[s->fieldNameY()], s->gridSizeY(), s->offsetY());
+    }
   }    // End namespace digi
 }      // End namespace dd4hep
 #endif // DDDIGI_SEGMENTATIONS_CARTESIANGRIDXY_H
@@ -14,37 +14,56 @@
 #define DDDIGI_SEGMENTATIONS_CARTESIANGRIDXYZ_H
 
 /// Framework include files
-#include <DDDigi/DigiSegmentation.h>
+#include <DDDigi/segmentations/SegmentationScanner.h>
 #include <DD4hep/CartesianGridXYZ.h>
 #include <DDSegmentation/CartesianGridXYZ.h>
 
-/// C/C++ include files
-#include <functional>
-
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
 
   /// Namespace for the Digitization part of the AIDA detector description toolkit
   namespace digi {
 
-    template <> class cell_data<CartesianGridXYZ> : public DigiCellData {
-    public:
-      CellID x_cid {0}, y_cid {0}, z_cid {0};
-      CellID x_bin {0}, y_bin {0}, z_bin {0};
-    };
-
     template <> class segmentation_data<CartesianGridXYZ> {
     public:
-      DDSegmentation::CartesianGridXYZ* segmentation_xyz {0};
-      double x_grid_size {0.0}, x_offset {0.0};
-      double y_grid_size {0.0}, y_offset {0.0};
-      double z_grid_size {0.0}, z_offset {0.0};
-      CellID x_mask {0};
-      CellID y_mask {0};
-      CellID z_mask {0};
-      int    x_f_offset {0}, y_f_offset {0}, z_f_offset {0};
+      const DDSegmentation::CartesianGridXYZ* segmentation_xyz {0};
+      DigiCellAxis x, y, z;
+
+      /// Enumerate the cells with center inside the solid
+      template <typename SOLID> void enumerate(const TGeoShape* solid, DigiCellScanner::cells_t& cells)  const  {
+        const TGeoBBox* box = cell_bounding_box(solid);
+        const double*   org = box->GetOrigin();
+        double pos[3] = { org[0], org[1], org[2] };
+        auto x_bins = x.bins(org[0] - box->GetDX(), org[0] + box->GetDX());
+        auto y_bins = y.bins(org[1] - box->GetDY(), org[1] + box->GetDY());
+        auto z_bins = z.bins(org[2] - box->GetDZ(), org[2] + box->GetDZ());
+        for( long x_bin = x_bins.first; x_bin <= x_bins.second; ++x_bin )   {
+          CellID x_cid = x.cell_id(x_bin);
+          pos[0] = x.position(x_bin);
+          for( long y_bin = y_bins.first; y_bin <= y_bins.second; ++y_bin )   {
+            CellID y_cid = x_cid | y.cell_id(y_bin);
+            pos[1] = y.position(y_bin);
+            for( long z_bin = z_bins.first; z_bin <= z_bins.second; ++z_bin )   {
+              pos[2] = z.position(z_bin);
+              if ( cell_contained<SOLID>(solid, pos) )
+                cells.push_back(y_cid | z.cell_id(z_bin));
+            }
+          }
+        }
+      }
     };
 
+    template <> inline void
+    init_segmentation_data<CartesianGridXYZ>(segmentation_data<CartesianGridXYZ>& data, const DDSegmentation::Segmentation* seg)  {
+      const auto* s = dynamic_cast<const DDSegmentation::CartesianGridXYZ*>(seg);
+      if ( !s )   {
+        except("DigiCellScanner","+++ Invalid segmentation: expected CartesianGridXYZ.");
+      }
+      data.segmentation_xyz = s;
+      data.x = DigiCellAxis((*s->decoder())[s->fieldNameX()], s->gridSizeX(), s->offsetX());
+      data.y = DigiCellAxis((*s->decoder())[s->fieldNameY()], s->gridSizeY(), s->offsetY());
+      data.z = DigiCellAxis((*s->decoder())[s->fieldNameZ()], s->gridSizeZ(), s->offsetZ());
+    }
   }    // End namespace digi
 }      // End namespace dd4hep
 #endif // DDDIGI_SEGMENTATIONS_CARTESIANGRIDXYZ_H
@@ -0,0 +1,63 @@
+//==========================================================================
+//  AIDA Detector description implementation 
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_SEGMENTATIONS_CARTESIANGRIDXZ_H
+#define DDDIGI_SEGMENTATIONS_CARTESIANGRIDXZ_H
+
+/// Framework include files
+#include <DDDigi/segmentations/SegmentationScanner.h>
+#include <DD4hep/CartesianGridXZ.h>
+#include <DDSegmentation/CartesianGridXZ.h>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    template <> class segmentation_data<CartesianGridXZ> {
+    public:
+      const DDSegmentation::CartesianGridXZ* segmentation_xz {0};
+      DigiCellAxis x, z;
+
+      /// Enumerate the cells with center inside the solid. Y is taken at the center of the bounding box
+      template <typename SOLID> void enumerate(const TGeoShape* solid, DigiCellScanner::cells_t& cells)  const  {
+        const TGeoBBox* box = cell_bounding_box(solid);
+        const double*   org = box->GetOrigin();
+        double pos[3] = { org[0], org[1], org[2] };
+        auto x_bins = x.bins(org[0] - box->GetDX(), org[0] + box->GetDX());
+        auto z_bins = z.bins(org[2] - box->GetDZ(), org[2] + box->GetDZ());
+        for( long x_bin = x_bins.first; x_bin <= x_bins.second; ++x_bin )   {
+          CellID x_cid = x.cell_id(x_bin);
+          pos[0] = x.position(x_bin);
+          for( long z_bin = z_bins.first; z_bin <= z_bins.second; ++z_bin )   {
+            pos[2] = z.position(z_bin);
+            if ( cell_contained<SOLID>(solid, pos) )
+              cells.push_back(x_cid | z.cell_id(z_bin));
+          }
+        }
+      }
+    };
+
+    template <> inline void
+    init_segmentation_data<CartesianGridXZ>(segmentation_data<CartesianGridXZ>& data, const DDSegmentation::Segmentation* seg)  {
+      const auto* s = dynamic_cast<const DDSegmentation::CartesianGridXZ*>(seg);
+      if ( !s )   {
+        except("DigiCellScanner","+++ Invalid segmentation: expected CartesianGridXZ.");
+      }
+      data.segmentation_xz = s;
+      data.x = DigiCellAxis((*s->decoder())[s->fieldNameX()], s->gridSizeX(), s->offsetX());
+      data.z = DigiCellAxis((*s->decoder())[s->fieldNameZ()], s->gridSizeZ(), s->offsetZ());
+    }
+  }    // End namespace digi
+}      // End namespace dd4hep
+#endif // DDDIGI_SEGMENTATIONS_CARTESIANGRIDXZ_H
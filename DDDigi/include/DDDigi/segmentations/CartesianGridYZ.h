@@ -0,0 +1,63 @@
+//==========================================================================
+//  AIDA Detector description implementation 
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_SEGMENTATIONS_CARTESIANGRIDYZ_H
+#define DDDIGI_SEGMENTATIONS_CARTESIANGRIDYZ_H
+
+/// Framework include files
+#include <DDDigi/segmentations/SegmentationScanner.h>
+#include <DD4hep/CartesianGridYZ.h>
+#include <DDSegmentation/CartesianGridYZ.h>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    template <> class segmentation_data<CartesianGridYZ> {
+    public:
+      const DDSegmentation::CartesianGridYZ* segmentation_yz {0};
+      DigiCellAxis y, z;
+
+      /// Enumerate the cells with center inside the solid. X is taken at the center of the bounding box
+      template <typename SOLID> void enumerate(const TGeoShape* solid, DigiCellScanner::cells_t& cells)  const  {
+        const TGeoBBox* box = cell_bounding_box(solid);
+        const double*   org = box->GetOrigin();
+        double pos[3] = { org[0], org[1], org[2] };
+        auto y_bins = y.bins(org[1] - box->GetDY(), org[1] + box->GetDY());
+        auto z_bins = z.bins(org[2] - box->GetDZ(), org[2] + box->GetDZ());
+        for( long y_bin = y_bins.first; y_bin <= y_bins.second; ++y_bin )   {
+          CellID y_cid = y.cell_id(y_bin);
+          pos[1] = y.position(y_bin);
+          for( long z_bin = z_bins.first; z_bin <= z_bins.second; ++z_bin )   {
+            pos[2] = z.position(z_bin);
+            if ( cell_contained<SOLID>(solid, pos) )
+              cells.push_back(y_cid | z.cell_id(z_bin));
+          }
+        }
+      }
+    };
+
+    template <> inline void
+    init_segmentation_data<CartesianGridYZ>(segmentation_data<CartesianGridYZ>& data, const DDSegmentation::Segmentation* seg)  {
+      const auto* s = dynamic_cast<const DDSegmentation::CartesianGridYZ*>(seg);
+      if ( !s )   {
+        except("DigiCellScanner","+++ Invalid segmentation: expected CartesianGridYZ.");
+      }
+      data.segmentation_yz = s;
+      data.y = DigiCellAxis((*s->decoder())[s->fieldNameY()], s->gridSizeY(), s->offsetY());
+      data.z = DigiCellAxis((*s->decoder())[s->fieldNameZ()], s->gridSizeZ(), s->offsetZ());
+    }
+  }    // End namespace digi
+}      // End namespace dd4hep
+#endif // DDDIGI_SEGMENTATIONS_CARTESIANGRIDYZ_H
@@ -0,0 +1,118 @@
+//==========================================================================
+//  AIDA Detector description implementation 
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_SEGMENTATIONS_MULTISEGMENTATION_H
+#define DDDIGI_SEGMENTATIONS_MULTISEGMENTATION_H
+
+/// Framework include files
+#include <DDDigi/segmentations/SegmentationScanner.h>
+#include <DDDigi/segmentations/CartesianGridXY.h>
+#include <DDDigi/segmentations/CartesianGridXZ.h>
+#include <DDDigi/segmentations/CartesianGridYZ.h>
+#include <DDDigi/segmentations/CartesianGridXYZ.h>
+#include <DDDigi/segmentations/PolarGridRPhi.h>
+#include <DD4hep/MultiSegmentation.h>
+#include <DDSegmentation/MultiSegmentation.h>
+
+/// C/C++ include files
+#include <memory>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    template <> class segmentation_data<MultiSegmentation> {
+    public:
+      const DDSegmentation::MultiSegmentation* segmentation_multi {0};
+      const DDSegmentation::BitFieldElement*   discriminator      {0};
+    };
+
+    template <> inline void
+    init_segmentation_data<MultiSegmentation>(segmentation_data<MultiSegmentation>& data, const DDSegmentation::Segmentation* seg)  {
+      const auto* s = dynamic_cast<const DDSegmentation::MultiSegmentation*>(seg);
+      if ( !s )   {
+        except("DigiCellScanner","+++ Invalid segmentation: expected MultiSegmentation.");
+      }
+      data.segmentation_multi = s;
+      data.discriminator      = s->discriminator();
+    }
+
+    /// Cell scanner of multi segmentations
+    /**
+     *  The sub-segmentation is selected by the discriminator field of the
+     *  volume identifier. The cells are enumerated by the scanner of the
+     *  sub-segmentation and cached per solid and sub-segmentation.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    template <typename SOLID> class CellScanner<MultiSegmentation, SOLID> : public DigiCellScanner  {
+    public:
+      typedef SOLID                                   solid_t;
+      typedef MultiSegmentation                       segmentation_t;
+      typedef CellScanner<segmentation_t, solid_t>    self_t;
+      typedef segmentation_data<segmentation_t>       segmentation_data_t;
+      typedef DigiCellScanner::cell_handler_t         cell_handler_t;
+
+      /// Sub-segmentation entry
+      class entry_t  {
+      public:
+        long key_min, key_max;
+        std::unique_ptr<DigiCellScanner> scanner;
+      };
+      segmentation_data_t  segment;
+      std::vector<entry_t> entries;
+
+    protected:
+      /// Create the scanner of a sub-segmentation
+      static DigiCellScanner* sub_scanner(const DDSegmentation::Segmentation* seg)   {
+        const std::string& typ = seg->type();
+        if ( typ == "CartesianGridXY"  ) return new CellScanner<CartesianGridXY,  solid_t>(seg);
+        if ( typ == "CartesianGridXZ"  ) return new CellScanner<CartesianGridXZ,  solid_t>(seg);
+        if ( typ == "CartesianGridYZ"  ) return new CellScanner<CartesianGridYZ,  solid_t>(seg);
+        if ( typ == "CartesianGridXYZ" ) return new CellScanner<CartesianGridXYZ, solid_t>(seg);
+        if ( typ == "PolarGridRPhi"    ) return new CellScanner<PolarGridRPhi,    solid_t>(seg);
+        except("DigiCellScanner","+++ Unsupported sub-segmentation type %s.", typ.c_str());
+        return nullptr;
+      }
+      /// Cache key: index of the sub-segmentation selected by the volume identifier
+      virtual long cache_key(VolumeID vid)  const  override  {
+        long key = segment.discriminator->value(vid);
+        for( std::size_t i = 0; i < entries.size(); ++i )   {
+          if ( key >= entries[i].key_min && key <= entries[i].key_max )
+            return long(i);
+        }
+        except("DigiCellScanner","+++ No sub-segmentation for discriminator value %ld.", key);
+        return -1;
+      }
+      /// Enumerate the cells contained in the solid of a sensitive volume
+      virtual void build_cells(Solid solid, VolumeID vid, cells_t& cells)  const  override  {
+        cells = entries[cache_key(vid)].scanner->cells(solid, vid);
+      }
+
+    public:
+      /// Initializing constructor from the segmentation implementation
+      explicit CellScanner(const DDSegmentation::Segmentation* seg)   {
+        init_segmentation_data<segmentation_t>(segment, seg);
+        for( const auto& e : segment.segmentation_multi->subSegmentations() )
+          entries.emplace_back(entry_t { e.key_min, e.key_max, std::unique_ptr<DigiCellScanner>(sub_scanner(e.segmentation)) });
+      }
+      /// Initializing constructor from the segmentation handle
+      CellScanner(Segmentation seg) : CellScanner(seg.segmentation())   {
+      }
+    };
+  }    // End namespace digi
+}      // End namespace dd4hep
+#endif // DDDIGI_SEGMENTATIONS_MULTISEGMENTATION_H
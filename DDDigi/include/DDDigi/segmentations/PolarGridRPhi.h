@@ -0,0 +1,81 @@
+//==========================================================================
+//  AIDA Detector description implementation 
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_SEGMENTATIONS_POLARGRIDRPHI_H
+#define DDDIGI_SEGMENTATIONS_POLARGRIDRPHI_H
+
+/// Framework include files
+#include <DDDigi/segmentations/SegmentationScanner.h>
+#include <DD4hep/PolarGridRPhi.h>
+#include <DDSegmentation/PolarGridRPhi.h>
+
+/// C/C++ include files
+#include <algorithm>
+#include <cmath>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    template <> class segmentation_data<PolarGridRPhi> {
+    public:
+      const DDSegmentation::PolarGridRPhi* segmentation_rphi {0};
+      DigiCellAxis r, phi;
+
+      /// Enumerate the cells with center inside the solid. Z is taken at the center of the bounding box
+      template <typename SOLID> void enumerate(const TGeoShape* solid, DigiCellScanner::cells_t& cells)  const  {
+        const TGeoBBox* box = cell_bounding_box(solid);
+        const double*   org = box->GetOrigin();
+        const double x_min = org[0] - box->GetDX(), x_max = org[0] + box->GetDX();
+        const double y_min = org[1] - box->GetDY(), y_max = org[1] + box->GetDY();
+        // Radial range of the bounding box in the local XY plane
+        double dx_min = std::max(0e0, std::max(x_min, -x_max));
+        double dy_min = std::max(0e0, std::max(y_min, -y_max));
+        double dx_max = std::max(std::abs(x_min), std::abs(x_max));
+        double dy_max = std::max(std::abs(y_min), std::abs(y_max));
+        double pos[3] = { 0e0, 0e0, org[2] };
+        auto r_bins   = r.bins(std::sqrt(dx_min*dx_min + dy_min*dy_min), std::sqrt(dx_max*dx_max + dy_max*dy_max));
+        // Phi is periodic: exactly one turn of bins covering the half-open range [-pi, pi)
+        long phi_num  = std::lround(2e0*M_PI/phi.grid_size);
+        long phi_lo   = phi.bin(-M_PI);
+        auto phi_bins = std::make_pair(std::max(phi.min_bin, phi_lo), std::min(phi.max_bin, phi_lo + phi_num - 1));
+        for( long r_bin = r_bins.first; r_bin <= r_bins.second; ++r_bin )   {
+          CellID r_cid = r.cell_id(r_bin);
+          double rad   = r.position(r_bin);
+          for( long phi_bin = phi_bins.first; phi_bin <= phi_bins.second; ++phi_bin )   {
+            double ang = phi.position(phi_bin);
+            pos[0] = rad * std::cos(ang);
+            pos[1] = rad * std::sin(ang);
+            if ( pos[0] < x_min || pos[0] > x_max || pos[1] < y_min || pos[1] > y_max )
+              continue;
+            if ( cell_contained<SOLID>(solid, pos) )
+              cells.push_back(r_cid | phi.cell_id(phi_bin));
+          }
+        }
+      }
+    };
+
+    template <> inline void
+    init_segmentation_data<PolarGridRPhi>(segmentation_data<PolarGridRPhi>& data, const DDSegmentation::Segmentation* seg)  {
+      const auto* s = dynamic_cast<const DDSegmentation::PolarGridRPhi*>(seg);
+      if ( !s )   {
+        except("DigiCellScanner","+++ Invalid segmentation: expected PolarGridRPhi.");
+      }
+      data.segmentation_rphi = s;
+      data.r   = DigiCellAxis((*s->decoder())[s->fieldNameR()],   s->gridSizeR(),   s->offsetR());
+      data.phi = DigiCellAxis((*s->decoder())[s->fieldNamePhi()], s->gridSizePhi(), s->offsetPhi());
+    }
+  }    // End namespace digi
+}      // End namespace dd4hep
+#endif // DDDIGI_SEGMENTATIONS_POLARGRIDRPHI_H
@@ -1,5 +1,5 @@
 //==========================================================================
-//  AIDA Detector description implementation 
+//  AIDA Detector description implementation
 //--------------------------------------------------------------------------
 // Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
 // All rights reserved.
@@ -16,6 +16,10 @@
 /// Framework include files
 #include <DDDigi/DigiSegmentation.h>
 #include <DDDigi/DigiFactories.h>
+#include <DD4hep/Printout.h>
+
+/// ROOT include files
+#include <TGeoBBox.h>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -23,8 +27,33 @@ namespace dd4hep {
   /// Namespace for the Digitization part of the AIDA detector description toolkit
   namespace digi {
 
-    /// 
+    /// Check if a cell with center at the local position belongs to the solid
+    template <typename SOLID> inline bool cell_contained(const TGeoShape* solid, const double* pos)   {
+      return solid->Contains(pos);
+    }
+    /// Boxes: all cells overlapping with the bounding box belong to the volume
+    template <> inline bool cell_contained<Box>(const TGeoShape* /* solid */, const double* /* pos */)   {
+      return true;
+    }
+
+    /// Access the bounding box of a solid
+    inline const TGeoBBox* cell_bounding_box(const TGeoShape* solid)   {
+      const TGeoBBox* box = dynamic_cast<const TGeoBBox*>(solid);
+      if ( !box )   {
+        except("DigiCellScanner","+++ Solid %s has no bounding box.", solid ? solid->GetName() : "[invalid]");
+      }
+      return box;
+    }
+
+    /// Generic cell scanner for a given segmentation and solid type
     /**
+     *  The cells of a solid are enumerated by the member function
+     *
+     *      template <typename SOLID> void
+     *      segmentation_data<SEGMENTATION>::enumerate(const TGeoShape* solid,
+     *                                                 DigiCellScanner::cells_t& cells)  const;
+     *
+     *  of the specialization provided by the segmentation header.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -35,15 +64,25 @@ namespace dd4hep {
       typedef SOLID                                   solid_t;
       typedef SEGMENTATION                            segmentation_t;
       typedef CellScanner<segmentation_t, solid_t>    self_t;
-      typedef cell_data<segmentation_t>               cell_data_t;
       typedef segmentation_data<segmentation_t>       segmentation_data_t;
       typedef DigiCellScanner::cell_handler_t         cell_handler_t;
 
       segmentation_data_t segment;
-      CellScanner(segmentation_t seg)   {
+
+    protected:
+      /// Enumerate the cells contained in the solid of a sensitive volume
+      virtual void build_cells(Solid solid, VolumeID /* vid */, cells_t& cells)  const  override  {
+        segment.template enumerate<solid_t>(solid.ptr(), cells);
+      }
+
+    public:
+      /// Initializing constructor from the segmentation implementation
+      explicit CellScanner(const DDSegmentation::Segmentation* seg)   {
         init_segmentation_data<segmentation_t>(segment, seg);
       }
-      virtual void operator()(DigiContext& context, PlacedVolume pv, VolumeID vid, const cell_handler_t& cell_handler)  override;
+      /// Initializing constructor from the segmentation handle
+      CellScanner(Segmentation seg) : CellScanner(seg.segmentation())   {
+      }
     };
   }    // End namespace digi
 }      // End namespace dd4hep
@@ -0,0 +1,36 @@
+//==========================================================================
+//  AIDA Detector description implementation 
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+/// Framework include files
+#include <DDDigi/segmentations/CartesianGridXZ.h>
+
+namespace dd4hep  {
+  typedef IntersectionSolid Intersection;
+  typedef SubtractionSolid Subtraction;
+  typedef UnionSolid Union;
+}
+
+/// Cell scanners of the CartesianGridXZ segmentation for all supported solids.
+/// The cells are enumerated in the local XZ plane at the center of the solid.
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,Box)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,Tube)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,Trd1)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,Trd2)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,Trap)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,ConeSegment)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,PolyhedraRegular)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,Polyhedra)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,Polycone)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,Intersection)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,Subtraction)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridXZ,Union)
@@ -0,0 +1,36 @@
+//==========================================================================
+//  AIDA Detector description implementation 
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+/// Framework include files
+#include <DDDigi/segmentations/CartesianGridYZ.h>
+
+namespace dd4hep  {
+  typedef IntersectionSolid Intersection;
+  typedef SubtractionSolid Subtraction;
+  typedef UnionSolid Union;
+}
+
+/// Cell scanners of the CartesianGridYZ segmentation for all supported solids.
+/// The cells are enumerated in the local YZ plane at the center of the solid.
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,Box)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,Tube)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,Trd1)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,Trd2)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,Trap)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,ConeSegment)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,PolyhedraRegular)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,Polyhedra)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,Polycone)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,Intersection)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,Subtraction)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,CartesianGridYZ,Union)
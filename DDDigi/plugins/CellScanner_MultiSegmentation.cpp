@@ -0,0 +1,37 @@
+//==========================================================================
+//  AIDA Detector description implementation 
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+/// Framework include files
+#include <DDDigi/segmentations/MultiSegmentation.h>
+
+namespace dd4hep  {
+  typedef IntersectionSolid Intersection;
+  typedef SubtractionSolid Subtraction;
+  typedef UnionSolid Union;
+}
+
+/// Cell scanners of the MultiSegmentation segmentation for all supported solids.
+/// The cells are enumerated by the scanner of the sub-segmentation
+/// selected by the discriminator field of the volume identifier.
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,Box)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,Tube)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,Trd1)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,Trd2)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,Trap)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,ConeSegment)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,PolyhedraRegular)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,Polyhedra)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,Polycone)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,Intersection)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,Subtraction)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,MultiSegmentation,Union)
@@ -0,0 +1,36 @@
+//==========================================================================
+//  AIDA Detector description implementation 
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+/// Framework include files
+#include <DDDigi/segmentations/PolarGridRPhi.h>
+
+namespace dd4hep  {
+  typedef IntersectionSolid Intersection;
+  typedef SubtractionSolid Subtraction;
+  typedef UnionSolid Union;
+}
+
+/// Cell scanners of the PolarGridRPhi segmentation for all supported solids.
+/// The cells are enumerated in the local XY plane at the center of the solid.
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,Box)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,Tube)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,Trd1)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,Trd2)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,Trap)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,ConeSegment)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,PolyhedraRegular)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,Polyhedra)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,Polycone)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,Intersection)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,Subtraction)
+DECLARE_DIGICELLSCANNER(DigiCellScanner,PolarGridRPhi,Union)
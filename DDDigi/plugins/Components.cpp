@@ -24,9 +24,15 @@
 #include "DDDigi/DigiInputAction.h"
 DECLARE_DIGIEVENTACTION_NS(dd4hep::digi,DigiInputAction)
 
+#include "DDDigi/DigiROOTInput.h"
+DECLARE_DIGIEVENTACTION_NS(dd4hep::digi,DigiROOTInput)
+
 #include "DDDigi/DigiSynchronize.h"
 DECLARE_DIGIEVENTACTION_NS(dd4hep::digi,DigiSynchronize)
 
+#include "DDDigi/DigiOverlayMixer.h"
+DECLARE_DIGIEVENTACTION_NS(dd4hep::digi,DigiOverlayMixer)
+
 #include "DDDigi/DigiActionSequence.h"
 DECLARE_DIGIEVENTACTION_NS(dd4hep::digi,DigiActionSequence)
 
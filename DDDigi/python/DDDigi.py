@@ -178,10 +178,14 @@ def EventAction(kernel, nam, parallel=False):
 # ---------------------------------------------------------------------------
 
 
-def TestAction(kernel, nam, sleep=0):
+def TestAction(kernel, nam, sleep=0, inputs=None, outputs=None):
   obj = Interface.createEventAction(kernel, str('DigiTestAction/' + nam))
   if sleep != 0:
     obj.sleep = sleep
+  if inputs:
+    obj.inputs = [str(i) for i in inputs]
+  if outputs:
+    obj.outputs = [str(o) for o in outputs]
   return obj
 # ---------------------------------------------------------------------------
 
@@ -337,6 +341,64 @@ class Digitize:
       seq.adopt(a)
     return (seq, actions)
 
+  """
+     Configure the input of DDG4 simulation output written by Geant4Output2ROOT
+
+     \author  M.Frank
+  """
+
+  def setupDDG4Input(self, name, input, containers=None, mask=0, io_threads=1):
+    inp = EventAction(self.kernel(), 'DigiDDG4Input/' + name)  # noqa: F405
+    if isinstance(input, str):
+      input = [input]
+    inp.Input = [str(i) for i in input]
+    if containers:
+      inp.Containers = [str(c) for c in containers]
+    inp.Mask = mask
+    inp.IOThreads = io_threads
+    self.kernel().inputAction().adopt(inp)
+    return inp
+
+  """
+     Configure the overlay of background events read from DDG4 simulation output.
+     sources: dictionary {name: {'input': files, 'mean': <events/bunch>, 'offset': <time>, 'pool': <size>}}
+     The signal deposits are read with input_mask, the merged deposits are written with mask.
+     The sources use the masks mask+1, mask+2, ...
+
+     \author  M.Frank
+  """
+
+  def setupOverlay(self, name, sources, first_bunch=0, last_bunch=0, bunch_spacing=25.0, poisson=True,
+                   mask=1, input_mask=0):
+    mixer = Synchronize(self.kernel(), 'DigiOverlayMixer/' + name)
+    means = {}
+    offsets = {}
+    sizes = {}
+    for i, (src_name, src) in enumerate(sources.items()):
+      inp = EventAction(self.kernel(), 'DigiDDG4Input/' + src_name)  # noqa: F405
+      files = src['input']
+      if isinstance(files, str):
+        files = [files]
+      inp.Input = [str(f) for f in files]
+      # The pool events of every source use their own event data slots
+      inp.Mask = mask + 1 + i
+      mixer.adopt(inp)
+      means[str(src_name)] = float(src.get('mean', 1.0))
+      offsets[str(src_name)] = float(src.get('offset', 0.0))
+      if 'pool' in src:
+        sizes[str(src_name)] = int(src['pool'])
+    mixer.Mean = means
+    mixer.TimeOffset = offsets
+    mixer.PoolSize = sizes
+    mixer.FirstBunch = first_bunch
+    mixer.LastBunch = last_bunch
+    mixer.BunchSpacing = bunch_spacing
+    mixer.Poisson = poisson
+    mixer.InputMask = input_mask
+    mixer.Mask = mask
+    self.kernel().inputAction().adopt(mixer)
+    return mixer
+
   """
      Configure ROOT output for the event digitization
 
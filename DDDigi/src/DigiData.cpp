@@ -74,8 +74,70 @@ DigiEvent::DigiEvent(int ev_num)
   InstanceCount::increment(this);
 }
 
+/// Intializing constructor with the number of registered data slots
+DigiEvent::DigiEvent(int ev_num, size_t num_slots)
+  : ObjectExtensions(typeid(DigiEvent)), eventNumber(ev_num), slots(num_slots)
+{
+  InstanceCount::increment(this);
+}
+
 /// Default destructor
 DigiEvent::~DigiEvent()
 {
   InstanceCount::decrement(this);
 }
+
+/// Access slot data with range check
+shared_ptr<void>& DigiEvent::slotData(int slot)   {
+  if ( slot >= 0 && size_t(slot) < slots.size() )
+    return slots[slot];
+  except("DigiEvent","Invalid event data slot %d [%ld slots available].",slot,slots.size());
+  throw runtime_error("DigiEvent"); // Will never get here!
+}
+
+/// Access slot data with range check
+const shared_ptr<void>& DigiEvent::slotData(int slot)  const   {
+  if ( slot >= 0 && size_t(slot) < slots.size() )
+    return slots[slot];
+  except("DigiEvent","Invalid event data slot %d [%ld slots available].",slot,slots.size());
+  throw runtime_error("DigiEvent"); // Will never get here!
+}
+
+namespace {
+  const CaloDeposit::FunctionTable* cellTable()  {
+    static CaloDeposit::FunctionTable table = []  {
+      CaloDeposit::FunctionTable t;
+      t.cellID   = [](const void* p) { return ((const DigiCellDeposit*)p)->cellID;   };
+      t.flag     = [](const void* p) { return ((const DigiCellDeposit*)p)->flag;     };
+      t.position = [](const void* p) -> const Position& { return ((const DigiCellDeposit*)p)->position; };
+      t.deposit  = [](const void* p) { return ((const DigiCellDeposit*)p)->deposit;  };
+      t.time     = [](const void* p) { return ((const DigiCellDeposit*)p)->time;     };
+      return t;
+    }();
+    return &table;
+  }
+}
+
+/// Function table of merged cell deposits
+template <> const EnergyDeposit::FunctionTable*
+EnergyDeposit::vtable<EnergyDeposit::FunctionTable, DigiCellDeposit>()  {
+  return cellTable();
+}
+
+/// Function table of merged cell deposits
+template <> const CaloDeposit::FunctionTable*
+EnergyDeposit::vtable<CaloDeposit::FunctionTable, DigiCellDeposit>()  {
+  return cellTable();
+}
+
+/// Create the deposit wrappers of all cells
+void DigiCellDeposits::publish()   {
+  this->clear();
+  deposits.clear();
+  deposits.reserve(cells.size());
+  this->reserve(cells.size());
+  for( const auto& c : cells )   {
+    deposits.emplace_back(&c);
+    this->push_back(&deposits.back());
+  }
+}
@@ -13,7 +13,9 @@
 
 // Framework include files
 #include "DD4hep/InstanceCount.h"
+#include "DDDigi/DigiKernel.h"
 #include "DDDigi/DigiEventAction.h"
+#include "DDDigi/DigiSlotRegistry.h"
 
 /// Standard constructor
 dd4hep::digi::DigiEventAction::DigiEventAction(const DigiKernel& krnl, const std::string& nam)
@@ -35,3 +37,29 @@ bool dd4hep::digi::DigiEventAction::setExecuteParallel(bool new_value)    {
   return old;
 }
 
+/// Register an event data slot read or written by this action
+int dd4hep::digi::DigiEventAction::declareSlot(const Key& key, const std::string& nam,
+                                               const std::type_info& typ, bool output)   {
+  DigiSlotRegistry& registry = m_kernel.slotRegistry();
+  int slot = registry.add(key, nam, typ);
+  if ( output )   {
+    registry.addProducer(slot, name());
+    m_outputs.emplace_back(slot);
+  }
+  else   {
+    registry.addConsumer(slot, name());
+    m_inputs.emplace_back(slot);
+  }
+  debug("+++ Declared %s event data slot %d: %s", output ? "output" : "input", slot, nam.c_str());
+  return slot;
+}
+
+/// Collect the event data slots read and written by this action
+void dd4hep::digi::DigiEventAction::dataDependencies(std::set<int>& inputs, std::set<int>& outputs)  const  {
+  inputs.insert(m_inputs.begin(), m_inputs.end());
+  outputs.insert(m_outputs.begin(), m_outputs.end());
+}
+
+/// Check the data dependencies of concurrently executing actions. Default: nothing to check
+void dd4hep::digi::DigiEventAction::checkDependencies()  const  {
+}
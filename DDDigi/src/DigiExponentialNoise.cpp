@@ -15,8 +15,13 @@
 #include "DD4hep/InstanceCount.h"
 #include "DDDigi/DigiSegmentation.h"
 #include "DDDigi/DigiRandomGenerator.h"
+#include "DDDigi/DigiContext.h"
 #include "DDDigi/DigiExponentialNoise.h"
 
+// C/C++ include files
+#include <algorithm>
+#include <cmath>
+
 using namespace dd4hep::digi;
 
 /// Standard constructor
@@ -36,3 +41,19 @@ DigiExponentialNoise::~DigiExponentialNoise() {
 double DigiExponentialNoise::operator()(DigiCellContext& context)  const  {
   return context.context.randomGenerator().exponential(m_tau);
 }
+
+/// Batched callback: compute the noise of n cells with the given signals
+void DigiExponentialNoise::process(DigiContext& context, const double* /* signals */, double* noise, std::size_t n)  const  {
+  context.randomGenerator().exponential(noise, n, m_tau);
+}
+
+/// Probability that the noise of a channel without signal exceeds the threshold
+double DigiExponentialNoise::tailProbability(double threshold)  const  {
+  return threshold <= 0e0 ? 1e0 : std::exp(-threshold / m_tau);
+}
+
+/// Draw the noise of a channel without signal under the condition that it exceeds the threshold
+double DigiExponentialNoise::drawAbove(DigiContext& context, double threshold)  const  {
+  // The exponential distribution is memoryless
+  return std::max(threshold, 0e0) + context.randomGenerator().exponential(m_tau);
+}
@@ -15,8 +15,13 @@
 #include "DD4hep/InstanceCount.h"
 #include "DDDigi/DigiSegmentation.h"
 #include "DDDigi/DigiRandomGenerator.h"
+#include "DDDigi/DigiContext.h"
 #include "DDDigi/DigiGaussianNoise.h"
 
+// ROOT include files
+#include "Math/ProbFuncMathCore.h"
+#include "Math/QuantFuncMathCore.h"
+
 using namespace dd4hep::digi;
 
 /// Standard constructor
@@ -40,3 +45,22 @@ double DigiGaussianNoise::operator()(DigiCellContext& context)  const  {
     return 0;
   return context.context.randomGenerator().gaussian(m_mean,m_sigma);
 }
+
+/// Batched callback: compute the noise of n cells with the given signals
+void DigiGaussianNoise::process(DigiContext& context, const double* signals, double* noise, std::size_t n)  const  {
+  context.randomGenerator().gaussian(noise, n, m_mean, m_sigma);
+  for( std::size_t i = 0; i < n; ++i )
+    noise[i] = signals[i] < m_cutoff ? 0e0 : noise[i];
+}
+
+/// Probability that the noise of a channel without signal exceeds the threshold
+double DigiGaussianNoise::tailProbability(double threshold)  const  {
+  if ( 0e0 < m_cutoff ) return 0e0;     // Channels without signal are not processed
+  return ROOT::Math::normal_cdf_c(threshold, m_sigma, m_mean);
+}
+
+/// Draw the noise of a channel without signal under the condition that it exceeds the threshold
+double DigiGaussianNoise::drawAbove(DigiContext& context, double threshold)  const  {
+  double tail = ROOT::Math::normal_cdf_c(threshold, m_sigma, m_mean);
+  return m_mean + ROOT::Math::normal_quantile_c(tail * context.randomGenerator().random(), m_sigma);
+}
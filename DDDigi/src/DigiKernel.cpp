@@ -22,6 +22,8 @@
 #include "DDDigi/DigiKernel.h"
 #include "DDDigi/DigiContext.h"
 #include "DDDigi/DigiActionSequence.h"
+#include "DDDigi/DigiSlotRegistry.h"
+#include "DDDigi/DigiRandomGenerator.h"
 
 #ifdef DD4HEP_USE_TBB
 #include "tbb/tbb.h"
@@ -32,6 +34,7 @@
 #include <algorithm>
 #include <memory>
 #include <chrono>
+#include <random>
 
 using namespace std;
 using namespace dd4hep;
@@ -62,6 +65,8 @@ public:
   DigiActionSequence*   eventAction = 0;
   /// The main data output action sequence
   DigiActionSequence*   outputAction = 0;
+  /// Registry of the event data slots
+  DigiSlotRegistry      slots;
   /// TBB initializer (If TBB is used)
   void*                 tbbInit = 0;
   /// Property: Output level
@@ -74,6 +79,10 @@ public:
   int                   numThreads;
   /// Property: Allow to stop execution from interactive prompt
   bool                  stop = false;
+  /// Flag to indicate that the actions were initialized
+  bool                  initialized = false;
+  /// Property: Seed of the random generators. Each event is seeded with seed and event number
+  unsigned long         seed = 123456789;
   Internals() = default;
   ~Internals() = default;
 };
@@ -125,7 +134,7 @@ public:
       if ( todo >= 0 )   {
         int ev_num = kernel.internals->numEvents - todo;
         unique_ptr<DigiContext> c(new DigiContext(&kernel));
-        unique_ptr<DigiEvent>   e(new DigiEvent(ev_num));
+        unique_ptr<DigiEvent>   e(new DigiEvent(ev_num, kernel.internals->slots.size()));
         c->setEvent(e.release());
         kernel.executeEvent(c.release());
       }
@@ -148,6 +157,7 @@ DigiKernel::DigiKernel(Detector& description_ref)
   declareProperty("numThreads",       internals->numThreads);
   declareProperty("numEvents",        internals->numEvents = 10);
   declareProperty("stop",             internals->stop = false);
+  declareProperty("Seed",             internals->seed);
   declareProperty("OutputLevel",      internals->outputLevel = DEBUG);
   declareProperty("OutputLevels",     internals->clientLevels);
   internals->inputAction  = new DigiActionSequence(*this, "InputAction");
@@ -212,6 +222,16 @@ PrintLevel DigiKernel::outputLevel() const  {
   return (PrintLevel)internals->outputLevel;
 }
 
+/// Access to the maximum number of events processed in parallel
+int DigiKernel::maxEventsParallel() const  {
+  return internals->maxEventsParallel;
+}
+
+/// Access to the number of worker threads
+int DigiKernel::numThreads() const  {
+  return internals->numThreads;
+}
+
 /// Fill cache with the global output level of a named object. Must be set before instantiation
 void DigiKernel::setOutputLevel(const std::string object, PrintLevel new_level)   {
   internals->clientLevels[object] = new_level;
@@ -247,8 +267,35 @@ int DigiKernel::configure()   {
   return 1;//DigiExec::configure(*this);
 }
 
+/// Initialize all actions, freeze the event data slots and check the data dependencies
 int DigiKernel::initialize()   {
-  return 1;//DigiExec::initialize(*this);
+  if ( internals->initialized )
+    return 1;
+  inputAction().initialize();
+  eventAction().initialize();
+  outputAction().initialize();
+  DigiSlotRegistry& registry = internals->slots;
+  registry.freeze();
+  // Conflicts of parallel actions first: they are reported with the names of both actions
+  inputAction().checkDependencies();
+  eventAction().checkDependencies();
+  outputAction().checkDependencies();
+  for( size_t i = 0; i < registry.size(); ++i )   {
+    const DigiSlotRegistry::Entry& e = registry.entry(int(i));
+    if ( e.producers.size() > 1 )   {
+      string names;
+      for( const auto& n : e.producers ) names += " " + n;
+      except("DigiKernel","+++ Event data slot %s is written by %ld actions:%s",
+             e.name.c_str(), e.producers.size(), names.c_str());
+    }
+    else if ( e.producers.empty() )   {
+      printout(WARNING,"DigiKernel","+++ Event data slot %s is read by %ld actions, but never written.",
+               e.name.c_str(), e.consumers.size());
+    }
+  }
+  internals->initialized = true;
+  printout(INFO,"DigiKernel","+++ Initialized actions with %ld event data slots.", registry.size());
+  return 1;
 }
 
 /// Access to the main input action sequence from the kernel object
@@ -266,6 +313,11 @@ DigiActionSequence& DigiKernel::outputAction() const    {
   return *internals->outputAction;
 }
 
+/// Access to the registry of the event data slots
+DigiSlotRegistry& DigiKernel::slotRegistry() const    {
+  return internals->slots;
+}
+
 void DigiKernel::submit(const DigiAction::Actors<DigiEventAction>& actions, DigiContext& context)   const  {
   chrono::system_clock::time_point start = chrono::system_clock::now();
   bool parallel = 0 != internals->tbbInit && internals->numThreads>0;
@@ -300,6 +352,16 @@ void DigiKernel::wait(DigiContext& context)   const  {
 void DigiKernel::executeEvent(DigiContext* context)    {
   DigiContext& refContext = *context;
   try {
+    if ( !context->m_random )   {
+      unsigned long ev_num = context->eventPtr() ? context->eventPtr()->eventNumber : 0;
+      unsigned long ev_key = internals->seed ^ (ev_num * 0x9E3779B97F4A7C15UL);
+      auto engine = make_shared<mt19937_64>(ev_key);
+      auto random = make_shared<DigiRandomGenerator>();
+      random->key = ev_key;
+      // Uniform on ]0, 1] as required by DigiRandomGenerator
+      random->engine = [engine]()  { return (double((*engine)() >> 11) + 1.0) / 9007199254740992.0; };
+      context->m_random = move(random);
+    }
     inputAction().execute(refContext);
     eventAction().execute(refContext);
     outputAction().execute(refContext);
@@ -330,6 +392,7 @@ void DigiKernel::notify(DigiContext* context, const std::exception& e)   {
 
 int DigiKernel::run()   {
   chrono::system_clock::time_point start = chrono::system_clock::now();
+  initialize();
   internals->stop = false;
   internals->eventsToDo = internals->numEvents;
   printout(INFO,
@@ -46,6 +46,18 @@ void DigiLockedAction::use(DigiEventAction* action)   {
   fatal("DigiLockedAction: Attempt to use invalid actor!");
 }
 
+/// Initialize the underlying action
+void DigiLockedAction::initialize()   {
+  this->DigiEventAction::initialize();
+  if ( m_action ) m_action->initialize();
+}
+
+/// Collect the event data slots of the underlying action
+void DigiLockedAction::dataDependencies(set<int>& inputs, set<int>& outputs)  const   {
+  this->DigiEventAction::dataDependencies(inputs, outputs);
+  if ( m_action ) m_action->dataDependencies(inputs, outputs);
+}
+
 /// Pre-track action callback
 void DigiLockedAction::execute(DigiContext& context)  const   {
   if (m_action) {
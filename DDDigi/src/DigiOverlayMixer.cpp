@@ -0,0 +1,294 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "DD4hep/InstanceCount.h"
+#include "DDDigi/DigiKernel.h"
+#include "DDDigi/DigiContext.h"
+#include "DDDigi/DigiOverlayMixer.h"
+#include "DDDigi/DigiSlotRegistry.h"
+
+// C/C++ include files
+#include <unordered_map>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <cmath>
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::digi;
+
+namespace {
+  typedef chrono::steady_clock clock_type;
+  /// Time since the start of the program in seconds
+  double now()   {
+    static const clock_type::time_point start = clock_type::now();
+    return chrono::duration<double>(clock_type::now() - start).count();
+  }
+}
+
+/// Pool of background events of all sources
+/**
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_DIGITIZATION
+ */
+class DigiOverlayMixer::pool_t  {
+public:
+  /// Energy deposits of one background event indexed by the merged container
+  typedef vector<shared_ptr<DigiEnergyDeposits> > event_t;
+  /// Background source
+  class source_t  {
+  public:
+    /// Name of the source
+    string          name;
+    /// Mean number of events per bunch crossing
+    double          mean   = 0e0;
+    /// Time offset of the source
+    double          offset = 0e0;
+    /// Background events
+    vector<event_t> events;
+  };
+  /// Background sources
+  vector<source_t> sources;
+};
+
+/// Standard constructor
+DigiOverlayMixer::DigiOverlayMixer(const DigiKernel& kernel, const string& nam)
+  : DigiSynchronize(kernel, nam)
+{
+  declareProperty("Mean",            m_mean);
+  declareProperty("TimeOffset",      m_offset);
+  declareProperty("PoolSize",        m_pool_size);
+  declareProperty("DefaultPoolSize", m_default_pool_size);
+  declareProperty("FirstBunch",      m_first_bunch);
+  declareProperty("LastBunch",       m_last_bunch);
+  declareProperty("BunchSpacing",    m_bunch_spacing);
+  declareProperty("Poisson",         m_poisson);
+  declareProperty("Containers",      m_containers);
+  declareProperty("InputMask",       m_input_mask);
+  declareProperty("Mask",            m_mask);
+  InstanceCount::increment(this);
+}
+
+/// Default destructor
+DigiOverlayMixer::~DigiOverlayMixer() {
+  if ( m_num_events > 0 )   {
+    double wall = m_last_end - m_first_start;
+    info("+++ Mixed %ld events [%ld deposits]: %.3f msec/event. "
+         "Throughput: %.2f events/second with %d threads [%d events in parallel].",
+         m_num_events, m_num_deposits, 1e3*m_mix_time/double(m_num_events),
+         wall > 0e0 ? double(m_num_events)/wall : 0e0,
+         m_kernel.numThreads(), m_kernel.maxEventsParallel());
+  }
+  m_pool.reset();
+  InstanceCount::decrement(this);
+}
+
+/// Declare the event data slots of the signal and the merged deposits
+void DigiOverlayMixer::initialize()   {
+  // The sources declare their outputs first
+  this->DigiSynchronize::initialize();
+  if ( m_mask == m_input_mask )   {
+    except("+++ The mask of the merged deposits must differ from the input mask %d.", m_input_mask);
+  }
+  const DigiSlotRegistry& registry = m_kernel.slotRegistry();
+  vector<map<string, int> > source_slots(m_actors.size());
+  set<string> names;
+  for( size_t i = 0; i < m_actors.size(); ++i )   {
+    set<int> inputs, outputs;
+    m_actors[i]->dataDependencies(inputs, outputs);
+    for( int slot : outputs )   {
+      const DigiSlotRegistry::Entry& e = registry.entry(slot);
+      if ( *e.type == typeid(DigiEnergyDeposits) )   {
+        source_slots[i][e.name] = slot;
+        names.insert(e.name);
+      }
+    }
+  }
+  size_t num_signal = 0;
+  for( size_t i = 0; i < registry.size(); ++i )   {
+    const DigiSlotRegistry::Entry& e = registry.entry(int(i));
+    if ( *e.type == typeid(DigiEnergyDeposits) && e.key.values.mask == m_input_mask )  {
+      names.insert(e.name);
+      ++num_signal;
+    }
+  }
+  // The signal slots are only known if the signal input was initialized before
+  if ( 0 == num_signal )   {
+    except("+++ No signal deposits with mask %d are declared. "
+           "The signal input must be executed before the mixer.", m_input_mask);
+  }
+  if ( !m_containers.empty() )  {
+    names.clear();
+    names.insert(m_containers.begin(), m_containers.end());
+  }
+  for( const auto& nam : names )   {
+    item_t item;
+    item.name = nam;
+    if ( registry.slot(Key(m_input_mask, nam)) >= 0 )
+      item.input = declareInput<DigiEnergyDeposits>(nam, m_input_mask);
+    else
+      warning("+++ No signal deposits %s with mask %d: only the background is merged.",
+              nam.c_str(), m_input_mask);
+    item.output = declareOutput<DigiEnergyDeposits>(nam, m_mask);
+    for( const auto& slots : source_slots )   {
+      auto i = slots.find(nam);
+      item.sources.emplace_back(i == slots.end() ? -1 : (*i).second);
+    }
+    m_items.emplace_back(move(item));
+  }
+  info("+++ Merging %ld deposit containers of the signal and %ld sources.",
+       m_items.size(), m_actors.size());
+}
+
+/// Only the slots of the mixer are used by the event. The sources fill the pool
+void DigiOverlayMixer::dataDependencies(set<int>& inputs, set<int>& outputs)  const   {
+  this->DigiEventAction::dataDependencies(inputs, outputs);
+}
+
+/// The sources are executed sequentially when filling the pool: nothing to check
+void DigiOverlayMixer::checkDependencies()  const   {
+}
+
+/// Fill the background pools of all sources
+void DigiOverlayMixer::fillPool()   {
+  auto pool = make_shared<pool_t>();
+  double start = now();
+  size_t num_events = 0;
+  for( size_t k = 0; k < m_actors.size(); ++k )   {
+    DigiEventAction* action = m_actors[k];
+    pool_t::source_t src;
+    const string& nam = action->name();
+    auto im = m_mean.find(nam);
+    auto io = m_offset.find(nam);
+    auto is = m_pool_size.find(nam);
+    int  size = is == m_pool_size.end() ? m_default_pool_size : (*is).second;
+    src.name   = nam;
+    src.mean   = im == m_mean.end()   ? 1e0 : (*im).second;
+    src.offset = io == m_offset.end() ? 0e0 : (*io).second;
+    src.events.reserve(size);
+    DigiContext context(&m_kernel);
+    for( int i = 0; i < size; ++i )   {
+      DigiEvent event(i, m_kernel.slotRegistry().size());
+      context.setEvent(&event);
+      try  {
+        action->execute(context);
+      }
+      catch(const exception& e)   {
+        context.setEvent(0);
+        if ( src.events.empty() ) throw;
+        warning("+++ Source %s: pool limited to %ld events: %s", nam.c_str(), src.events.size(), e.what());
+        break;
+      }
+      context.setEvent(0);
+      pool_t::event_t deposits(m_items.size());
+      for( size_t j = 0; j < m_items.size(); ++j )   {
+        int slot = m_items[j].sources[k];
+        if ( slot >= 0 )
+          deposits[j] = static_pointer_cast<DigiEnergyDeposits>(event.slotData(slot));
+      }
+      src.events.emplace_back(move(deposits));
+    }
+    info("+++ Source %-24s pool: %6ld events  mean: %7.2f  time offset: %7.2f",
+         nam.c_str(), src.events.size(), src.mean, src.offset);
+    num_events += src.events.size();
+    pool->sources.emplace_back(move(src));
+  }
+  info("+++ Filled background pools with %ld events in %.2f seconds.", num_events, now() - start);
+  m_pool = move(pool);
+}
+
+/// Overlay the background events on the signal event
+void DigiOverlayMixer::execute(DigiContext& context)  const   {
+  call_once(m_pool_filled, [this] { const_cast<DigiOverlayMixer*>(this)->fillPool(); });
+  typedef vector<pair<const DigiEnergyDeposits*, double> > inputs_t;
+  double start = now();
+  const DigiRandomGenerator& rndm = context.randomGenerator();
+  DigiEvent& event = context.event();
+  vector<inputs_t> inputs(m_items.size());
+  size_t num_deposits = 0;
+
+  // The signal event: bunch 0 without time shift
+  for( size_t j = 0; j < m_items.size(); ++j )   {
+    if ( m_items[j].input.isValid() )   {
+      const DigiEnergyDeposits& deposits = event.get(m_items[j].input);
+      inputs[j].emplace_back(&deposits, 0e0);
+      num_deposits += deposits.size();
+    }
+  }
+  // Draw the background events of all bunch crossings
+  for( const auto& src : m_pool->sources )   {
+    if ( src.events.empty() ) continue;
+    for( int bunch = m_first_bunch; bunch <= m_last_bunch; ++bunch )   {
+      double shift = double(bunch) * m_bunch_spacing + src.offset;
+      int    count = m_poisson ? int(rndm.poisson(src.mean)) : int(std::round(src.mean));
+      for( int i = 0; i < count; ++i )   {
+        size_t which = min(src.events.size()-1, size_t(rndm.uniform(double(src.events.size()))));
+        const pool_t::event_t& deposits = src.events[which];
+        for( size_t j = 0; j < deposits.size(); ++j )   {
+          if ( deposits[j] )   {
+            inputs[j].emplace_back(deposits[j].get(), shift);
+            num_deposits += deposits[j]->size();
+          }
+        }
+      }
+    }
+  }
+  // Merge the deposits by cellID
+  unordered_map<long long int, size_t> cells;
+  for( size_t j = 0; j < m_items.size(); ++j )   {
+    auto merged = make_shared<DigiCellDeposits>(m_items[j].name);
+    size_t total = 0;
+    for( const auto& c : inputs[j] ) total += c.first->size();
+    cells.clear();
+    cells.reserve(total);
+    merged->cells.reserve(total);
+    for( const auto& c : inputs[j] )   {
+      for( const EnergyDeposit* dep : *c.first )   {
+        auto ret = cells.emplace(dep->cellID(), merged->cells.size());
+        if ( ret.second )   {
+          merged->cells.emplace_back();
+          DigiCellDeposit& cell = merged->cells.back();
+          cell.cellID   = dep->cellID();
+          cell.flag     = dep->flag();
+          cell.position = dep->position();
+          cell.deposit  = dep->deposit();
+          cell.time     = dep->time() + c.second;
+          cell.contributions = 1;
+          continue;
+        }
+        DigiCellDeposit& cell = merged->cells[(*ret.first).second];
+        cell.flag    |= dep->flag();
+        cell.deposit += dep->deposit();
+        cell.time     = min(cell.time, dep->time() + c.second);
+        ++cell.contributions;
+      }
+    }
+    merged->publish();
+    event.put(m_items[j].output, shared_ptr<DigiEnergyDeposits>(move(merged)));
+  }
+  double end = now();
+  {
+    lock_guard<mutex> lock(m_stat_lock);
+    if ( m_first_start < 0e0 ) m_first_start = start;
+    m_last_end = max(m_last_end, end);
+    m_mix_time += end - start;
+    m_num_deposits += num_deposits;
+    ++m_num_events;
+  }
+  debug("+++ Event: %8d merged %ld deposits of %ld containers [%8.3g sec]",
+        event.eventNumber, num_deposits, m_items.size(), end - start);
+}
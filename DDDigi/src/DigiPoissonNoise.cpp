@@ -16,6 +16,7 @@
 #include "DDDigi/DigiPoissonNoise.h"
 #include "DDDigi/DigiSegmentation.h"
 #include "DDDigi/DigiRandomGenerator.h"
+#include "DDDigi/DigiContext.h"
 
 using namespace dd4hep::digi;
 
@@ -39,3 +40,10 @@ double DigiPoissonNoise::operator()(DigiCellContext& context)  const  {
     return 0;
   return context.context.randomGenerator().poisson(m_mean);
 }
+
+/// Batched callback: compute the noise of n cells with the given signals
+void DigiPoissonNoise::process(DigiContext& context, const double* signals, double* noise, std::size_t n)  const  {
+  context.randomGenerator().poisson(noise, n, m_mean);
+  for( std::size_t i = 0; i < n; ++i )
+    noise[i] = signals[i] >= m_cutoff ? 0e0 : noise[i];
+}
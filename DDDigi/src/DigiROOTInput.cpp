@@ -0,0 +1,353 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "DD4hep/Printout.h"
+#include "DD4hep/InstanceCount.h"
+#include "DDDigi/DigiROOTInput.h"
+#include "DDDigi/DigiContext.h"
+#include "DDDigi/DigiKernel.h"
+
+// ROOT include files
+#include "TROOT.h"
+#include "TFile.h"
+#include "TTree.h"
+#include "TBranch.h"
+#include "TClass.h"
+#include "TVirtualCollectionProxy.h"
+
+// C/C++ include files
+#include <condition_variable>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <mutex>
+#include <map>
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::digi;
+
+namespace  {
+  /// Delete a deserialized branch object
+  /**
+   *  Collections of pointers, e.g. vector<Geant4Particle*>, own their elements.
+   *  These are deleted before the collection itself. The proxy of the class
+   *  is cloned, because the objects may be deleted concurrently.
+   */
+  void destroy(TClass* cl, void* object)   {
+    TVirtualCollectionProxy* proxy = cl->GetCollectionProxy();
+    if ( proxy && proxy->HasPointers() )   {
+      unique_ptr<TVirtualCollectionProxy> p(proxy->Generate());
+      TVirtualCollectionProxy::TPushPop env(p.get(), object);
+      p->Clear("force");
+    }
+    cl->Destructor(object);
+  }
+}
+
+/// Internal implementation of the DigiROOTInput: I/O threads and read-ahead buffer
+/**
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_DIGITIZATION
+ */
+class DigiROOTInput::internals_t  {
+public:
+  /// Deserialized branch objects of one tree entry
+  class record_t  {
+  public:
+    vector<container_t> containers;
+    record_t() = default;
+    record_t(const record_t& copy) = delete;
+    record_t& operator=(const record_t& copy) = delete;
+    ~record_t()   {
+      for( auto& c : containers )
+        if ( c.object && c.clazz ) destroy(c.clazz, c.object);
+    }
+  };
+  /// File and tree handles of one I/O thread
+  class reader_t  {
+  public:
+    unique_ptr<TFile> file;
+    TTree*            tree  = 0;
+    long              index = -1;
+    vector<TBranch*>  branches;
+  };
+
+  /// Reference to the owning input action
+  const DigiROOTInput*  input;
+  /// Entry offsets of the input files
+  vector<Long64_t>      offsets;
+  /// Read-ahead buffer of records indexed by entry number
+  map<Long64_t, unique_ptr<record_t> > buffer;
+  /// I/O threads
+  vector<thread>        threads;
+  /// Protection of the read-ahead buffer
+  mutex                 lock;
+  /// Signal new records in the buffer
+  condition_variable    produced;
+  /// Signal records taken from the buffer
+  condition_variable    consumed;
+  /// Flag to start the I/O threads once
+  once_flag             started;
+  /// Error message of an I/O thread
+  string                error;
+  /// Total number of entries of all input files
+  Long64_t              total = 0;
+  /// Next entry to be handed to an event
+  Long64_t              next = 0;
+  /// Maximum number of entries read ahead
+  Long64_t              read_ahead = 1;
+  /// Flag to stop the I/O threads
+  bool                  stop = false;
+
+public:
+  /// Initializing constructor
+  internals_t(const DigiROOTInput* inp) : input(inp)  {}
+  /// Default destructor: stop the I/O threads
+  ~internals_t()  {
+    {
+      lock_guard<mutex> guard(lock);
+      stop = true;
+    }
+    consumed.notify_all();
+    for( auto& t : threads ) t.join();
+  }
+  /// Open the input files, count the entries and start the I/O threads
+  void start();
+  /// I/O thread body: read every num_threads-th entry starting at first
+  void run(Long64_t first, Long64_t num_threads);
+  /// Access the branches to be read from a tree
+  void branches(TTree* tree, const string& fname, vector<TBranch*>& result)  const;
+  /// Read and deserialize one entry
+  unique_ptr<record_t> read(reader_t& reader, Long64_t entry)  const;
+  /// Take the record of the given entry from the buffer. Waits until it is read.
+  unique_ptr<record_t> take(Long64_t entry);
+};
+
+/// Open the input files, count the entries and start the I/O threads
+void DigiROOTInput::internals_t::start()   {
+  const auto& files = input->m_input;
+  if ( files.empty() )  {
+    input->except("+++ No input files specified!");
+  }
+  for( const auto& fname : files )   {
+    unique_ptr<TFile> file(TFile::Open(fname.c_str()));
+    if ( !file || file->IsZombie() )   {
+      input->except("+++ Failed to open input file: %s", fname.c_str());
+    }
+    TTree* tree = (TTree*)file->Get(input->m_tree_name.c_str());
+    if ( !tree )   {
+      input->except("+++ No tree %s present in input file: %s",
+                    input->m_tree_name.c_str(), fname.c_str());
+    }
+    offsets.push_back(total);
+    total += tree->GetEntries();
+    input->info("+++ Input file: %s [%lld entries]", fname.c_str(), tree->GetEntries());
+  }
+  int num_threads = max(1, input->m_io_threads);
+  int ahead = input->m_read_ahead > 0 ? input->m_read_ahead : input->m_kernel.maxEventsParallel();
+  read_ahead = max(max(1, ahead), num_threads);
+  ROOT::EnableThreadSafety();
+  for( int i = 0; i < num_threads; ++i )
+    threads.emplace_back(&internals_t::run, this, Long64_t(i), Long64_t(num_threads));
+  input->info("+++ Started %d I/O threads. Read-ahead: %lld entries out of %lld.",
+              num_threads, read_ahead, total);
+}
+
+/// I/O thread body: read every num_threads-th entry starting at first
+void DigiROOTInput::internals_t::run(Long64_t first, Long64_t num_threads)   {
+  reader_t reader;
+  for( Long64_t entry = first; entry < total; entry += num_threads )   {
+    {
+      unique_lock<mutex> guard(lock);
+      consumed.wait(guard, [this, entry] { return stop || entry < next + read_ahead; });
+      if ( stop ) return;
+    }
+    try  {
+      unique_ptr<record_t> record = read(reader, entry);
+      lock_guard<mutex> guard(lock);
+      buffer.emplace(entry, move(record));
+    }
+    catch(const exception& e)   {
+      lock_guard<mutex> guard(lock);
+      error = e.what();
+      stop  = true;
+    }
+    produced.notify_all();
+  }
+}
+
+/// Access the branches to be read from a tree
+void DigiROOTInput::internals_t::branches(TTree* tree, const string& fname, vector<TBranch*>& result)  const  {
+  if ( input->m_containers.empty() )   {
+    TObjArray* list = tree->GetListOfBranches();
+    for( Int_t i = 0, n = list->GetEntriesFast(); i < n; ++i )
+      result.push_back((TBranch*)list->UncheckedAt(i));
+    return;
+  }
+  for( const auto& nam : input->m_containers )   {
+    TBranch* branch = tree->GetBranch(nam.c_str());
+    if ( !branch )   {
+      input->except("+++ No branch %s present in input file: %s", nam.c_str(), fname.c_str());
+    }
+    result.push_back(branch);
+  }
+}
+
+/// Read and deserialize one entry
+unique_ptr<DigiROOTInput::internals_t::record_t>
+DigiROOTInput::internals_t::read(reader_t& reader, Long64_t entry)  const  {
+  long index = long(upper_bound(offsets.begin(), offsets.end(), entry) - offsets.begin()) - 1;
+  if ( index != reader.index )   {
+    const string& fname = input->m_input[index];
+    reader.branches.clear();
+    reader.tree = 0;
+    reader.file.reset(TFile::Open(fname.c_str()));
+    if ( !reader.file || reader.file->IsZombie() )   {
+      input->except("+++ Failed to open input file: %s", fname.c_str());
+    }
+    reader.tree = (TTree*)reader.file->Get(input->m_tree_name.c_str());
+    if ( !reader.tree )   {
+      input->except("+++ No tree %s present in input file: %s",
+                    input->m_tree_name.c_str(), fname.c_str());
+    }
+    branches(reader.tree, fname, reader.branches);
+    reader.index = index;
+  }
+  Long64_t local = entry - offsets[index];
+  unique_ptr<record_t> record(new record_t());
+  record->containers.resize(reader.branches.size());
+  for( size_t i = 0; i < reader.branches.size(); ++i )   {
+    TBranch*     branch = reader.branches[i];
+    container_t& cont   = record->containers[i];
+    cont.name  = branch->GetName();
+    cont.clazz = TClass::GetClass(branch->GetClassName());
+    if ( !cont.clazz )   {
+      input->except("+++ No dictionary present for branch %s of type %s",
+                    cont.name.c_str(), branch->GetClassName());
+    }
+    auto is = input->m_slots.find(cont.name);
+    if ( is == input->m_slots.end() )   {
+      input->except("+++ Branch %s of input file %s was not declared at initialization.",
+                    cont.name.c_str(), input->m_input[index].c_str());
+    }
+    cont.slot = (*is).second;
+    cont.object = cont.clazz->New();
+    branch->SetAddress(&cont.object);
+    if ( branch->GetEntry(local) <= 0 )   {
+      input->except("+++ Failed to read entry %lld of branch %s", local, cont.name.c_str());
+    }
+  }
+  return record;
+}
+
+/// Take the record of the given entry from the buffer. Waits until it is read.
+unique_ptr<DigiROOTInput::internals_t::record_t> DigiROOTInput::internals_t::take(Long64_t entry)   {
+  unique_ptr<record_t> record;
+  {
+    unique_lock<mutex> guard(lock);
+    produced.wait(guard, [this, entry] { return !error.empty() || buffer.find(entry) != buffer.end(); });
+    auto i = buffer.find(entry);
+    if ( i == buffer.end() )   {
+      input->except("+++ Failed to read input entry %lld: %s", entry, error.c_str());
+    }
+    record = move((*i).second);
+    buffer.erase(i);
+  }
+  return record;
+}
+
+/// Standard constructor
+DigiROOTInput::DigiROOTInput(const DigiKernel& kernel, const string& nam)
+  : DigiInputAction(kernel, nam)
+{
+  declareProperty("Tree",       m_tree_name = "EVENT");
+  declareProperty("Containers", m_containers);
+  declareProperty("Mask",       m_mask);
+  declareProperty("ReadAhead",  m_read_ahead);
+  declareProperty("IOThreads",  m_io_threads);
+  imp.reset(new internals_t(this));
+  InstanceCount::increment(this);
+}
+
+/// Default destructor
+DigiROOTInput::~DigiROOTInput()   {
+  imp.reset();
+  InstanceCount::decrement(this);
+}
+
+/// Declare the event data slots of the input branches
+void DigiROOTInput::initialize()   {
+  this->DigiInputAction::initialize();
+  if ( m_input.empty() )  {
+    except("+++ No input files specified!");
+  }
+  const string& fname = m_input.front();
+  unique_ptr<TFile> file(TFile::Open(fname.c_str()));
+  if ( !file || file->IsZombie() )   {
+    except("+++ Failed to open input file: %s", fname.c_str());
+  }
+  TTree* tree = (TTree*)file->Get(m_tree_name.c_str());
+  if ( !tree )   {
+    except("+++ No tree %s present in input file: %s", m_tree_name.c_str(), fname.c_str());
+  }
+  vector<TBranch*> branches;
+  imp->branches(tree, fname, branches);
+  for( TBranch* branch : branches )   {
+    string  nam = branch->GetName();
+    TClass* cl  = TClass::GetClass(branch->GetClassName());
+    if ( !cl )   {
+      except("+++ No dictionary present for branch %s of type %s", nam.c_str(), branch->GetClassName());
+    }
+    m_slots[nam] = declareSlot(Key(m_mask, nam), nam, containerType(cl), true);
+  }
+  info("+++ Declared %ld event data slots with mask %d.", m_slots.size(), m_mask);
+}
+
+/// Type of the event data slot of a branch. Default: the branch class
+const type_info& DigiROOTInput::containerType(TClass* clazz)  const   {
+  const type_info* typ = clazz->GetTypeInfo();
+  return typ ? *typ : typeid(void);
+}
+
+/// Convert and store the data of one branch. Takes ownership of the object.
+void DigiROOTInput::convert(DigiContext& context, container_t& container)  const  {
+  TClass* cl = container.clazz;
+  shared_ptr<void>& entry = context.event().slotData(container.slot);
+  if ( entry )   {
+    except("+++ Event data slot of container %s is already filled.", container.name.c_str());
+  }
+  entry = shared_ptr<void>(container.object, [cl](void* p) { destroy(cl, p); });
+  container.object = 0;
+}
+
+/// Callback to read event input
+void DigiROOTInput::execute(DigiContext& context)  const   {
+  call_once(imp->started, [this] { imp->start(); });
+  Long64_t entry = 0;
+  {
+    lock_guard<mutex> guard(imp->lock);
+    entry = imp->next++;
+  }
+  imp->consumed.notify_all();
+  if ( entry >= imp->total )   {
+    except("+++ End of input reached after %lld entries.", imp->total);
+  }
+  unique_ptr<internals_t::record_t> record = imp->take(entry);
+  for( auto& cont : record->containers )
+    convert(context, cont);
+  debug("+++ Event %d: read input entry %lld with %ld containers.",
+        context.event().eventNumber, entry, record->containers.size());
+}
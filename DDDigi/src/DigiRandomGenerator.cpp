@@ -25,9 +25,11 @@
 
 // Framework include files
 #include "DDDigi/DigiRandomGenerator.h"
+#include "DDDigi/Philox.h"
 #include <Math/ProbFuncMathCore.h>
 #include <Math/SpecFuncMathCore.h>
 #include "Math/QuantFuncMathCore.h"
+#include <algorithm>
 #include <cmath>
 
 
@@ -243,3 +245,77 @@ void   DigiRandomGenerator::circle(double &x, double &y, double r)   const  {
   x = r*std::cos(phi);
   y = r*std::sin(phi);
 }
+
+/// Batched call: fill array with uniform numbers in ]0, 1]
+void DigiRandomGenerator::random(double* values, std::size_t n)  const   {
+  std::uint64_t first = counter.fetch_add((n+1)/2);
+  dd4hep::detail::Philox4x32::uniform(values, n, key, first);
+}
+
+/// Batched call: fill array with uniform numbers in ]x1, x2]
+void DigiRandomGenerator::uniform(double* values, std::size_t n, double x1, double x2)  const   {
+  random(values, n);
+  const double width = x2 - x1;
+  for( std::size_t i = 0; i < n; ++i )
+    values[i] = x1 + width * values[i];
+}
+
+/// Batched call: fill array with exponentially distributed numbers
+void DigiRandomGenerator::exponential(double* values, std::size_t n, double tau)  const   {
+  random(values, n);
+  for( std::size_t i = 0; i < n; ++i )
+    values[i] = -tau * std::log(values[i]);
+}
+
+/// Batched call: fill array with gaussian numbers (Box-Muller)
+void DigiRandomGenerator::gaussian(double* values, std::size_t n, double mean, double sigma)  const   {
+  std::size_t m = n & ~std::size_t(1);
+  random(values, m);
+  for( std::size_t i = 0; i < m; i += 2 )   {
+    double r   = sigma * std::sqrt(-2.0 * std::log(values[i]));
+    double phi = TWOPI * values[i+1];
+    values[i]   = mean + r * std::cos(phi);
+    values[i+1] = mean + r * std::sin(phi);
+  }
+  if ( m < n )   {
+    double u[2];
+    random(u, 2);
+    values[m] = mean + sigma * std::sqrt(-2.0 * std::log(u[0])) * std::cos(TWOPI * u[1]);
+  }
+}
+
+/// Batched call: fill array with landau distributed numbers
+void DigiRandomGenerator::landau(double* values, std::size_t n, double mean, double sigma)  const   {
+  if ( sigma <= 0 )   {
+    std::fill(values, values+n, 0e0);
+    return;
+  }
+  random(values, n);
+  for( std::size_t i = 0; i < n; ++i )
+    values[i] = mean + ROOT::Math::landau_quantile(values[i], sigma);
+}
+
+/// Batched call: fill array with poisson distributed numbers
+void DigiRandomGenerator::poisson(double* values, std::size_t n, double mean)  const   {
+  if ( mean <= 0 )   {
+    std::fill(values, values+n, 0e0);
+    return;
+  }
+  if ( mean < 25 )   {
+    // Inversion of the cumulative distribution with one uniform number per value
+    const double expmean = std::exp(-mean);
+    random(values, n);
+    for( std::size_t i = 0; i < n; ++i )   {
+      double u = values[i], p = expmean, c = expmean;
+      int    k = 0;
+      while( u > c && k < 1000 )   {
+        p *= mean / double(++k);
+        c += p;
+      }
+      values[i] = double(k);
+    }
+    return;
+  }
+  for( std::size_t i = 0; i < n; ++i )
+    values[i] = poisson(mean);
+}
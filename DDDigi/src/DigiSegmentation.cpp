@@ -18,6 +18,9 @@
 #include <DD4hep/Plugins.h>
 #include <DD4hep/Shapes.h>
 
+// C/C++ include files
+#include <algorithm>
+
 
 std::shared_ptr<dd4hep::digi::DigiCellScanner>
 dd4hep::digi::create_cell_scanner(Solid solid, Segmentation segment)   {
@@ -41,3 +44,38 @@ dd4hep::digi::create_cell_scanner(const std::string& typ, Segmentation segment)
   }
   return std::shared_ptr<DigiCellScanner>(scan);
 }
+
+/// Initializing constructor
+dd4hep::digi::DigiCellAxis::DigiCellAxis(const DDSegmentation::BitFieldElement& field, double size, double off)
+  : grid_size(size), offset(off), mask(field.mask()), f_offset(field.offset()),
+    min_bin(field.minValue()), max_bin(field.maxValue())
+{
+  if ( grid_size <= 1e-10 )   {
+    except("DigiCellAxis","Invalid cell size %g of field %s", size, field.name().c_str());
+  }
+}
+
+/// Range of bins [first, last] covering the interval [lo, hi]
+std::pair<long, long> dd4hep::digi::DigiCellAxis::bins(double lo, double hi)  const   {
+  return std::make_pair(std::max(min_bin, bin(lo)), std::min(max_bin, bin(hi)));
+}
+
+/// Cache key in addition to the solid (e.g. the sub-segmentation). Default: 0
+long dd4hep::digi::DigiCellScanner::cache_key(VolumeID /* vid */)  const   {
+  return 0;
+}
+
+/// Access the cells contained in a solid. Builds the cache entry if required
+const dd4hep::digi::DigiCellScanner::cells_t&
+dd4hep::digi::DigiCellScanner::cells(Solid solid, VolumeID vid)  const   {
+  auto key = std::make_pair(solid.ptr(), cache_key(vid));
+  std::lock_guard<std::mutex> lock(m_cells_lock);
+  auto i = m_cells.find(key);
+  if ( i == m_cells.end() )   {
+    cells_t cells;
+    build_cells(solid, vid, cells);
+    cells.shrink_to_fit();
+    i = m_cells.emplace(key, std::move(cells)).first;
+  }
+  return i->second;
+}
@@ -13,8 +13,14 @@
 
 // Framework include files
 #include "DD4hep/InstanceCount.h"
+#include "DDDigi/DigiContext.h"
+#include "DDDigi/DigiSegmentation.h"
+#include "DDDigi/DigiRandomGenerator.h"
 #include "DDDigi/DigiSignalProcessor.h"
 
+// C/C++ include files
+#include <cmath>
+
 /// Standard constructor
 dd4hep::digi::DigiSignalProcessor::DigiSignalProcessor(const DigiKernel& krnl, const std::string& nam)
   : DigiAction(krnl, nam)
@@ -32,3 +38,58 @@ void dd4hep::digi::DigiSignalProcessor::initialize()   {
   m_initialized = true;
 }
 
+/// Batched callback: compute the noise of n cells with the given signals
+void dd4hep::digi::DigiSignalProcessor::process(DigiContext& context,
+                                                const double* signals,
+                                                double* noise,
+                                                std::size_t n)  const   {
+  DigiCellData    data;
+  DigiCellContext cell(context, data);
+  for( std::size_t i = 0; i < n; ++i )   {
+    data.signal = signals[i];
+    noise[i] = this->operator()(cell);
+  }
+}
+
+/// Probability that the noise of a channel without signal exceeds the threshold (<0: not supported)
+double dd4hep::digi::DigiSignalProcessor::tailProbability(double /* threshold */)  const   {
+  return -1e0;
+}
+
+/// Draw the noise of a channel without signal under the condition that it exceeds the threshold
+double dd4hep::digi::DigiSignalProcessor::drawAbove(DigiContext& /* context */, double /* threshold */)  const   {
+  except("+++ Sparse noise generation is not supported by this signal processor.");
+  return 0e0;
+}
+
+/// Sparse noise: collect the channels out of num_channels without signal with noise above threshold
+std::size_t
+dd4hep::digi::DigiSignalProcessor::sparse(DigiContext& context,
+                                          std::size_t num_channels,
+                                          double threshold,
+                                          std::vector<std::pair<std::size_t, double> >& channels)  const   {
+  double prob = tailProbability(threshold);
+  if ( prob < 0e0 )   {
+    except("+++ Sparse noise generation is not supported by this signal processor.");
+  }
+  std::size_t start = channels.size();
+  if ( prob <= 0e0 || num_channels == 0 )   {
+    return 0;
+  }
+  const DigiRandomGenerator& random = context.randomGenerator();
+  channels.reserve(start + std::size_t(double(num_channels) * prob * 1.1) + 16);
+  if ( prob >= 1e0 )   {
+    for( std::size_t i = 0; i < num_channels; ++i )
+      channels.emplace_back(i, drawAbove(context, threshold));
+    return num_channels;
+  }
+  // The distance between two channels above threshold is geometrically distributed
+  const double log_q = std::log1p(-prob);
+  double channel = -1e0;
+  while( true )   {
+    channel += 1e0 + std::floor(std::log(random.random()) / log_q);
+    if ( channel >= double(num_channels) ) break;
+    channels.emplace_back(std::size_t(channel), drawAbove(context, threshold));
+  }
+  return channels.size() - start;
+}
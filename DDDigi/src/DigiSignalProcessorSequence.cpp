@@ -18,6 +18,8 @@
 
 // C/C++ include files
 #include <stdexcept>
+#include <algorithm>
+#include <vector>
 
 using namespace dd4hep::digi;
 
@@ -50,3 +52,14 @@ double DigiSignalProcessorSequence::operator()(DigiCellContext& context)  const
     result += p->operator()(context);
   return context.data.kill ? 0e0 : result;
 }
+
+/// Batched callback: sum of the signals and the noise of all processors
+void DigiSignalProcessorSequence::process(DigiContext& context, const double* signals, double* values, std::size_t n)  const   {
+  std::vector<double> noise(n);
+  std::copy(signals, signals+n, values);
+  for ( const auto* p : m_actors )   {
+    p->process(context, signals, noise.data(), n);
+    for( std::size_t i = 0; i < n; ++i )
+      values[i] += noise[i];
+  }
+}
@@ -0,0 +1,108 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "DD4hep/Printout.h"
+#include "DD4hep/Primitives.h"
+#include "DDDigi/DigiSlotRegistry.h"
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::digi;
+
+/// Access slot entry with range check. Requires the lock to be held
+DigiSlotRegistry::Entry& DigiSlotRegistry::_entry(int slot)   {
+  if ( slot >= 0 && size_t(slot) < m_entries.size() )
+    return m_entries[slot];
+  except("DigiSlotRegistry","+++ Invalid event data slot %d [%ld slots registered].",
+         slot, m_entries.size());
+  throw runtime_error("DigiSlotRegistry"); // Will never get here!
+}
+
+/// Register a data slot. Registering the same key again returns the existing slot
+int DigiSlotRegistry::add(const Key& key, const string& nam, const type_info& typ)   {
+  lock_guard<mutex> lock(m_lock);
+  auto i = m_slots.find(key.toLong());
+  if ( i != m_slots.end() )   {
+    const Entry& e = m_entries[(*i).second];
+    if ( *e.type != typ )   {
+      except("DigiSlotRegistry","+++ Event data slot %s is of type %s. Cannot register it as %s.",
+             e.name.c_str(), typeName(*e.type).c_str(), typeName(typ).c_str());
+    }
+    return (*i).second;
+  }
+  if ( m_frozen )   {
+    except("DigiSlotRegistry","+++ Cannot register event data slot %s after initialization.",
+           nam.c_str());
+  }
+  int slot = int(m_entries.size());
+  m_entries.emplace_back();
+  m_entries.back().key  = key;
+  m_entries.back().name = nam;
+  m_entries.back().type = &typ;
+  m_slots.emplace(key.toLong(), slot);
+  return slot;
+}
+
+/// Declare an action writing the slot
+void DigiSlotRegistry::addProducer(int slot, const string& action)   {
+  lock_guard<mutex> lock(m_lock);
+  Entry& e = _entry(slot);
+  if ( m_frozen )   {
+    except("DigiSlotRegistry","+++ Cannot add producer %s to event data slot %s after initialization.",
+           action.c_str(), e.name.c_str());
+  }
+  e.producers.emplace_back(action);
+}
+
+/// Declare an action reading the slot
+void DigiSlotRegistry::addConsumer(int slot, const string& action)   {
+  lock_guard<mutex> lock(m_lock);
+  Entry& e = _entry(slot);
+  if ( m_frozen )   {
+    except("DigiSlotRegistry","+++ Cannot add consumer %s to event data slot %s after initialization.",
+           action.c_str(), e.name.c_str());
+  }
+  e.consumers.emplace_back(action);
+}
+
+/// Access the slot number of a key. Returns -1 if the key is not registered
+int DigiSlotRegistry::slot(const Key& key)  const   {
+  lock_guard<mutex> lock(m_lock);
+  auto i = m_slots.find(key.toLong());
+  return i == m_slots.end() ? -1 : (*i).second;
+}
+
+/// Access the description of a slot
+const DigiSlotRegistry::Entry& DigiSlotRegistry::entry(int slot)  const   {
+  lock_guard<mutex> lock(m_lock);
+  return const_cast<DigiSlotRegistry*>(this)->_entry(slot);
+}
+
+/// Number of registered slots
+size_t DigiSlotRegistry::size()  const   {
+  lock_guard<mutex> lock(m_lock);
+  return m_entries.size();
+}
+
+/// Inhibit further registrations
+void DigiSlotRegistry::freeze()   {
+  lock_guard<mutex> lock(m_lock);
+  m_frozen = true;
+}
+
+/// Check if the registry is frozen
+bool DigiSlotRegistry::isFrozen()  const   {
+  lock_guard<mutex> lock(m_lock);
+  return m_frozen;
+}
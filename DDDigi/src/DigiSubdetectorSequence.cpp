@@ -15,6 +15,7 @@
 #include "DDDigi/DigiSubdetectorSequence.h"
 #include "DDDigi/DigiSegmentation.h"
 #include "DDDigi/DigiKernel.h"
+#include "DDDigi/DigiContext.h"
 #include "DD4hep/InstanceCount.h"
 #include "DD4hep/Detector.h"
 #include "DD4hep/IDDescriptor.h"
@@ -33,9 +34,8 @@ DigiSubdetectorSequence::DigiSubdetectorSequence(const DigiKernel& kernel, const
 {
   declareProperty("detector",m_detectorName);
   declareProperty("parallize_by",m_segmentName);
-  m_cellHandler = [this](DigiContext& context, const DigiCellScanner& scanner, const DigiCellData& data)  {
-    this->process_cell(context, scanner, data);
-  };
+  declareProperty("input",m_inputName);
+  declareProperty("input_mask",m_inputMask);
   InstanceCount::increment(this);
 }
 
@@ -59,6 +59,10 @@ void DigiSubdetectorSequence::initialize()   {
     VolumeID      msk = m_idDesc.get_mask(ids);
     scan_detector(m_detector, vid, msk);
   }
+  if ( !m_inputName.empty() )   {
+    m_deposits = declareInput<DigiEnergyDeposits>(m_inputName, m_inputMask);
+  }
+  this->DigiActionSequence::initialize();
 }
 
 void DigiSubdetectorSequence::scan_sensitive(PlacedVolume pv, VolumeID vid, VolumeID mask)   {
@@ -70,6 +74,8 @@ void DigiSubdetectorSequence::scan_sensitive(PlacedVolume pv, VolumeID vid, Volu
     if ( is == m_scanners.end() )  {
       is = m_scanners.insert(make_pair(key, create_cell_scanner(sol, m_segmentation))).first;
     }
+    // Fill the cell cache of this solid before processing events
+    is->second->cells(sol, vid);
   }
   for (int idau = 0, ndau = pv->GetNdaughters(); idau < ndau; ++idau) {
     PlacedVolume  p(pv->GetDaughter(idau));
@@ -133,7 +139,10 @@ void DigiSubdetectorSequence::process_context(DigiContext& context,
     if ( is == m_scanners.end() )   {
       except("Fatal error in process_context: Invalid cell scanner. vid: %016X",vid);
     }
-    (*(is->second))(context, pv, vid, m_cellHandler);
+    is->second->scan(context, pv, vid,
+                     [this](DigiContext& ctxt, const DigiCellScanner& scanner, const DigiCellData& data)  {
+                       this->process_cell(ctxt, scanner, data);
+                     });
     return;
   }
   for (int idau = 0, ndau = pv->GetNdaughters(); idau < ndau; ++idau) {
@@ -148,6 +157,11 @@ void DigiSubdetectorSequence::process_context(DigiContext& context,
 
 /// Pre-track action callback
 void DigiSubdetectorSequence::execute(DigiContext& context)  const   {
+  if ( m_deposits.isValid() )   {
+    const DigiEnergyDeposits& deposits = context.event().get(m_deposits);
+    debug("+++ Event: %8d %-24s %6ld deposits", context.event().eventNumber,
+          m_inputName.c_str(), deposits.size());
+  }
   for( const auto& d : m_parallelVid )   {
     const Context& c = d.second;
     auto vid = c.detector_id;
@@ -16,9 +16,12 @@
 #include "DDDigi/DigiKernel.h"
 #include "DDDigi/DigiContext.h"
 #include "DDDigi/DigiSynchronize.h"
+#include "DDDigi/DigiSlotRegistry.h"
 
 // C/C++ include files
 #include <stdexcept>
+#include <vector>
+#include <set>
 
 using namespace std;
 using namespace dd4hep::digi;
@@ -65,6 +68,43 @@ void DigiSynchronize::adopt(DigiEventAction* action) {
   except("DigiSynchronize","++ Attempt to add invalid actor!");
 }
 
+/// Initialize all children
+void DigiSynchronize::initialize()   {
+  this->DigiEventAction::initialize();
+  m_actors(&DigiEventAction::initialize);
+}
+
+/// Collect the event data slots read and written by this action and all children
+void DigiSynchronize::dataDependencies(set<int>& inputs, set<int>& outputs)  const   {
+  this->DigiEventAction::dataDependencies(inputs, outputs);
+  for( const DigiEventAction* action : m_actors )
+    action->dataDependencies(inputs, outputs);
+}
+
+/// Check that children executing in parallel do not write data used by their siblings
+void DigiSynchronize::checkDependencies()  const   {
+  for( const DigiEventAction* action : m_actors )
+    action->checkDependencies();
+  if ( !m_parallel )
+    return;
+  const DigiSlotRegistry& registry = m_kernel.slotRegistry();
+  vector<pair<set<int>, set<int> > > deps(m_actors.size());
+  for( size_t i = 0; i < m_actors.size(); ++i )
+    m_actors[i]->dataDependencies(deps[i].first, deps[i].second);
+  for( size_t i = 0; i < deps.size(); ++i )   {
+    for( int slot : deps[i].second )   {
+      for( size_t j = 0; j < deps.size(); ++j )   {
+        if ( i != j && (deps[j].first.count(slot) || deps[j].second.count(slot)) )   {
+          except("+++ Data conflict: %s writes event data slot %s, which is used by %s. "
+                 "Both actions are executed in parallel.", m_actors[i]->c_name(),
+                 registry.entry(slot).name.c_str(), m_actors[j]->c_name());
+        }
+      }
+    }
+  }
+  debug("+++ Checked data dependencies of %ld parallel actions.", m_actors.size());
+}
+
 /// Add an actor responding to all callbacks. Sequence takes ownership.
 void DigiSynchronize::analyze() {
   info("+++ Analyzing the algorithm sequence. Parallel: %s",yes_no(m_parallel));
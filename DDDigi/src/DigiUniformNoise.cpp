@@ -14,8 +14,13 @@
 // Framework include files
 #include "DD4hep/InstanceCount.h"
 #include "DDDigi/DigiRandomGenerator.h"
+#include "DDDigi/DigiContext.h"
 #include "DDDigi/DigiUniformNoise.h"
 
+// C/C++ include files
+#include <algorithm>
+#include <cmath>
+
 using namespace dd4hep::digi;
 
 /// Standard constructor
@@ -36,3 +41,19 @@ DigiUniformNoise::~DigiUniformNoise() {
 double DigiUniformNoise::operator()(DigiCellContext& context)  const  {
   return context.context.randomGenerator().uniform(m_min,m_max);
 }
+
+/// Batched callback: compute the noise of n cells with the given signals
+void DigiUniformNoise::process(DigiContext& context, const double* /* signals */, double* noise, std::size_t n)  const  {
+  context.randomGenerator().uniform(noise, n, m_min, m_max);
+}
+
+/// Probability that the noise of a channel without signal exceeds the threshold
+double DigiUniformNoise::tailProbability(double threshold)  const  {
+  if ( m_max <= m_min ) return 0e0;
+  return std::min(1e0, std::max(0e0, (m_max - std::max(threshold, m_min)) / (m_max - m_min)));
+}
+
+/// Draw the noise of a channel without signal under the condition that it exceeds the threshold
+double DigiUniformNoise::drawAbove(DigiContext& context, double threshold)  const  {
+  return context.randomGenerator().uniform(std::max(threshold, m_min), m_max);
+}
@@ -19,6 +19,7 @@
 #include "DD4hep/VolumeManager.h"
 #include "DDG4/Geant4HitCollection.h"
 #include "DDG4/Geant4OutputAction.h"
+#include "DDG4/Geant4OutputQueue.h"
 #include "DDG4/Geant4SensDetAction.h"
 #include "DDG4/EventParameters.h"
 
@@ -39,8 +40,11 @@
 #include "podio/EventStore.h"
 #include "podio/ROOTWriter.h"
 
+#include <algorithm>
 #include <typeinfo>
 #include <iostream>
+#include <chrono>
+#include <memory>
 #include <ctime>
 
 
@@ -52,30 +56,27 @@ namespace dd4hep {
   /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
   namespace sim {
 
-    template <class T=podio::EventStore> void EventParameters::extractParameters(T& event){
-      auto& lcparameters = event.getEventMetaData();
-
-      for(auto const& ival: this->intParameters()) {
-        lcparameters.setValues(ival.first, ival.second);
-      }
-      for(auto const& ival: this->fltParameters()) {
-        lcparameters.setValues(ival.first, ival.second);
-      }
-      for(auto const& ival: this->strParameters()) {
-        lcparameters.setValues(ival.first, ival.second);
-      }
-    }
-
     class  Geant4ParticleMap;
 
     /// Base class to output Geant4 event data to EDM4hep
     /**
+     *  The Geant4 data are first converted by the simulation thread to a
+     *  self-contained event record. The record is then written to the
+     *  EDM4hep collections either directly or, if the property "WriterThread"
+     *  is set, by a dedicated writer thread fed by a bounded queue of
+     *  "QueueSize" events. The accumulated times spent to convert and to write
+     *  the events are available as properties "ConversionTime" and "WriteTime".
+     *
      *  \author  F.Gaede
      *  \version 1.0
      *  \ingroup DD4HEP_SIMULATION
      */
     class Geant4Output2EDM4hep : public Geant4OutputAction  {
     protected:
+      class EventRecord;
+      class Writer;
+      typedef std::chrono::steady_clock clock_t;
+
       podio::EventStore*  m_store;
       podio::ROOTWriter*  m_file;
       int              m_runNo;
@@ -86,11 +87,29 @@ namespace dd4hep {
       std::map< std::string, std::string > m_eventParametersFloat;
       std::map< std::string, std::string > m_eventParametersString;
       bool m_FirstEvent =  true  ;
+      /// Property: Write the events from a dedicated writer thread
+      bool             m_writerThread = false;
+      /// Property: Maximal number of events queued for the writer thread
+      int              m_queueSize = 8;
+      /// Property: Accumulated time to convert the Geant4 data [seconds]
+      double           m_conversionTime = 0e0;
+      /// Property: Accumulated time to fill and write the EDM4hep collections [seconds]
+      double           m_writeTime = 0e0;
+      /// Running averages of the number of hit contributions per collection
+      std::map< std::string, double > m_averageSize;
+      /// Start time of the conversion of the current event
+      clock_t::time_point          m_conversionStart;
+      /// Event record being filled by the simulation thread
+      std::unique_ptr<EventRecord> m_record;
+      /// Writer thread if enabled
+      std::unique_ptr<Writer>      m_writer;
 
       /// create the podio collections for the particles and hits
       void createCollections(OutputContext<G4Event>& ctxt) ;
       /// Data conversion interface for MC particles to EDM4hep format
       void saveParticles(Geant4ParticleMap* particles);
+      /// Fill the EDM4hep collections from an event record and write the event
+      void write(EventRecord& record);
     public:
       /// Standard constructor
       Geant4Output2EDM4hep(Geant4Context* ctxt, const std::string& nam);
@@ -118,6 +137,102 @@ namespace dd4hep {
       void saveEventParameters(const std::map<std::string, std::string >& parameters);
     };
     
+    /// Event data converted by the simulation thread
+    /**
+     *  The record does not reference any Geant4 object. Hence it may be written
+     *  after the Geant4 event was cleared. Records are recycled to keep the
+     *  capacity of the containers.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class Geant4Output2EDM4hep::EventRecord  {
+    public:
+      /// Converted MC particle
+      struct Particle  {
+        int            pdgID, status;
+        unsigned short genStatus;
+        float          charge, time;
+        double         mass;
+        float          momentum[3], momentumAtEndpoint[3];
+        double         vertex[3], endpoint[3];
+        float          spin[3];
+        int            colorFlow[2];
+      };
+      /// Converted tracker hit
+      struct TrackerHit  {
+        unsigned long long cellID;
+        int                particle;
+        bool               producedBySecondary;
+        float              energyDeposit, length, time;
+        double             position[3];
+        float              momentum[3];
+      };
+      /// Converted calorimeter hit. The contributions are [first, first+count) of the collection
+      struct CalorimeterHit  {
+        unsigned long long cellID;
+        float              position[3];
+        float              energy;
+        size_t             first, count;
+      };
+      /// Converted calorimeter hit contribution
+      struct Contribution  {
+        int   particle, pdgID;
+        float energy, time;
+        float position[3];
+      };
+      /// Converted hit collection
+      struct Collection  {
+        enum { TRACKER, CALORIMETER } type;
+        std::string                 name;
+        bool                        detailed = false;
+        std::vector<TrackerHit>     trackerHits;
+        std::vector<CalorimeterHit> calorimeterHits;
+        std::vector<Contribution>   contributions;
+      };
+
+      int                 runNumber = 0, eventNumber = 0;
+      long                timeStamp = 0;
+      std::map<std::string, std::vector<int> >         intValues;
+      std::map<std::string, std::vector<float> >       fltValues;
+      std::map<std::string, std::vector<std::string> > strValues;
+      std::vector<Particle>                            particles;
+      /// Parent relations (daughter index, parent index) in the order to be applied
+      std::vector<std::pair<int,int> >                 parents;
+      /// Hit collections. Only the first numCollections entries are valid
+      std::vector<Collection>                          collections;
+      size_t                                           numCollections = 0;
+
+      /// Access the event parameters of a given type
+      template <typename T> std::map<std::string, std::vector<T> >& values();
+      /// Reset the record keeping the allocated capacities
+      void clear()  {
+        intValues.clear();
+        fltValues.clear();
+        strValues.clear();
+        particles.clear();
+        parents.clear();
+        numCollections = 0;
+      }
+      /// Add an empty hit collection
+      Collection& addCollection(const std::string& nam)  {
+        if ( numCollections == collections.size() ) collections.emplace_back();
+        Collection& c = collections[numCollections++];
+        c.name = nam;
+        c.detailed = false;
+        c.trackerHits.clear();
+        c.calorimeterHits.clear();
+        c.contributions.clear();
+        return c;
+      }
+    };
+
+    template <> inline std::map<std::string, std::vector<int> >&
+    Geant4Output2EDM4hep::EventRecord::values<int>()   {  return intValues;  }
+    template <> inline std::map<std::string, std::vector<float> >&
+    Geant4Output2EDM4hep::EventRecord::values<float>()  {  return fltValues;  }
+
     /// Fill event parameters in EDM4hep event
     template <typename T>
     inline void Geant4Output2EDM4hep::saveEventParameters(const std::map<std::string, std::string >& parameters)  {
@@ -128,8 +243,7 @@ namespace dd4hep {
           printout(FATAL,"saveEventParameters","+++ Event parameter %s: FAILED to convert to type :%s",iter->first.c_str(),typeid(T).name());
           continue;
         }
-	auto& evtMD = m_store->getEventMetaData();
-	evtMD.setValue(iter->first,parameter);
+        m_record->values<T>()[iter->first] = { parameter };
       }
     }
 
@@ -137,8 +251,7 @@ namespace dd4hep {
     template <>
     inline void Geant4Output2EDM4hep::saveEventParameters<std::string>(const std::map<std::string, std::string >& parameters)  {
       for(std::map<std::string, std::string >::const_iterator iter = parameters.begin(), endIter = parameters.end() ; iter != endIter ; ++iter)  {
-	auto& evtMD = m_store->getEventMetaData();
-	evtMD.setValue(iter->first,iter->second);
+        m_record->strValues[iter->first] = { iter->second };
       }
     }
 
@@ -175,7 +288,6 @@ namespace dd4hep {
 #include "G4Event.hh"
 #include "G4Run.hh"
 
-
 using namespace dd4hep::sim;
 using namespace dd4hep;
 using namespace std;
@@ -183,6 +295,24 @@ namespace {
   G4Mutex action_mutex=G4MUTEX_INITIALIZER;
 }
 
+/// Writer thread of the EDM4hep output
+/**
+ *  Written records are kept for reuse to keep the capacity of their containers.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_SIMULATION
+ */
+class Geant4Output2EDM4hep::Writer : public Geant4OutputQueue<EventRecord>  {
+public:
+  /// Initializing constructor
+  Writer(Geant4Output2EDM4hep* out, size_t num)
+    : Geant4OutputQueue<EventRecord>(out->name(), num, out->m_errorFatal,
+                                     [out](EventRecord& rec) { out->write(rec); }, true)
+  {
+  }
+};
+
 #include "DDG4/Factories.h"
 DECLARE_GEANT4ACTION(Geant4Output2EDM4hep)
 
@@ -196,16 +326,24 @@ Geant4Output2EDM4hep::Geant4Output2EDM4hep(Geant4Context* ctxt, const string& na
   declareProperty("EventParametersString", m_eventParametersString);
   declareProperty("RunNumberOffset", m_runNumberOffset);
   declareProperty("EventNumberOffset", m_eventNumberOffset);
+  declareProperty("WriterThread",    m_writerThread);
+  declareProperty("QueueSize",       m_queueSize);
+  declareProperty("ConversionTime",  m_conversionTime);
+  declareProperty("WriteTime",       m_writeTime);
   printout( INFO, "Geant4Output2EDM4hep" ," instantiated ..." ) ;
   InstanceCount::increment(this);
 }
 
 /// Default destructor
 Geant4Output2EDM4hep::~Geant4Output2EDM4hep()  {
+  // The writer thread must finish before the output is closed
+  m_writer.reset();
   G4AutoLock protection_lock(&action_mutex);
   if ( m_file )  {
     m_file->finish();
     detail::deletePtr(m_file);
+    printout( INFO, "Geant4Output2EDM4hep" ,"+++ Time to convert events: %.3f s to write events: %.3f s",
+              m_conversionTime, m_writeTime);
   }
   if (nullptr != m_store) {
     delete m_store;
@@ -221,6 +359,10 @@ void Geant4Output2EDM4hep::beginRun(const G4Run* run)  {
     m_file = new podio::ROOTWriter(m_output, m_store);
 
     printout( INFO, "Geant4Output2EDM4hep" ," opened %s for output", m_output.c_str() ) ;
+    if ( m_writerThread )  {
+      m_writer.reset(new Writer(this, m_queueSize));
+      printout( INFO, "Geant4Output2EDM4hep" ," writing events from a writer thread [Queue size: %d]", m_queueSize ) ;
+    }
   }
   
   saveRun(run);
@@ -234,14 +376,142 @@ void Geant4Output2EDM4hep::endRun(const G4Run* /*run*/)  {
 /// Commit data at end of filling procedure
 void Geant4Output2EDM4hep::commit( OutputContext<G4Event>& /* ctxt */)   {
   if ( m_file )   {
-    G4AutoLock protection_lock(&action_mutex);
-    m_file->writeEvent();
-    m_store->clearCollections();
+    m_conversionTime += chrono::duration<double>(clock_t::now()-m_conversionStart).count();
+    if ( m_writer )   {
+      m_writer->push(move(m_record));
+      return;
+    }
+    write(*m_record);
     return;
   }
   except("+++ Failed to write output file. [Stream is not open]");
 }
 
+/// Fill the EDM4hep collections from an event record and write the event
+void Geant4Output2EDM4hep::write(EventRecord& rec)   {
+  typedef detail::ReferenceBitMask<const int> PropertyMask;
+  G4AutoLock protection_lock(&action_mutex);
+  clock_t::time_point start = clock_t::now();
+
+  // this does not compile as create() is we only get a const ref - need to review PODIO EventStore API
+  // auto& evtHCol = m_store->get<edm4hep::EventHeaderCollection>("EventHeader") ;
+  // auto evtHdr = evtHCol.create() ;
+  auto* evtHCol = const_cast<edm4hep::EventHeaderCollection*>(&m_store->get<edm4hep::EventHeaderCollection>("EventHeader") );
+  auto evtHdr = evtHCol->create() ;
+
+  evtHdr.setRunNumber(rec.runNumber);
+  evtHdr.setEventNumber(rec.eventNumber);
+//not implemented in EDM4hep ?  evtHdr.setDetectorName(context()->detectorDescription().header().name());
+  evtHdr.setTimeStamp(rec.timeStamp);
+
+  auto& evtMD = m_store->getEventMetaData();
+  for(auto const& ival: rec.intValues) evtMD.setValues(ival.first, ival.second);
+  for(auto const& ival: rec.fltValues) evtMD.setValues(ival.first, ival.second);
+  for(auto const& ival: rec.strValues) evtMD.setValues(ival.first, ival.second);
+
+  edm4hep::MCParticleCollection* mcpc =
+    const_cast<edm4hep::MCParticleCollection*>(
+      &m_store->get<edm4hep::MCParticleCollection>("MCParticles"));
+
+  vector<edm4hep::MCParticle> p_edm4hep;
+  p_edm4hep.reserve(rec.particles.size());
+  for(const auto& p : rec.particles)   {
+    PropertyMask mask(p.status);
+    edm4hep::MCParticle mcp = edm4hep::MCParticle();
+    mcp.setPDG(p.pdgID);
+    mcp.setMomentum( p.momentum );
+    mcp.setMomentumAtEndpoint( p.momentumAtEndpoint );
+    mcp.setVertex( p.vertex );
+    mcp.setEndpoint( p.endpoint );
+    mcp.setTime(p.time);
+    mcp.setMass(p.mass);
+    mcp.setCharge(p.charge);
+
+    // Set generator status
+    mcp.setGeneratorStatus(0);
+    if( p.genStatus ) {
+      mcp.setGeneratorStatus( p.genStatus ) ;
+    } else {
+      if ( mask.isSet(G4PARTICLE_GEN_STABLE) )             mcp.setGeneratorStatus(1);
+      else if ( mask.isSet(G4PARTICLE_GEN_DECAYED) )       mcp.setGeneratorStatus(2);
+      else if ( mask.isSet(G4PARTICLE_GEN_DOCUMENTATION) ) mcp.setGeneratorStatus(3);
+      else if ( mask.isSet(G4PARTICLE_GEN_BEAM) )          mcp.setGeneratorStatus(4);
+      else if ( mask.isSet(G4PARTICLE_GEN_OTHER) )         mcp.setGeneratorStatus(9);
+    }
+
+    // Set simulation status
+    mcp.setCreatedInSimulation(         mask.isSet(G4PARTICLE_SIM_CREATED) );
+    mcp.setBackscatter(                 mask.isSet(G4PARTICLE_SIM_BACKSCATTER) );
+    mcp.setVertexIsNotEndpointOfParent( mask.isSet(G4PARTICLE_SIM_PARENT_RADIATED) );
+    mcp.setDecayedInTracker(            mask.isSet(G4PARTICLE_SIM_DECAY_TRACKER) );
+    mcp.setDecayedInCalorimeter(        mask.isSet(G4PARTICLE_SIM_DECAY_CALO) );
+    mcp.setHasLeftDetector(             mask.isSet(G4PARTICLE_SIM_LEFT_DETECTOR) );
+    mcp.setStopped(                     mask.isSet(G4PARTICLE_SIM_STOPPED) );
+    mcp.setOverlay(                     false );
+
+    //fg: if simstatus !=0 we have to set the generator status to 0:
+    if( mcp.isCreatedInSimulation() )
+      mcp.setGeneratorStatus( 0 )  ;
+
+    mcp.setSpin(p.spin);
+    mcp.setColorFlow(p.colorFlow);
+
+    mcpc->push_back(mcp);
+    p_edm4hep.emplace_back(mcp);
+  }
+  // Now establish parent-daughter relationships
+  for(const auto& r : rec.parents)
+    p_edm4hep[r.first].addToParents(p_edm4hep[r.second]);
+
+  for(size_t ic=0; ic < rec.numCollections; ++ic)   {
+    const EventRecord::Collection& c = rec.collections[ic];
+    if ( c.type == EventRecord::Collection::TRACKER )   {
+      edm4hep::SimTrackerHitCollection* sthc =
+        const_cast<edm4hep::SimTrackerHitCollection*>(&m_store->get<edm4hep::SimTrackerHitCollection>(c.name));
+      for(const auto& hit : c.trackerHits)   {
+        auto sth = sthc->create() ;
+        sth.setCellID( hit.cellID ) ;
+        sth.setEDep(hit.energyDeposit);
+        sth.setPathLength(hit.length);
+        sth.setTime(hit.time);
+        sth.setMCParticle(mcpc->at(hit.particle));
+        sth.setPosition({hit.position[0], hit.position[1], hit.position[2]});
+        sth.setMomentum(edm4hep::Vector3f(hit.momentum[0], hit.momentum[1], hit.momentum[2]));
+        sth.setProducedBySecondary(hit.producedBySecondary);
+      }
+      continue;
+    }
+    edm4hep::SimCalorimeterHitCollection* sCaloHitColl =
+      const_cast<edm4hep::SimCalorimeterHitCollection*>(
+        &m_store->get<edm4hep::SimCalorimeterHitCollection>(c.name));
+    edm4hep::CaloHitContributionCollection* sCaloHitContColl =
+      const_cast<edm4hep::CaloHitContributionCollection*>(
+        &m_store->get<edm4hep::CaloHitContributionCollection>(c.name + "Contributions"));
+    for(const auto& hit : c.calorimeterHits)   {
+      auto sch = sCaloHitColl->create() ;
+      sch.setCellID( hit.cellID );
+      sch.setPosition({hit.position[0], hit.position[1], hit.position[2]});
+      sch.setEnergy( hit.energy );
+      // now add the individual step contributions
+      for(size_t i = hit.first, n = hit.first + hit.count; i < n; ++i)   {
+        const EventRecord::Contribution& cont = c.contributions[i];
+        auto sCaloHitCont = sCaloHitContColl->create();
+        sch.addToContributions( sCaloHitCont );
+        sCaloHitCont.setEnergy( cont.energy );
+        sCaloHitCont.setTime( cont.time );
+        sCaloHitCont.setParticle( mcpc->at(cont.particle) );
+        if ( c.detailed )     {
+          sCaloHitCont.setPDG( cont.pdgID );
+          sCaloHitCont.setStepPosition( edm4hep::Vector3f(cont.position[0], cont.position[1], cont.position[2]) );
+        }
+      }
+    }
+  }
+  m_file->writeEvent();
+  m_store->clearCollections();
+  m_writeTime += chrono::duration<double>(clock_t::now()-start).count();
+}
+
 /// Callback to store the Geant4 run information
 void Geant4Output2EDM4hep::saveRun(const G4Run* /*run*/)  {
   //G4AutoLock protection_lock(&action_mutex);
@@ -268,85 +538,59 @@ void Geant4Output2EDM4hep::begin(const G4Event* /* event */)  {
 
 /// Data conversion interface for MC particles to EDM4hep format
 void Geant4Output2EDM4hep::saveParticles(Geant4ParticleMap* particles)    {
-  typedef detail::ReferenceBitMask<const int> PropertyMask;
   typedef Geant4ParticleMap::ParticleMap ParticleMap;
   const ParticleMap& pm = particles->particleMap;
   size_t nparts = pm.size();
-  edm4hep::MCParticleCollection* mcpc =
-    const_cast<edm4hep::MCParticleCollection*>(
-      &m_store->get<edm4hep::MCParticleCollection>("MCParticles"));
+  vector<EventRecord::Particle>& mcpc = m_record->particles;
 
   if ( nparts > 0 )  {
     size_t cnt = 0;
     map<int,int> p_ids;
     vector<const Geant4Particle*> p_part(pm.size(),0);
-    vector<edm4hep::MCParticle> p_edm4hep(pm.size());
+    mcpc.reserve(nparts);
     // First create the particles
     for(ParticleMap::const_iterator i=pm.begin(); i!=pm.end();++i, ++cnt)   {
       int id = (*i).first;
       const Geant4ParticleHandle p = (*i).second;
-      PropertyMask mask(p->status);
-      //      std::cout << " ********** mcp status : 0x" << std::hex << p->status << ", mask.isSet(G4PARTICLE_GEN_STABLE) x" << std::dec << mask.isSet(G4PARTICLE_GEN_STABLE)  <<std::endl ;
       const G4ParticleDefinition* def = p.definition();
-      edm4hep::MCParticle mcp = edm4hep::MCParticle();
-      mcp.setPDG(p->pdgID);
-
-      float ps_fa[3] = {float(p->psx/CLHEP::GeV),float(p->psy/CLHEP::GeV),float(p->psz/CLHEP::GeV)};
-      mcp.setMomentum( ps_fa );
-
-      float pe_fa[3] = {float(p->pex/CLHEP::GeV),float(p->pey/CLHEP::GeV),float(p->pez/CLHEP::GeV)};
-      mcp.setMomentumAtEndpoint( pe_fa );
-
-      double vs_fa[3] = { p->vsx/CLHEP::mm, p->vsy/CLHEP::mm, p->vsz/CLHEP::mm } ;
-      mcp.setVertex( vs_fa );
-
-      double ve_fa[3] = { p->vex/CLHEP::mm, p->vey/CLHEP::mm, p->vez/CLHEP::mm } ;
-      mcp.setEndpoint( ve_fa );
-
-      mcp.setTime(p->time/CLHEP::ns);
-      mcp.setMass(p->mass/CLHEP::GeV);
-      mcp.setCharge(def ? def->GetPDGCharge() : 0); // Charge(e+) = 1 !
-
-      // Set generator status
-      mcp.setGeneratorStatus(0);
-      if( p->genStatus ) {
-        mcp.setGeneratorStatus( p->genStatus ) ;
-      } else {
-        if ( mask.isSet(G4PARTICLE_GEN_STABLE) )             mcp.setGeneratorStatus(1);
-        else if ( mask.isSet(G4PARTICLE_GEN_DECAYED) )       mcp.setGeneratorStatus(2);
-        else if ( mask.isSet(G4PARTICLE_GEN_DOCUMENTATION) ) mcp.setGeneratorStatus(3);
-        else if ( mask.isSet(G4PARTICLE_GEN_BEAM) )          mcp.setGeneratorStatus(4);
-        else if ( mask.isSet(G4PARTICLE_GEN_OTHER) )         mcp.setGeneratorStatus(9);
-      }
+      EventRecord::Particle mcp;
+      mcp.pdgID     = p->pdgID;
+      mcp.status    = p->status;
+      mcp.genStatus = p->genStatus;
+
+      mcp.momentum[0] = float(p->psx/CLHEP::GeV);
+      mcp.momentum[1] = float(p->psy/CLHEP::GeV);
+      mcp.momentum[2] = float(p->psz/CLHEP::GeV);
+
+      mcp.momentumAtEndpoint[0] = float(p->pex/CLHEP::GeV);
+      mcp.momentumAtEndpoint[1] = float(p->pey/CLHEP::GeV);
+      mcp.momentumAtEndpoint[2] = float(p->pez/CLHEP::GeV);
 
-      // Set simulation status
-      mcp.setCreatedInSimulation(         mask.isSet(G4PARTICLE_SIM_CREATED) );
-      mcp.setBackscatter(                 mask.isSet(G4PARTICLE_SIM_BACKSCATTER) );
-      mcp.setVertexIsNotEndpointOfParent( mask.isSet(G4PARTICLE_SIM_PARENT_RADIATED) );
-      mcp.setDecayedInTracker(            mask.isSet(G4PARTICLE_SIM_DECAY_TRACKER) );
-      mcp.setDecayedInCalorimeter(        mask.isSet(G4PARTICLE_SIM_DECAY_CALO) );
-      mcp.setHasLeftDetector(             mask.isSet(G4PARTICLE_SIM_LEFT_DETECTOR) );
-      mcp.setStopped(                     mask.isSet(G4PARTICLE_SIM_STOPPED) );
-      mcp.setOverlay(                     false );
+      mcp.vertex[0] = p->vsx/CLHEP::mm;
+      mcp.vertex[1] = p->vsy/CLHEP::mm;
+      mcp.vertex[2] = p->vsz/CLHEP::mm;
 
-      //fg: if simstatus !=0 we have to set the generator status to 0:
-      if( mcp.isCreatedInSimulation() )
-        mcp.setGeneratorStatus( 0 )  ;
+      mcp.endpoint[0] = p->vex/CLHEP::mm;
+      mcp.endpoint[1] = p->vey/CLHEP::mm;
+      mcp.endpoint[2] = p->vez/CLHEP::mm;
 
-      mcp.setSpin(p->spin);
-      mcp.setColorFlow(p->colorFlow);
+      mcp.time   = p->time/CLHEP::ns;
+      mcp.mass   = p->mass/CLHEP::GeV;
+      mcp.charge = def ? def->GetPDGCharge() : 0; // Charge(e+) = 1 !
 
-      mcpc->push_back(mcp);
+      std::copy(p->spin, p->spin+3, mcp.spin);
+      std::copy(p->colorFlow, p->colorFlow+2, mcp.colorFlow);
+
+      mcpc.emplace_back(mcp);
       p_ids[id] = cnt;
       p_part[cnt] = p;
-      p_edm4hep[cnt] = mcp;
     }
 
     // Now establish parent-daughter relationships
+    vector<pair<int,int> >& relations = m_record->parents;
     for(size_t i=0, n=p_ids.size(); i<n; ++i)   {
       map<int,int>::iterator k;
       const Geant4Particle* p = p_part[i];
-      edm4hep::MCParticle q = p_edm4hep[i];
       const Geant4Particle::Particles& dau = p->daughters;
       for(Geant4Particle::Particles::const_iterator j=dau.begin(); j!=dau.end(); ++j)  {
         int idau = *j;
@@ -354,20 +598,19 @@ void Geant4Output2EDM4hep::saveParticles(Geant4ParticleMap* particles)    {
           printout(FATAL,"Geant4Conversion","+++ Particle %d: FAILED to find daughter with ID:%d",p->id,idau);
           continue;
         }
-        int iqdau = (*k).second;
-        edm4hep::MCParticle qdau = p_edm4hep[iqdau];
-        qdau.addToParents(q);
+        relations.emplace_back((*k).second, int(i));
       }
       const Geant4Particle::Particles& par = p->parents;
       for(Geant4Particle::Particles::const_iterator j=par.begin(); j!=par.end(); ++j)  {
         int ipar = *j; // A parent ID iof -1 means NO parent, because a base of 0 is perfectly leagal!
-        if ( ipar>=0 && (k=p_ids.find(ipar)) == p_ids.end() )  {  // Error!!!
+        if ( ipar < 0 )  {
+          continue;
+        }
+        if ( (k=p_ids.find(ipar)) == p_ids.end() )  {  // Error!!!
           printout(FATAL,"Geant4Conversion","+++ Particle %d: FAILED to find parent with ID:%d",p->id,ipar);
           continue;
         }
-        int iqpar = (*k).second;
-        edm4hep::MCParticle qpar = p_edm4hep[iqpar];
-        q.addToParents(qpar);
+        relations.emplace_back(int(i), (*k).second);
       }
     }
   }
@@ -375,6 +618,14 @@ void Geant4Output2EDM4hep::saveParticles(Geant4ParticleMap* particles)    {
 
 /// Callback to store the Geant4 event
 void Geant4Output2EDM4hep::saveEvent(OutputContext<G4Event>& ctxt)  {
+  m_conversionStart = clock_t::now();
+  if ( !m_record && m_writer )  {
+    m_record = m_writer->acquire();
+  }
+  if ( !m_record )  {
+    m_record.reset(new EventRecord());
+  }
+  m_record->clear();
 
   if( m_FirstEvent ){
     createCollections( ctxt ) ;
@@ -389,23 +640,18 @@ void Geant4Output2EDM4hep::saveEvent(OutputContext<G4Event>& ctxt)  {
   if ( parameters ) {
     runNumber = parameters->runNumber() + runNumberOffset;
     eventNumber = parameters->eventNumber() + eventNumberOffset;
-    parameters->extractParameters(*m_store);
+    m_record->intValues = parameters->intParameters();
+    m_record->fltValues = parameters->fltParameters();
+    m_record->strValues = parameters->strParameters();
   } else { // ... or from DD4hep framework
     runNumber = m_runNo + runNumberOffset;
     eventNumber = ctxt.context->GetEventID() + eventNumberOffset;
   }
   printout(INFO,"Geant4Output2EDM4hep","+++ Saving EDM4hep event %d run %d.", eventNumber, runNumber);
 
-  // this does not compile as create() is we only get a const ref - need to review PODIO EventStore API
-  // auto& evtHCol = m_store->get<edm4hep::EventHeaderCollection>("EventHeader") ;
-  // auto evtHdr = evtHCol.create() ;
-  auto* evtHCol = const_cast<edm4hep::EventHeaderCollection*>(&m_store->get<edm4hep::EventHeaderCollection>("EventHeader") );
-  auto evtHdr = evtHCol->create() ;
-
-  evtHdr.setRunNumber(runNumber);
-  evtHdr.setEventNumber(eventNumber);
-//not implemented in EDM4hep ?  evtHdr.setDetectorName(context()->detectorDescription().header().name());
-  evtHdr.setTimeStamp( std::time(nullptr) ) ;
+  m_record->runNumber   = runNumber;
+  m_record->eventNumber = eventNumber;
+  m_record->timeStamp   = std::time(nullptr);
 
   saveEventParameters<int>(m_eventParametersInt);
   saveEventParameters<float>(m_eventParametersFloat);
@@ -437,44 +683,41 @@ void Geant4Output2EDM4hep::saveCollection(OutputContext<G4Event>& /*ctxt*/, G4VH
 
   Geant4ParticleMap* pm = context()->event().extension<Geant4ParticleMap>(false);
 
-  edm4hep::MCParticleCollection* mcpc =
-    const_cast<edm4hep::MCParticleCollection*>(
-      &m_store->get<edm4hep::MCParticleCollection>("MCParticles"));
-
   //-------------------------------------------------------------------
   if( typeid( Geant4Tracker::Hit ) == coll->type().type()  ){
 
-    edm4hep::SimTrackerHitCollection* sthc =
-      const_cast<edm4hep::SimTrackerHitCollection*>(&m_store->get<edm4hep::SimTrackerHitCollection>(colName));
+    EventRecord::Collection& sthc = m_record->addCollection(colName);
+    sthc.type = EventRecord::Collection::TRACKER;
+    sthc.trackerHits.reserve(nhits);
 
     for(unsigned i=0 ; i < nhits ; ++i){
-      auto sth = sthc->create() ;
+      EventRecord::TrackerHit sth;
 
       const Geant4Tracker::Hit* hit = coll->hit(i);
       const Geant4Tracker::Hit::Contribution& t = hit->truth;
       int trackID = pm->particleID(t.trackID);
 
-      auto mcp = mcpc->at(trackID);
-
-      sth.setCellID( hit->cellID ) ;
-      sth.setEDep(hit->energyDeposit/CLHEP::GeV);
-      sth.setPathLength(hit->length/CLHEP::mm);
-      sth.setTime(hit->truth.time/CLHEP::ns);
-      sth.setMCParticle(mcp);
-      sth.setPosition({hit->position.x()/CLHEP::mm,
-           hit->position.y()/CLHEP::mm,
-           hit->position.z()/CLHEP::mm});
-      sth.setMomentum(edm4hep::Vector3f(hit->momentum.x()/CLHEP::GeV,
-          hit->momentum.y()/CLHEP::GeV,
-          hit->momentum.z()/CLHEP::GeV ));
+      sth.cellID        = hit->cellID;
+      sth.particle      = trackID;
+      sth.energyDeposit = hit->energyDeposit/CLHEP::GeV;
+      sth.length        = hit->length/CLHEP::mm;
+      sth.time          = hit->truth.time/CLHEP::ns;
+      sth.position[0]   = hit->position.x()/CLHEP::mm;
+      sth.position[1]   = hit->position.y()/CLHEP::mm;
+      sth.position[2]   = hit->position.z()/CLHEP::mm;
+      sth.momentum[0]   = hit->momentum.x()/CLHEP::GeV;
+      sth.momentum[1]   = hit->momentum.y()/CLHEP::GeV;
+      sth.momentum[2]   = hit->momentum.z()/CLHEP::GeV;
+      sth.producedBySecondary = false;
 
       auto particleIt = pm->particles().find(trackID);
       if( ( particleIt != pm->particles().end()) ){
         // if the original track ID of the particle is not the same as the
         // original track ID of the hit it was produced by an MCParticle that
         // is no longer stored
-        sth.setProducedBySecondary( (particleIt->second->originalG4ID != t.trackID) );
+        sth.producedBySecondary = (particleIt->second->originalG4ID != t.trackID);
       }
+      sthc.trackerHits.emplace_back(sth);
     }
   //-------------------------------------------------------------------
   }
@@ -483,53 +726,47 @@ void Geant4Output2EDM4hep::saveCollection(OutputContext<G4Event>& /*ctxt*/, G4VH
     Geant4Sensitive*       sd      = coll->sensitive();
     int hit_creation_mode = sd->hitCreationMode();
 
-    edm4hep::SimCalorimeterHitCollection* sCaloHitColl =
-      const_cast<edm4hep::SimCalorimeterHitCollection*>(
-  &m_store->get<edm4hep::SimCalorimeterHitCollection>(colName));
-
-    colName += "Contributions"  ;
-
-    edm4hep::CaloHitContributionCollection* sCaloHitContColl =
-      const_cast<edm4hep::CaloHitContributionCollection*>(
-  &m_store->get<edm4hep::CaloHitContributionCollection>(colName));
-
+    EventRecord::Collection& sCaloHitColl = m_record->addCollection(colName);
+    sCaloHitColl.type = EventRecord::Collection::CALORIMETER;
+    sCaloHitColl.detailed = hit_creation_mode == Geant4Sensitive::DETAILED_MODE;
+    sCaloHitColl.calorimeterHits.reserve(nhits);
+    // The number of contributions is not known beforehand: reserve the running average
+    double& average = m_averageSize[colName];
+    sCaloHitColl.contributions.reserve(size_t(1.2*average));
 
+    vector<EventRecord::Contribution>& sCaloHitContColl = sCaloHitColl.contributions;
     for(unsigned i=0 ; i < nhits ; ++i){
-      auto sch = sCaloHitColl->create() ;
+      EventRecord::CalorimeterHit sch;
 
       const Geant4Calorimeter::Hit* hit = coll->hit(i);
 
-      sch.setCellID( hit->cellID );
-      sch.setPosition({
-           float(hit->position.x()/CLHEP::mm),
-           float(hit->position.y()/CLHEP::mm),
-           float(hit->position.z()/CLHEP::mm)});
-      sch.setEnergy( hit->energyDeposit/CLHEP::GeV );
+      sch.cellID      = hit->cellID;
+      sch.position[0] = float(hit->position.x()/CLHEP::mm);
+      sch.position[1] = float(hit->position.y()/CLHEP::mm);
+      sch.position[2] = float(hit->position.z()/CLHEP::mm);
+      sch.energy      = hit->energyDeposit/CLHEP::GeV;
+      sch.first       = sCaloHitContColl.size();
+      sch.count       = hit->truth.size();
 
       // now add the individual step contributions
       for(Geant4HitData::Contributions::const_iterator ci=hit->truth.begin();
         ci!=hit->truth.end(); ++ci){
 
-        auto sCaloHitCont = sCaloHitContColl->create();
-        sch.addToContributions( sCaloHitCont );
-
         const Geant4HitData::Contribution& c = *ci;
-        int trackID = pm->particleID(c.trackID);
-        auto mcp = mcpc->at(trackID);
-
-        sCaloHitCont.setEnergy( c.deposit/CLHEP::GeV );
-        sCaloHitCont.setTime( c.time/CLHEP::ns );
-        sCaloHitCont.setParticle( mcp );
-
-        if ( hit_creation_mode == Geant4Sensitive::DETAILED_MODE )     {
-          sCaloHitCont.setPDG( c.pdgID );
-          sCaloHitCont.setStepPosition( edm4hep::Vector3f(
-            c.x/CLHEP::mm,
-            c.y/CLHEP::mm, 
-            c.z/CLHEP::mm) );
-        }
+        EventRecord::Contribution sCaloHitCont;
+        sCaloHitCont.particle    = pm->particleID(c.trackID);
+        sCaloHitCont.pdgID       = c.pdgID;
+        sCaloHitCont.energy      = c.deposit/CLHEP::GeV;
+        sCaloHitCont.time        = c.time/CLHEP::ns;
+        sCaloHitCont.position[0] = c.x/CLHEP::mm;
+        sCaloHitCont.position[1] = c.y/CLHEP::mm;
+        sCaloHitCont.position[2] = c.z/CLHEP::mm;
+        sCaloHitContColl.emplace_back(sCaloHitCont);
       }
+      sCaloHitColl.calorimeterHits.emplace_back(sch);
     }
+    double num_contributions = double(sCaloHitContColl.size());
+    average = average > 0e0 ? 0.9*average + 0.1*num_contributions : num_contributions;
   //-------------------------------------------------------------------
   } else {
 
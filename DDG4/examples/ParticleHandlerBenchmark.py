@@ -0,0 +1,114 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+#
+from __future__ import absolute_import, unicode_literals
+import os
+import sys
+import logging
+import DDG4
+from DDG4 import OutputLevel as Output
+from g4units import MeV, mm
+#
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+
+"""
+
+   dd4hep MC truth reduction benchmark with the SiD detector
+
+   Simulates events read from a HepMC file (e.g. heavy-ion collisions
+   with several 10000 tracks per event) and prints for every event the
+   time the particle handler needs to reduce the recorded tracks to
+   the final MC particle record:
+
+   $> python ParticleHandlerBenchmark.py -input minbias_PbPb.hepmc -events 5
+
+   @author  M.Frank
+   @version 1.0
+
+"""
+
+
+def help():
+  logging.info("ParticleHandlerBenchmark.py -option [-option]                    ")
+  logging.info("       -input <file name>       HepMC input file (mandatory)      ")
+  logging.info("       -events <number>         Number of events to simulate      ")
+  logging.info("       -energy <MeV>            Minimal kinetic energy to keep    ")
+
+
+def run():
+  hlp = False
+  input_file = None
+  num_events = 5
+  min_energy = 100 * MeV
+  #
+  args = sys.argv[1:]
+  for i in list(range(len(args))):
+    c = args[i].upper()
+    if c[:4] == '-INP':
+      input_file = args[i + 1]
+    elif c[:4] == '-EVE':
+      num_events = int(args[i + 1])
+    elif c[:4] == '-ENE':
+      min_energy = float(args[i + 1]) * MeV
+    elif c[:2] == '-H':
+      hlp = True
+
+  if hlp or not input_file:
+    help()
+    sys.exit(1)
+
+  kernel = DDG4.Kernel()
+  install_dir = os.environ['DD4hepINSTALL']
+  kernel.loadGeometry(str("file:" + install_dir + "/DDDetectors/compact/SiD.xml"))
+  DDG4.importConstants(kernel.detectorDescription())
+
+  geant4 = DDG4.Geant4(kernel, tracker='Geant4TrackerCombineAction')
+  geant4.setupCshUI(ui=None, vis=None)
+  kernel.UI = 'UI'
+
+  geant4.setupTrackingField()
+
+  rndm = DDG4.Action(kernel, 'Geant4Random/Random')
+  rndm.Seed = 987654321
+  rndm.initialize()
+
+  logger.info("#  Read events from %s", input_file)
+  gen = DDG4.GeneratorAction(kernel, "Geant4InputAction/Input")
+  gen.Input = "Geant4EventReaderHepMC|" + input_file
+  geant4.buildInputStage([gen], output_level=Output.WARNING)
+
+  # The handler prints the time of the MC truth reduction for every event
+  part = DDG4.GeneratorAction(kernel, "Geant4ParticleHandler/ParticleHandler")
+  part.SaveProcesses = ['Decay']
+  part.MinimalKineticEnergy = min_energy
+  part.OutputLevel = Output.INFO
+  kernel.generatorAction().adopt(part)
+
+  logger.info("#  Tracking detectors and calorimeters")
+  for name in ['SiVertexBarrel', 'SiVertexEndcap', 'SiTrackerBarrel', 'SiTrackerEndcap', 'SiTrackerForward']:
+    geant4.setupTracker(name)
+  for name in ['EcalBarrel', 'EcalEndcap', 'HcalBarrel', 'HcalEndcap', 'HcalPlug',
+               'MuonBarrel', 'MuonEndcap', 'LumiCal', 'BeamCal']:
+    geant4.setupCalorimeter(name)
+
+  phys = geant4.setupPhysics('QGSP_BERT')
+  rg = geant4.addPhysics(str('Geant4DefaultRangeCut/GlobalRangeCut'))
+  rg.RangeCut = 0.7 * mm
+  phys.dump()
+
+  geant4.execute(num_events=num_events)
+
+
+if __name__ == "__main__":
+  run()
@@ -0,0 +1,189 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+#
+from __future__ import absolute_import, unicode_literals
+import os
+import sys
+import time
+import logging
+import DDG4
+from DDG4 import OutputLevel as Output
+from g4units import GeV, mm, ns
+#
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+
+"""
+
+   dd4hep pileup overlay benchmark with the SiD detector
+   in multi-threaded mode
+
+   Measures the event throughput of a simulation where a signal event
+   (particle gun) is overlaid with minimum bias events read from a HepMC
+   file. Run it once with one Geant4InputAction per pileup interaction,
+   which reads every overlaid event from file, and once with the
+   in-memory event pool of the Geant4InteractionPileup action:
+
+   $> python PileupBenchmark.py -input minbias.hepmc -pileup 20 -threads 8 -events 100
+   $> python PileupBenchmark.py -input minbias.hepmc -pileup 20 -threads 8 -events 100 -pool
+
+   Note: with -pool the number of interactions is poisson distributed with
+   mean <pileup>, whereas the stacked input actions always add <pileup>
+   interactions. Use -fixed to compare identical multiplicities.
+
+   @author  M.Frank
+   @version 1.0
+
+"""
+
+options = {'input': None, 'pileup': 10, 'pool': False, 'poolsize': 1000, 'memory': 0.0, 'poisson': True}
+
+
+def help():
+  logging.info("PileupBenchmark.py -option [-option]                             ")
+  logging.info("       -input <file name>       HepMC minimum bias file (mandatory)")
+  logging.info("       -threads <number>        Number of worker threads          ")
+  logging.info("       -events <number>         Number of events to simulate      ")
+  logging.info("       -pileup <number>         (Mean) number of pileup events    ")
+  logging.info("       -pool                    Overlay events from memory pool   ")
+  logging.info("       -poolsize <number>       Number of events in the pool      ")
+  logging.info("       -memory <MB>             Memory budget of the pool         ")
+  logging.info("       -fixed                   No poisson fluctuations (pool)    ")
+
+
+def setupWorker(geant4):
+  kernel = geant4.kernel()
+  gen = DDG4.GeneratorAction(kernel, "Geant4GeneratorActionInit/GenerationInit")
+  kernel.generatorAction().adopt(gen)
+  geant4.setupGun("Gun", particle='pi+', energy=20 * GeV, multiplicity=1, isotrop=True)
+  if options['pool']:
+    logger.info("#PYTHON:  Overlay %s pileup events from a pool of %d events",
+                str(options['pileup']), options['poolsize'])
+    gen = DDG4.GeneratorAction(kernel, "Geant4InteractionPileup/Pileup")
+    gen.Input = "Geant4EventReaderHepMC|" + options['input']
+    gen.PoolSize = options['poolsize']
+    gen.MaxMemory = options['memory']
+    gen.MeanPileup = options['pileup']
+    gen.Poisson = options['poisson']
+    gen.Mask = 1
+    gen.Sigma = (0.01 * mm, 0.01 * mm, 50 * mm, 0.1 * ns)
+    gen.OutputLevel = Output.WARNING
+    kernel.generatorAction().adopt(gen)
+  else:
+    logger.info("#PYTHON:  Overlay %d pileup events read from file", int(options['pileup']))
+    for i in range(int(options['pileup'])):
+      gen = DDG4.GeneratorAction(kernel, "Geant4InputAction/Pileup%d" % (i,))
+      gen.Input = "Geant4EventReaderHepMC|" + options['input']
+      gen.Mask = i + 1
+      gen.OutputLevel = Output.WARNING
+      kernel.generatorAction().adopt(gen)
+      gen = DDG4.GeneratorAction(kernel, "Geant4InteractionVertexSmear/Smear%d" % (i,))
+      gen.Mask = i + 1
+      gen.Sigma = (0.01 * mm, 0.01 * mm, 50 * mm, 0.1 * ns)
+      kernel.generatorAction().adopt(gen)
+  gen = DDG4.GeneratorAction(kernel, "Geant4InteractionMerger/InteractionMerger")
+  kernel.generatorAction().adopt(gen)
+  gen = DDG4.GeneratorAction(kernel, "Geant4PrimaryHandler/PrimaryHandler")
+  kernel.generatorAction().adopt(gen)
+  part = DDG4.GeneratorAction(kernel, "Geant4ParticleHandler/ParticleHandler")
+  part.OutputLevel = Output.WARNING
+  kernel.generatorAction().adopt(part)
+  return 1
+
+
+def setupMaster(geant4):
+  kernel = geant4.master()
+  logger.info('#PYTHON: +++ Setting up master thread for %d workers', int(kernel.NumberOfThreads))
+  return 1
+
+
+def setupSensitives(geant4):
+  for name in ['SiVertexBarrel', 'SiVertexEndcap', 'SiTrackerBarrel', 'SiTrackerEndcap', 'SiTrackerForward']:
+    geant4.setupTracker(name)
+  for name in ['EcalBarrel', 'EcalEndcap', 'HcalBarrel', 'HcalEndcap', 'HcalPlug',
+               'MuonBarrel', 'MuonEndcap', 'LumiCal', 'BeamCal']:
+    geant4.setupCalorimeter(name)
+  return 1
+
+
+def run():
+  hlp = False
+  num_threads = 8
+  num_events = 100
+  #
+  args = sys.argv[1:]
+  for i in list(range(len(args))):
+    c = args[i].upper()
+    if c[:4] == '-INP':
+      options['input'] = args[i + 1]
+    elif c[:4] == '-THR':
+      num_threads = int(args[i + 1])
+    elif c[:4] == '-EVE':
+      num_events = int(args[i + 1])
+    elif c[:4] == '-PIL':
+      options['pileup'] = float(args[i + 1])
+    elif c[:6] == '-POOLS':
+      options['poolsize'] = int(args[i + 1])
+    elif c[:5] == '-POOL':
+      options['pool'] = True
+    elif c[:4] == '-MEM':
+      options['memory'] = float(args[i + 1])
+    elif c[:4] == '-FIX':
+      options['poisson'] = False
+    elif c[:2] == '-H':
+      hlp = True
+
+  if hlp or not options['input']:
+    help()
+    sys.exit(1)
+
+  kernel = DDG4.Kernel()
+  install_dir = os.environ['DD4hepINSTALL']
+  kernel.loadGeometry(str("file:" + install_dir + "/DDDetectors/compact/SiD.xml"))
+  DDG4.importConstants(kernel.detectorDescription())
+
+  kernel.NumberOfThreads = num_threads
+  kernel.RunManagerType = 'G4MTRunManager'
+  geant4 = DDG4.Geant4(kernel, tracker='Geant4TrackerCombineAction')
+  geant4.setupCshUI(ui=None, vis=None)
+  kernel.UI = 'UI'
+
+  geant4.addUserInitialization(worker=setupWorker, worker_args=(geant4,),
+                               master=setupMaster, master_args=(geant4,))
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  seq, act = geant4.addDetectorConstruction("Geant4PythonDetectorConstruction/SetupSD",
+                                            sensitives=setupSensitives, sensitives_args=(geant4,))
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorSensitivesConstruction/ConstructSD")
+  geant4.setupTrackingFieldMT()
+
+  rndm = DDG4.Action(kernel, 'Geant4Random/Random')
+  rndm.Seed = 987654321
+  rndm.initialize()
+
+  phys = geant4.setupPhysics('QGSP_BERT')
+  phys.dump()
+
+  kernel.configure()
+  kernel.initialize()
+  kernel.NumEvents = num_events
+  start = time.time()
+  kernel.run()
+  kernel.terminate()
+  secs = time.time() - start
+  logger.info("+++ %d events with %d threads and %s pileup events [%s] in %.2f seconds: %.2f events/second",
+              num_events, num_threads, str(options['pileup']),
+              'memory pool' if options['pool'] else 'read from file', secs, num_events / secs)
+
+
+if __name__ == "__main__":
+  run()
@@ -0,0 +1,158 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+#
+from __future__ import absolute_import, unicode_literals
+import os
+import sys
+import time
+import logging
+import DDG4
+from DDG4 import OutputLevel as Output
+from g4units import GeV
+#
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+
+"""
+
+   dd4hep ROOT output benchmark with the SiD detector
+   in multi-threaded mode
+
+   Measures the event throughput of a multi-threaded simulation writing
+   all hit collections to a single ROOT file. Run it once with the output
+   written under the global event lock and once with the writer thread:
+
+   $> python SiDOutputBenchmark.py -threads 8 -events 200
+   $> python SiDOutputBenchmark.py -threads 8 -events 200 -async
+
+   @author  M.Frank
+   @version 1.0
+
+"""
+
+options = {'async': False, 'queue': 8, 'compression': -1, 'basket': 32000}
+
+
+def help():
+  logging.info("SiDOutputBenchmark.py -option [-option]                          ")
+  logging.info("       -threads <number>        Number of worker threads          ")
+  logging.info("       -events <number>         Number of events to simulate      ")
+  logging.info("       -async                   Write events from a writer thread ")
+  logging.info("       -queue <number>          Queue size of the writer thread   ")
+  logging.info("       -compression <number>    Compression level of the file     ")
+  logging.info("       -basket <number>         Basket size of the branches       ")
+
+
+def setupWorker(geant4):
+  kernel = geant4.kernel()
+  logger.info("#PYTHON:  Configure I/O: writer thread %s", 'enabled' if options['async'] else 'disabled')
+  out = geant4.setupROOTOutput('RootOutput', 'SiDOutputBenchmark_' + time.strftime('%Y-%m-%d_%H-%M'))
+  out.WriterThread = options['async']
+  out.QueueSize = options['queue']
+  out.CompressionLevel = options['compression']
+  out.BasketSize = options['basket']
+
+  gen = DDG4.GeneratorAction(kernel, "Geant4GeneratorActionInit/GenerationInit")
+  kernel.generatorAction().adopt(gen)
+  geant4.setupGun("Gun", particle='pi+', energy=20 * GeV, multiplicity=10, isotrop=True)
+  gen = DDG4.GeneratorAction(kernel, "Geant4InteractionMerger/InteractionMerger")
+  kernel.generatorAction().adopt(gen)
+  gen = DDG4.GeneratorAction(kernel, "Geant4PrimaryHandler/PrimaryHandler")
+  kernel.generatorAction().adopt(gen)
+  part = DDG4.GeneratorAction(kernel, "Geant4ParticleHandler/ParticleHandler")
+  part.OutputLevel = Output.WARNING
+  kernel.generatorAction().adopt(part)
+  return 1
+
+
+def setupMaster(geant4):
+  kernel = geant4.master()
+  logger.info('#PYTHON: +++ Setting up master thread for %d workers', int(kernel.NumberOfThreads))
+  return 1
+
+
+def setupSensitives(geant4):
+  for name in ['SiVertexBarrel', 'SiVertexEndcap', 'SiTrackerBarrel', 'SiTrackerEndcap', 'SiTrackerForward']:
+    geant4.setupTracker(name)
+  for name in ['EcalBarrel', 'EcalEndcap', 'HcalBarrel', 'HcalEndcap', 'HcalPlug',
+               'MuonBarrel', 'MuonEndcap', 'LumiCal', 'BeamCal']:
+    geant4.setupCalorimeter(name)
+  return 1
+
+
+def run():
+  hlp = False
+  num_threads = 8
+  num_events = 100
+  #
+  args = sys.argv[1:]
+  for i in list(range(len(args))):
+    c = args[i].upper()
+    if c[:4] == '-THR':
+      num_threads = int(args[i + 1])
+    elif c[:4] == '-EVE':
+      num_events = int(args[i + 1])
+    elif c[:4] == '-ASY':
+      options['async'] = True
+    elif c[:4] == '-QUE':
+      options['queue'] = int(args[i + 1])
+    elif c[:4] == '-COM':
+      options['compression'] = int(args[i + 1])
+    elif c[:4] == '-BAS':
+      options['basket'] = int(args[i + 1])
+    elif c[:2] == '-H':
+      hlp = True
+
+  if hlp:
+    help()
+    sys.exit(1)
+
+  kernel = DDG4.Kernel()
+  install_dir = os.environ['DD4hepINSTALL']
+  kernel.loadGeometry(str("file:" + install_dir + "/DDDetectors/compact/SiD.xml"))
+  DDG4.importConstants(kernel.detectorDescription())
+
+  kernel.NumberOfThreads = num_threads
+  kernel.RunManagerType = 'G4MTRunManager'
+  geant4 = DDG4.Geant4(kernel, tracker='Geant4TrackerCombineAction')
+  geant4.setupCshUI(ui=None, vis=None)
+  kernel.UI = 'UI'
+
+  geant4.addUserInitialization(worker=setupWorker, worker_args=(geant4,),
+                               master=setupMaster, master_args=(geant4,))
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  seq, act = geant4.addDetectorConstruction("Geant4PythonDetectorConstruction/SetupSD",
+                                            sensitives=setupSensitives, sensitives_args=(geant4,))
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorSensitivesConstruction/ConstructSD")
+  geant4.setupTrackingFieldMT()
+
+  rndm = DDG4.Action(kernel, 'Geant4Random/Random')
+  rndm.Seed = 987654321
+  rndm.initialize()
+
+  phys = geant4.setupPhysics('QGSP_BERT')
+  phys.dump()
+
+  kernel.configure()
+  kernel.initialize()
+  kernel.NumEvents = num_events
+  start = time.time()
+  kernel.run()
+  kernel.terminate()
+  secs = time.time() - start
+  logger.info("+++ %d events with %d threads [writer thread: %s] in %.2f seconds: %.2f events/second",
+              num_events, num_threads, 'yes' if options['async'] else 'no', secs, num_events / secs)
+
+
+if __name__ == "__main__":
+  run()
@@ -0,0 +1,130 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+#
+from __future__ import absolute_import, unicode_literals
+import os
+import sys
+import logging
+import DDG4
+from DDG4 import OutputLevel as Output
+from g4units import GeV, mm
+#
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+
+"""
+
+   dd4hep stepping benchmark with the SiD detector
+
+   Measures the number of Geant4 steps per second with the sensitive
+   detectors of SiD attached. Run it once with and once without the
+   touchable cache of the volume manager to compare:
+
+   $> python SiDSteppingBenchmark.py -events 20
+   $> python SiDSteppingBenchmark.py -events 20 -nocache
+
+   The time per event and the allocations of the hit collections
+   are reported as well. To compare the hit storage modes of the
+   calorimeters:
+
+   $> python SiDSteppingBenchmark.py -events 20 -hashed
+
+   @author  M.Frank
+   @version 1.0
+
+"""
+
+
+def help():
+  logging.info("SiDSteppingBenchmark.py -option [-option]                        ")
+  logging.info("       -events <number>         Number of events to simulate      ")
+  logging.info("       -nocache                 Disable the volume ID cache       ")
+  logging.info("       -hashed                  Hashed hit storage in calorimeters")
+
+
+def run():
+  hlp = False
+  cache = True
+  hashed = False
+  num_events = 10
+  #
+  args = sys.argv[1:]
+  for i in list(range(len(args))):
+    c = args[i].upper()
+    if c[:4] == '-EVE':
+      num_events = int(args[i + 1])
+    elif c[:4] == '-NOC':
+      cache = False
+    elif c[:4] == '-HAS':
+      hashed = True
+    elif c[:2] == '-H':
+      hlp = True
+
+  if hlp:
+    help()
+    sys.exit(1)
+
+  kernel = DDG4.Kernel()
+  install_dir = os.environ['DD4hepINSTALL']
+  kernel.loadGeometry(str("file:" + install_dir + "/DDDetectors/compact/SiD.xml"))
+  DDG4.importConstants(kernel.detectorDescription())
+
+  geant4 = DDG4.Geant4(kernel, tracker='Geant4TrackerCombineAction')
+  geant4.setupCshUI(ui=None, vis=None)
+  kernel.UI = 'UI'
+
+  logger.info("#  Configure G4 geometry setup: volume ID cache %s", 'enabled' if cache else 'disabled')
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  act.VolumeIDCache = cache
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorSensitivesConstruction/ConstructSD")
+
+  geant4.setupTrackingField()
+
+  rndm = DDG4.Action(kernel, 'Geant4Random/Random')
+  rndm.Seed = 987654321
+  rndm.initialize()
+
+  logger.info("#  Configure the step counter")
+  step = DDG4.SteppingAction(kernel, 'Geant4StepCounter/StepCounter')
+  kernel.steppingAction().adopt(step)
+
+  gen = DDG4.GeneratorAction(kernel, "Geant4GeneratorActionInit/GenerationInit")
+  kernel.generatorAction().adopt(gen)
+  geant4.setupGun("Gun", particle='pi+', energy=20 * GeV, multiplicity=10, isotrop=True)
+  gen = DDG4.GeneratorAction(kernel, "Geant4InteractionMerger/InteractionMerger")
+  kernel.generatorAction().adopt(gen)
+  gen = DDG4.GeneratorAction(kernel, "Geant4PrimaryHandler/PrimaryHandler")
+  kernel.generatorAction().adopt(gen)
+  part = DDG4.GeneratorAction(kernel, "Geant4ParticleHandler/ParticleHandler")
+  part.OutputLevel = Output.WARNING
+  kernel.generatorAction().adopt(part)
+
+  logger.info("#  Tracking detectors and calorimeters")
+  for name in ['SiVertexBarrel', 'SiVertexEndcap', 'SiTrackerBarrel', 'SiTrackerEndcap', 'SiTrackerForward']:
+    geant4.setupTracker(name)
+  for name in ['EcalBarrel', 'EcalEndcap', 'HcalBarrel', 'HcalEndcap', 'HcalPlug',
+               'MuonBarrel', 'MuonEndcap', 'LumiCal', 'BeamCal']:
+    seq, act = geant4.setupCalorimeter(name)
+    if hashed:
+      act.CollectionOptimization = 4  # Geant4HitCollection::OPTIMIZE_HASHEDSTORAGE
+
+  phys = geant4.setupPhysics('QGSP_BERT')
+  rg = geant4.addPhysics(str('Geant4DefaultRangeCut/GlobalRangeCut'))
+  rg.RangeCut = 0.7 * mm
+  phys.dump()
+
+  geant4.execute(num_events=num_events)
+
+
+if __name__ == "__main__":
+  run()
@@ -14,14 +14,15 @@ logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
 logger = logging.getLogger(__name__)
 
 
-def run(input_file):
+def run(input_file, reader='Geant4EventReaderHepMC', prefetch=0):
   import DDG4
   from DDG4 import OutputLevel as Output
   kernel = DDG4.Kernel()
   kernel.detectorDescription()
   gen = DDG4.GeneratorAction(kernel, "Geant4InputAction/Input")
   kernel.generatorAction().adopt(gen)
-  gen.Input = "Geant4EventReaderHepMC|" + input_file
+  gen.Input = reader + "|" + input_file
+  gen.Prefetch = prefetch
   gen.OutputLevel = Output.DEBUG
   gen.HaveAbort = False
   prim_vtx = DDG4.std_vector(str('dd4hep::sim::Geant4Vertex*'))()
@@ -57,9 +58,16 @@ def run(input_file):
 if __name__ == "__main__":
   import sys
   input_file = None
+  reader = 'Geant4EventReaderHepMC'
+  prefetch = 0
+  for i in range(2, len(sys.argv) - 1):
+    if sys.argv[i] == '-reader':
+      reader = sys.argv[i + 1]
+    elif sys.argv[i] == '-prefetch':
+      prefetch = int(sys.argv[i + 1])
   if len(sys.argv) > 1:
     input_file = sys.argv[1]
-    sys.exit(run(input_file))
+    sys.exit(run(input_file, reader, prefetch))
   else:
     logger.error('No input file given. Try again....')
     sys.exit(2)  # ENOENT
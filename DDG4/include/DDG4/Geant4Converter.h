@@ -57,6 +57,8 @@ namespace dd4hep {
       bool       checkOverlaps;
       /// Property: Output level for debug printing
       PrintLevel outputLevel;
+      /// Property: Number of threads to convert solids concurrently (0, 1: sequential conversion)
+      int        numThreads = 0;
 
       /// Initializing Constructor
       Geant4Converter(const Detector& description);
@@ -95,6 +97,9 @@ namespace dd4hep {
       /// Convert the geometry type solid into the corresponding Geant4 object(s).
       virtual void* handleSolid(const std::string& name, const TGeoShape* volume) const;
 
+      /// Convert a shape to a Geant4 solid without registering it in the geometry information
+      G4VSolid* convertSolid(const std::string& name, const TGeoShape* shape) const;
+
       /// Convert the geometry type logical volume into the corresponding Geant4 object(s).
       virtual void* handleVolume(const std::string& name, const TGeoVolume* volume) const;
       virtual void* collectVolume(const std::string& name, const TGeoVolume* volume) const;
@@ -125,6 +125,8 @@ namespace dd4hep {
       G4VPhysicalVolume*                                       m_world;
       PrintLevel                                               printLevel;
       bool                                                     valid;
+      /// Enable the per-thread touchable cache of the volume manager
+      bool                                                     volumeIDCache = true;
     private:
       friend class Geant4Mapping;
       /// Default constructor
@@ -20,8 +20,11 @@
 #include "G4VHit.hh"
 
 // C/C++ include files
+#include <map>
 #include <vector>
 #include <string>
+#include <memory>
+#include <utility>
 #include <climits>
 #include <typeinfo>
 #include <stdexcept>
@@ -72,8 +75,10 @@ namespace dd4hep {
         const ComponentCast& cast;
         const ComponentCast& vec_type;
 #endif
+        /// In-place destructor for hits, which do not own their memory (arena hits)
+        ComponentCast::destroy_t destruct;
         /// Initializing Constructor
-        HitManipulator(const ComponentCast& c, const ComponentCast& v);
+        HitManipulator(const ComponentCast& c, const ComponentCast& v, ComponentCast::destroy_t d = 0);
         /// Default destructor
         ~HitManipulator();
         /// Check pointer to be of proper type
@@ -97,10 +102,21 @@ namespace dd4hep {
             delete p;
           obj.first = 0;
         }
+        /// Static function to call the destructor of hits without releasing the memory
+        template <typename TYPE> static void destructHit(void* obj) {
+          if (obj)
+            ((TYPE*)obj)->~TYPE();
+        }
         template <typename TYPE> static HitManipulator* instance() {
           static HitManipulator hm(ComponentCast::instance<TYPE>(), ComponentCast::instance<std::vector<TYPE*> >());
           return &hm;
         }
+        /// Manipulator for hits allocated from the arena of a hit collection
+        template <typename TYPE> static HitManipulator* arenaInstance() {
+          static HitManipulator hm(ComponentCast::instance<TYPE>(), ComponentCast::instance<std::vector<TYPE*> >(),
+                                   destructHit<TYPE>);
+          return &hm;
+        }
       };
 
       typedef HitManipulator::Wrapper Wrapper;
@@ -151,6 +167,10 @@ namespace dd4hep {
       template <typename TYPE> static HitManipulator* manipulator() {
         return HitManipulator::instance<TYPE>();
       }
+      /// Generate manipulator object for arena allocated hits
+      template <typename TYPE> static HitManipulator* arenaManipulator() {
+        return HitManipulator::arenaInstance<TYPE>();
+      }
       /// Assignment transfers the pointer ownership
       Geant4HitWrapper& operator=(const Geant4HitWrapper& v) {
         if ( this != & v )  {
@@ -193,6 +213,15 @@ namespace dd4hep {
      * This obviously only helps, if contributions to the same cell come in
      * sequence ie. from the same G4Track.
      *
+     * For collections with very many hits the flag OPTIMIZE_HASHEDSTORAGE
+     * replaces the ordered key map by an open addressing hash table and
+     * allocates the hits created with
+     *
+     *  template <typename TYPE, typename... ARGS> TYPE* create(VolumeID key, ARGS&&... args);
+     *
+     * from a memory arena, which is released in one go when the collection
+     * is cleared or deleted. Hits of such collections are owned by the
+     * collection: they may be accessed, but not released.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -208,6 +237,109 @@ namespace dd4hep {
       /// Hit key map for fast random lookup
       typedef std::map<VolumeID, size_t>  Keys;
 
+      /// Open addressing hash table mapping hit keys to hit indices
+      /**
+       *  Linear probing in a power-of-2 sized table with a maximal load of 50 %.
+       *  Clearing the table keeps the allocated slots for the next event.
+       *
+       * \author  M.Frank
+       * \version 1.0
+       *  \ingroup DD4HEP_SIMULATION
+       */
+      class KeyIndex {
+      public:
+        typedef std::pair<VolumeID, size_t> Slot;
+        /// Index value of unused slots
+        static constexpr size_t EMPTY = ~0UL;
+      protected:
+        /// Table slots
+        std::vector<Slot> m_slots;
+        /// Number of occupied slots
+        size_t            m_count = 0;
+        /// Number of (re-)allocations of the table
+        size_t            m_allocations = 0;
+        /// Hash function
+        static size_t hash(VolumeID key)  {
+          unsigned long long h = key;
+          h ^= h >> 33;
+          h *= 0xff51afd7ed558ccdULL;
+          h ^= h >> 33;
+          return size_t(h);
+        }
+        /// Resize the table to the given number of slots (power of 2)
+        void rehash(size_t num_slots);
+      public:
+        /// Number of entries
+        size_t size() const   {  return m_count;   }
+        /// Number of (re-)allocations of the table
+        size_t allocations() const   {  return m_allocations;   }
+        /// Access the hit index of a key. Returns EMPTY if the key is not present
+        size_t find(VolumeID key) const  {
+          if ( m_count > 0 )  {
+            size_t mask = m_slots.size() - 1;
+            for( size_t i = hash(key) & mask; ; i = (i + 1) & mask )  {
+              const Slot& s = m_slots[i];
+              if ( s.second == EMPTY ) return EMPTY;
+              if ( s.first  == key   ) return s.second;
+            }
+          }
+          return EMPTY;
+        }
+        /// Insert new key. Returns false if the key is already present
+        bool insert(VolumeID key, size_t index);
+        /// Remove all entries
+        void clear();
+        /// Reset the allocation counter
+        void resetAllocations()  {  m_allocations = 0;  }
+      };
+
+      /// Memory arena for hits of collections with hashed storage
+      /**
+       *  Memory is taken from large blocks. All blocks are released in one go.
+       *  Released blocks are kept per thread and reused for the next event.
+       *
+       * \author  M.Frank
+       * \version 1.0
+       *  \ingroup DD4HEP_SIMULATION
+       */
+      class Arena {
+      public:
+        /// Size of one memory block
+        static constexpr size_t BLOCK_SIZE = 64*1024;
+      protected:
+        /// Memory blocks in use
+        std::vector<char*> m_blocks;
+        /// Fill pointer in the current block
+        size_t             m_used = BLOCK_SIZE;
+        /// Number of blocks newly allocated from the heap
+        size_t             m_allocations = 0;
+        /// Attach a new memory block
+        void* extend(size_t len, size_t alignment);
+      public:
+        /// Default constructor
+        Arena() = default;
+        /// No copy constructor
+        Arena(const Arena& copy) = delete;
+        /// Default destructor: release all blocks
+        ~Arena();
+        /// No assignment
+        Arena& operator=(const Arena& copy) = delete;
+        /// Check if the arena holds any memory
+        bool empty() const   {  return m_blocks.empty();  }
+        /// Number of blocks newly allocated from the heap
+        size_t allocations() const   {  return m_allocations;   }
+        /// Allocate memory for an object
+        void* allocate(size_t len, size_t alignment)  {
+          size_t start = (m_used + alignment - 1) & ~(alignment - 1);
+          if ( start + len > BLOCK_SIZE )
+            return extend(len, alignment);
+          m_used = start + len;
+          return m_blocks.back() + start;
+        }
+        /// Release all memory blocks
+        void release();
+      };
+
       /// Generic class template to compare/select hits in Geant4HitCollection objects
       /**
        *
@@ -233,6 +365,7 @@ namespace dd4hep {
         struct BitItems  {
           unsigned           repeatedLookup:1;
           unsigned           mappedLookup:1;
+          unsigned           hashedStorage:1;
         }                    bits;
       };
 
@@ -247,12 +380,28 @@ namespace dd4hep {
       size_t                           m_lastHit;
       /// Hit key map for fast random lookup
       Keys                             m_keys;
+      /// Hit key hash table for fast random lookup (OPTIMIZE_HASHEDSTORAGE)
+      KeyIndex                         m_index;
+      /// Memory arena for hits created by the collection (OPTIMIZE_HASHEDSTORAGE)
+      Arena                            m_arena;
+      /// The manipulator of hits allocated from the arena
+      Manip*                           m_arenaManipulator;
+      /// Number of heap allocations for hits and hit keys
+      size_t                           m_allocations = 0;
       /// Optimization flags
       CollectionFlags                  m_flags;
       
     protected:
       /// Notification to increase the instance counter
       void newInstance();
+      /// Register the hit index of a new key. Returns false if the key is already present
+      bool insertKey(VolumeID key, size_t index);
+      /// Access the hit index of a key. Returns ULONG_MAX if the key is not present
+      size_t findKey(VolumeID key) const  {
+        if ( m_flags.bits.hashedStorage ) return m_index.find(key);
+        Keys::const_iterator i = m_keys.find(key);
+        return i == m_keys.end() ? ULONG_MAX : (*i).second;
+      }
       /// Find hit in a collection by comparison of attributes
       void* findHit(const Compare& cmp);
       /// Find hit in a collection by comparison of the key
@@ -268,6 +417,7 @@ namespace dd4hep {
         OPTIMIZE_NONE = 0,
         OPTIMIZE_REPEATEDLOOKUP = 1<<0,
         OPTIMIZE_MAPPEDLOOKUP   = 1<<1,
+        OPTIMIZE_HASHEDSTORAGE  = 1<<2,
         OPTIMIZE_LAST
       };
 
@@ -276,7 +426,8 @@ namespace dd4hep {
       Geant4HitCollection(const std::string& det, const std::string& coll, Geant4Sensitive* sd)
         : G4VHitsCollection(det, coll), m_detector(sd),
           m_manipulator(Geant4HitWrapper::manipulator<TYPE>()),
-          m_lastHit(ULONG_MAX)
+          m_lastHit(ULONG_MAX),
+          m_arenaManipulator(Geant4HitWrapper::arenaManipulator<TYPE>())
       {
         newInstance();
         m_hits.reserve(200);
@@ -287,7 +438,8 @@ namespace dd4hep {
       Geant4HitCollection(const std::string& det, const std::string& coll, Geant4Sensitive* sd, const TYPE*)
         : G4VHitsCollection(det, coll), m_detector(sd),
           m_manipulator(Geant4HitWrapper::manipulator<TYPE>()),
-          m_lastHit(ULONG_MAX)
+          m_lastHit(ULONG_MAX),
+          m_arenaManipulator(Geant4HitWrapper::arenaManipulator<TYPE>())
       {
         newInstance();
         m_hits.reserve(200);
@@ -302,8 +454,14 @@ namespace dd4hep {
       /// Clear the collection (Deletes all valid references to real hits)
       virtual void clear();
       /// Set optimization flags
-      void setOptimize(int flag)  {
-        m_flags.value |= flag;
+      void setOptimize(int flag);
+      /// Check if the hits may be released. Hits allocated from the arena are owned by the collection
+      bool canReleaseHits() const  {
+        return m_arena.empty();
+      }
+      /// Number of heap allocations for hits and hit keys
+      size_t allocations() const  {
+        return m_allocations + m_index.allocations() + m_arena.allocations();
       }
       /// Set the sensitive detector
       void setSensitive(Geant4Sensitive* detector)   {
@@ -338,24 +496,45 @@ namespace dd4hep {
       /// Add a new hit with a check, that the hit is of the same type
       template <typename TYPE> void add(VolumeID key, TYPE* hit_pointer) {
         m_lastHit = m_hits.size();
-        std::pair<Keys::iterator,bool> ret = m_keys.emplace(key,m_lastHit);
-        if ( ret.second )  {
+        if ( insertKey(key, m_lastHit) )  {
           Geant4HitWrapper w(m_manipulator->castHit(hit_pointer));
           m_hits.emplace_back(w);
           return;
         }
         throw std::runtime_error("Attempt to insert hit with same key to G4 hit-collection "+GetName());
       }
+      /// Create a new hit and add it with a key to the collection
+      /** With OPTIMIZE_HASHEDSTORAGE the hit is allocated from the arena
+       *  of the collection, otherwise from the heap.
+       */
+      template <typename TYPE, typename... ARGS> TYPE* create(VolumeID key, ARGS&&... args) {
+        if ( !m_flags.bits.hashedStorage )  {
+          std::unique_ptr<TYPE> hit(new TYPE(std::forward<ARGS>(args)...));
+          add(key, hit.get());
+          ++m_allocations;
+          return hit.release();
+        }
+        if ( findKey(key) != ULONG_MAX )  {
+          throw std::runtime_error("Attempt to insert hit with same key to G4 hit-collection "+GetName());
+        }
+        TYPE* hit = new(m_arena.allocate(sizeof(TYPE), alignof(TYPE))) TYPE(std::forward<ARGS>(args)...);
+        Geant4HitWrapper::Wrapper w = m_manipulator->castHit(hit);
+        w.second = m_arenaManipulator;
+        m_lastHit = m_hits.size();
+        m_hits.emplace_back(Geant4HitWrapper(w));
+        insertKey(key, m_lastHit);
+        return hit;
+      }
       /// Find hits in a collection by comparison of attributes
       template <typename TYPE> TYPE* find(const Compare& cmp) {
         return (TYPE*) findHit(cmp);
       }
       /// Find hits in a collection by comparison of key value
       template <typename TYPE> TYPE* findByKey(VolumeID key) {
-        Keys::const_iterator i=m_keys.find(key);
-        if ( i == m_keys.end() ) return 0;
-        m_lastHit = (*i).second;
-        TYPE* obj = m_hits.at(m_lastHit);
+        size_t index = findKey(key);
+        if ( index == ULONG_MAX ) return 0;
+        m_lastHit = index;
+        TYPE* obj = m_hits[m_lastHit];
         return obj;
       }
       /// Release all hits from the Geant4 container and pass ownership to the caller
@@ -366,6 +545,7 @@ namespace dd4hep {
         }
         m_lastHit = ULONG_MAX;
         m_keys.clear();
+        m_index.clear();
         return vec;
       }
       /// Release all hits from the Geant4 container and pass ownership to the caller
@@ -77,6 +77,9 @@ namespace dd4hep  {
       std::string m_name;
       /// Flag if direct event access is supported. To be explicitly set by subclass constructors
       bool m_directAccess;
+      /// Flag if events may be read by a separate thread. To be explicitly set by subclass constructors
+      /** Readers must not access the event context while reading if the flag is set. */
+      bool m_asyncAccess;
       /// Current event number
       int  m_currEvent;
       /// The input action context
@@ -112,6 +115,8 @@ namespace dd4hep  {
       const std::string& name()  const   {  return m_name;         }
       /// Flag if direct event access (by event sequence number) is supported (Default: false)
       bool hasDirectAccess() const       {  return m_directAccess; }
+      /// Flag if events may be read ahead by a separate thread (Default: false)
+      bool hasAsyncAccess() const        {  return m_asyncAccess;  }
       /// return current Event Number
       int currentEventNumber() const     {  return m_currEvent;    }
       /// Move to the indicated event number.
@@ -144,6 +149,10 @@ namespace dd4hep  {
      * Concrete implementation of the Geant4 generator action base class
      * populating Geant4 primaries from Geant4 and HepStd files.
      *
+     * If the property "Prefetch" is set to N > 0 and the reader supports it,
+     * the next N events are read and parsed by a separate thread while the
+     * current event is simulated.
+     *
      *  \author  P.Kostka (main author)
      *  \author  M.Frank  (code reshuffeling into new DDG4 scheme)
      *  \version 1.0
@@ -156,6 +165,7 @@ namespace dd4hep  {
       typedef Geant4Particle Particle;
       typedef std::vector<Particle*> Particles;
       typedef std::vector<Vertex*> Vertices;
+      class Prefetcher;
     protected:
       /// Property: input file
       std::string         m_input;
@@ -173,6 +183,10 @@ namespace dd4hep  {
       bool m_abort;
       /// Property: named parameters to configure file readers or input actions
       std::map< std::string, std::string> m_parameters;
+      /// Property: number of events to be read ahead by a separate thread (0: disabled)
+      int                 m_prefetch;
+      /// Thread reading ahead the input events if enabled
+      std::unique_ptr<Prefetcher> m_prefetcher;
 
     public:
       /// Read an event and return a LCCollectionVec of MCParticles.
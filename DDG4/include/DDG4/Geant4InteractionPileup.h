@@ -0,0 +1,120 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+/** \addtogroup Geant4GeneratorAction
+ *
+ @{
+   \package Geant4InteractionPileup
+ * \brief Geant4Action to overlay pileup interactions from an in-memory event pool
+@}
+ */
+
+#ifndef DDG4_GEANT4INTERACTIONPILEUP_H
+#define DDG4_GEANT4INTERACTIONPILEUP_H
+
+// Framework include files
+#include "DDG4/Geant4GeneratorAction.h"
+
+// ROOT include files
+#include "Math/Vector4D.h"
+
+// C/C++ include files
+#include <map>
+#include <memory>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Forward declarations
+    class Geant4Random;
+
+    /// Geant4Action to overlay pileup interactions from an in-memory event pool
+    /** The action reads once a number of events (typically minimum bias) from the
+     *  input given by the property "Input" (same syntax as for the
+     *  \tt{Geant4InputAction}) into memory. For every signal event a number of
+     *  these events is sampled according to a poisson distribution of mean
+     *  "MeanPileup" (or exactly "MeanPileup" if "Poisson" is false). Each sampled
+     *  event is copied into a new \tt{Geant4PrimaryInteraction} and added to the
+     *  \tt{Geant4PrimaryEvent} with the interaction masks "Mask", "Mask"+1, ...
+     *  The momenta of the copied particles are scaled by "MomentumScale" as
+     *  done by the \tt{Geant4InputAction}.
+     *  The primary vertex of each copy is smeared by a 4D gaussian given by the
+     *  properties "Offset" and "Sigma". The time component allows to distribute
+     *  the pileup interactions within the bunch train.
+     *  The interactions are merged with the signal by the \tt{Geant4InteractionMerger}.
+     *
+     *  The event pool is loaded on first use and shared read-only by all
+     *  instances (e.g. of all worker threads) with identical input properties.
+     *  The size of the pool is limited by the properties "PoolSize" (number of
+     *  events) and "MaxMemory" (approximate memory footprint in MB).
+     *  Only readers supporting asynchronous access may be used.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class Geant4InteractionPileup : public Geant4GeneratorAction    {
+    public:
+      /// Shared pool of pre-loaded pileup events
+      class Pool;
+
+    protected:
+      /// Property: input file (Reader-type|file-name)
+      std::string m_input;
+      /// Property: named parameters to configure the file reader
+      std::map<std::string, std::string> m_parameters;
+      /// Property: maximal number of events loaded into the pool
+      int         m_poolSize;
+      /// Property: approximate memory budget of the pool in MB (0: no limit)
+      double      m_maxMemory;
+      /// Property: mean number of pileup interactions per event
+      double      m_mean;
+      /// Property: flag to sample the number of pileup interactions from a poisson distribution
+      bool        m_poisson;
+      /// Property: interaction mask of the first pileup interaction
+      int         m_mask;
+      /// Property: momentum scale factor of the pileup particles
+      double      m_momScale;
+      /// Property: the constant vertex smearing offset
+      ROOT::Math::PxPyPzEVector m_offset;
+      /// Property: the gaussian vertex smearing sigmas to the offset
+      ROOT::Math::PxPyPzEVector m_sigma;
+      /// Reference to the shared event pool
+      std::shared_ptr<const Pool> m_pool;
+
+      /// Access or load the event pool according to the properties
+      std::shared_ptr<const Pool> pool();
+      /// Load the event pool according to the properties
+      std::shared_ptr<const Pool> load()  const;
+      /// Sample the number of pileup interactions for one event
+      int multiplicity(Geant4Random& rndm)  const;
+
+    public:
+      /// Inhibit default constructor
+      Geant4InteractionPileup() = delete;
+      /// Inhibit copy constructor
+      Geant4InteractionPileup(const Geant4InteractionPileup& copy) = delete;
+      /// Standard constructor
+      Geant4InteractionPileup(Geant4Context* context, const std::string& nam);
+      /// Default destructor
+      virtual ~Geant4InteractionPileup();
+      /// Event generation action callback
+      virtual void operator()(G4Event* event);
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+
+#endif // DDG4_GEANT4INTERACTIONPILEUP_H
@@ -16,6 +16,9 @@
 // Framework include files
 #include "DDG4/Geant4OutputAction.h"
 
+// C/C++ include files
+#include <memory>
+
 class TFile;
 class TTree;
 class TBranch;
@@ -30,12 +33,22 @@ namespace dd4hep {
 
     /// Class to output Geant4 event data to ROOT files
     /**
+     *  If the property "WriterThread" is set, the event data are handed
+     *  to a dedicated writer thread through a bounded queue of "QueueSize"
+     *  events. The hits are then taken over by the output: they are removed
+     *  from their collections. Hence this action must be the last consumer
+     *  of the hit collections. Events with hits owned by their collection
+     *  (see Geant4HitCollection::OPTIMIZE_HASHEDSTORAGE) are written
+     *  synchronously after the queue was drained.
+     *
      *  \author  M.Frank
      *  \version 1.0
      *  \ingroup DD4HEP_SIMULATION
      */
     class Geant4Output2ROOT: public Geant4OutputAction {
     protected:
+      class Record;
+      class Writer;
       typedef std::map<std::string, TBranch*> Branches;
       typedef std::map<std::string, TTree*> Sections;
       /// Known file sections
@@ -54,6 +67,25 @@ namespace dd4hep {
       std::vector<std::string> m_disabledCollections;
       /// Property: vector with disabled collections
       bool  m_disableParticles = false;
+      /// Property: Write the event data from a dedicated writer thread
+      bool  m_writerThread = false;
+      /// Property: Maximal number of events queued for the writer thread
+      int   m_queueSize = 8;
+      /// Property: Buffer size of the branches
+      int   m_basketSize = 32000;
+      /// Property: Compression level of the output file (-1: ROOT default)
+      int   m_compressionLevel = -1;
+      /// Property: Auto-flush setting of the event tree (0: ROOT default)
+      long  m_autoFlush = 0;
+      /// Writer thread if enabled
+      std::unique_ptr<Writer> m_writer;
+      /// Event record handed to the writer thread
+      std::unique_ptr<Record> m_record;
+
+      /// Fill NULL pointers to all branches, which have less entries than the event and close the entry
+      void commitEntry();
+      /// Write an event record handed over to the writer thread
+      void write(Record& record);
       
     public:
       /// Standard constructor
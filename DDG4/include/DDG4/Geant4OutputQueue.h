@@ -0,0 +1,176 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDG4_GEANT4OUTPUTQUEUE_H
+#define DDG4_GEANT4OUTPUTQUEUE_H
+
+// Framework include files
+#include "DD4hep/Printout.h"
+
+// C/C++ include files
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <string>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Writer thread of output actions fed by a bounded queue of event records
+    /**
+     *  Event records are queued by the simulation threads and written in order
+     *  by a dedicated thread. The queue is bounded: producers wait if the
+     *  writer falls behind. If requested, written records are kept for reuse
+     *  and may be obtained with acquire(). Otherwise they are deleted by
+     *  the writer thread.
+     *
+     *  Exceptions of the writer are printed. If they are fatal, the first one
+     *  is rethrown to the producer at the next call to push() or drain().
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    template <typename RECORD> class Geant4OutputQueue  {
+    public:
+      typedef std::unique_ptr<RECORD>      record_t;
+      typedef std::function<void(RECORD&)> write_t;
+
+    protected:
+      /// Name of the output for printouts
+      std::string               m_name;
+      /// Callback to write one record
+      write_t                   m_write;
+      /// Maximal number of queued events
+      std::size_t               m_maxQueue;
+      /// Flag to report exceptions of the writer to the producers
+      bool                      m_fatal;
+      /// Flag to keep written records for reuse
+      bool                      m_recycle;
+      /// Protection of the queues
+      std::mutex                m_lock;
+      /// Signal that an event was taken from the queue or written
+      std::condition_variable   m_written;
+      /// Signal that an event was queued
+      std::condition_variable   m_queued;
+      /// Queue of events to be written
+      std::deque<record_t>      m_queue;
+      /// Written records available for reuse
+      std::vector<record_t>     m_spare;
+      /// Exception of the writer thread to be reported to the producers
+      std::exception_ptr        m_error;
+      /// Flag that an event is being written
+      bool                      m_busy = false;
+      /// Flag to stop the writer thread once the queue is empty
+      bool                      m_stop = false;
+      /// The writer thread
+      std::thread               m_worker;
+
+      /// Report an exception of the writer thread. Lock must be held
+      void check()  {
+        if ( m_error )  {
+          std::exception_ptr e = m_error;
+          m_error = nullptr;
+          std::rethrow_exception(e);
+        }
+      }
+      /// Thread function
+      void run()  {
+        for(;;)  {
+          record_t rec;
+          {
+            std::unique_lock<std::mutex> guard(m_lock);
+            m_queued.wait(guard, [this]() { return m_stop || !m_queue.empty(); });
+            if ( m_queue.empty() ) return;
+            rec = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_busy = true;
+          }
+          m_written.notify_all();
+          try  {
+            m_write(*rec);
+          }
+          catch(const std::exception& e)  {
+            printout(ERROR, m_name, "+++ Exception while writing event:%s", e.what());
+            if ( m_fatal )  {
+              std::lock_guard<std::mutex> guard(m_lock);
+              if ( !m_error ) m_error = std::current_exception();
+            }
+          }
+          if ( !m_recycle ) rec.reset();
+          {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if ( rec && m_spare.size() <= m_maxQueue ) m_spare.emplace_back(std::move(rec));
+            m_busy = false;
+          }
+          m_written.notify_all();
+        }
+      }
+
+    public:
+      /// Initializing constructor: starts the writer thread
+      Geant4OutputQueue(const std::string& nam, std::size_t num, bool fatal, write_t write, bool recycle = false)
+        : m_name(nam), m_write(std::move(write)), m_maxQueue(num > 0 ? num : 1),
+          m_fatal(fatal), m_recycle(recycle)
+      {
+        m_worker = std::thread([this]() { this->run(); });
+      }
+      /// Inhibit copy constructor
+      Geant4OutputQueue(const Geant4OutputQueue& copy) = delete;
+      /// Inhibit assignment
+      Geant4OutputQueue& operator=(const Geant4OutputQueue& copy) = delete;
+      /// Default destructor: write all queued events and stop the thread
+      virtual ~Geant4OutputQueue()  {
+        {
+          std::lock_guard<std::mutex> guard(m_lock);
+          m_stop = true;
+        }
+        m_queued.notify_all();
+        m_worker.join();
+      }
+      /// Access a written record for reuse if available
+      record_t acquire()  {
+        std::lock_guard<std::mutex> guard(m_lock);
+        record_t rec;
+        if ( !m_spare.empty() )  {
+          rec = std::move(m_spare.back());
+          m_spare.pop_back();
+        }
+        return rec;
+      }
+      /// Queue event record. Waits if the queue is full
+      void push(record_t&& rec)  {
+        std::unique_lock<std::mutex> guard(m_lock);
+        m_written.wait(guard, [this]() { return m_queue.size() < m_maxQueue; });
+        check();
+        m_queue.emplace_back(std::move(rec));
+        guard.unlock();
+        m_queued.notify_one();
+      }
+      /// Wait until all queued events are written
+      void drain()  {
+        std::unique_lock<std::mutex> guard(m_lock);
+        m_written.wait(guard, [this]() { return m_queue.empty() && !m_busy; });
+        check();
+      }
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+#endif // DDG4_GEANT4OUTPUTQUEUE_H
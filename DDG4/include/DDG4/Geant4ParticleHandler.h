@@ -28,6 +28,7 @@
 #include "DDG4/Geant4Primary.h"
 #include "DDG4/Geant4GeneratorAction.h"
 #include "DDG4/Geant4MonteCarloTruth.h"
+#include "DDG4/Geant4ParticleTable.h"
 
 // Forward declarations
 class G4Step;
@@ -117,10 +118,12 @@ namespace dd4hep {
       Geant4PrimaryMap* m_primaryMap;
       /// Local buffer about the 'current' G4Track
       Particle          m_currTrack;
-      /// Map with stored MC Particles
-      ParticleMap       m_particleMap;
-      /// Map associating the G4Track identifiers with identifiers of existing MCParticles
-      TrackEquivalents  m_equivalentTracks;
+      /// Particle candidates and track equivalents indexed by the G4Track identifier
+      Geant4ParticleTable    m_tracks;
+      /// Final MC particles indexed by the particle identifier (filled by rebaseSimulatedTracks)
+      std::vector<Particle*> m_particles;
+      /// Final association of the G4Track identifiers with the identifiers of the MC particles
+      std::vector<int>       m_equivalents;
 
       /// Recombine particles and associate the to parents with cleanup
       int recombineParents();
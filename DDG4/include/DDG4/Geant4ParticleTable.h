@@ -0,0 +1,133 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDG4_GEANT4PARTICLETABLE_H
+#define DDG4_GEANT4PARTICLETABLE_H
+
+// Framework include files
+#include "DDG4/Geant4Particle.h"
+
+// C/C++ include files
+#include <vector>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Flat table of the Geant4 tracks of one event
+    /**
+     *  The Geant4 track identifiers of an event are dense. Hence the table
+     *  is a vector indexed by the track identifier. Each entry holds the MC
+     *  particle candidate of the track (if any) and the equivalent track,
+     *  which inherits the MC truth of the track if it is not kept.
+     *  This replaces the map lookups during tracking and during the
+     *  reduction of the MC record at the end of the event.
+     *
+     *  Particle candidates dropped from the table are kept in a pool and
+     *  handed out again by newParticle(). The table owns one reference
+     *  of each particle it contains.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class Geant4ParticleTable  {
+    public:
+      typedef Geant4Particle Particle;
+      /// Marker for unknown tracks and particles
+      enum { INVALID = -1 };
+      /// Table entry of one Geant4 track
+      struct Entry  {
+        /// MC particle candidate of this track
+        Particle* particle = nullptr;
+        /// Equivalent track if the track is not kept
+        int       equivalent = INVALID;
+      };
+
+    protected:
+      /// Table entries indexed by the Geant4 track identifier
+      std::vector<Entry>     m_tracks;
+      /// Pool of unused particle objects
+      std::vector<Particle*> m_pool;
+      /// Largest track identifier in the table
+      int                    m_maxID = INVALID;
+      /// Number of particle candidates in the table
+      int                    m_numParticles = 0;
+
+    public:
+      /// Default constructor
+      Geant4ParticleTable() = default;
+      /// No copy constructor
+      Geant4ParticleTable(const Geant4ParticleTable& copy) = delete;
+      /// Default destructor
+      ~Geant4ParticleTable();
+      /// No assignment operator
+      Geant4ParticleTable& operator=(const Geant4ParticleTable& copy) = delete;
+
+      /// Release all particles and reset the table. The allocated memory is kept
+      void clear();
+      /// Reset the table without releasing the particles (ownership was passed on)
+      void reset();
+      /// Upper bound of the track identifiers in the table
+      int  size()  const                {  return m_maxID+1;                   }
+      /// Number of particle candidates in the table
+      int  numParticles()  const        {  return m_numParticles;              }
+      /// Access the particle candidate of a track
+      Particle* particle(int g4_id) const  {
+        return size_t(g4_id) < m_tracks.size() ? m_tracks[g4_id].particle : nullptr;
+      }
+      /// Access the equivalent track of a track
+      int equivalent(int g4_id) const  {
+        return size_t(g4_id) < m_tracks.size() ? m_tracks[g4_id].equivalent : int(INVALID);
+      }
+      /// Set the equivalent track of a track
+      void setEquivalent(int g4_id, int equiv)  {
+        entry(g4_id).equivalent = equiv;
+      }
+      /// Add a particle to the table. The table takes over one reference
+      void setParticle(int g4_id, Particle* p)  {
+        Entry& e = entry(g4_id);
+        if ( !e.particle ) ++m_numParticles;
+        e.particle = p;
+      }
+      /// Create a new particle candidate for a track. Pooled objects are reused
+      Particle* newParticle(int g4_id);
+      /// Remove the particle candidate of a track from the table
+      void dropParticle(int g4_id);
+      /// Find the track holding the particle candidate, which inherits the MC truth of a track
+      int  stored(int g4_id)  const;
+
+    protected:
+      /// Access the table entry of a track. The table is extended if necessary
+      Entry& entry(int g4_id)  {
+        if ( size_t(g4_id) >= m_tracks.size() ) m_tracks.resize(2*size_t(g4_id)+16);
+        if ( g4_id > m_maxID ) m_maxID = g4_id;
+        return m_tracks[g4_id];
+      }
+    };
+
+    /// Find the track holding the particle candidate, which inherits the MC truth of a track
+    inline int Geant4ParticleTable::stored(int g4_id)  const   {
+      for( int id = g4_id; size_t(id) < m_tracks.size(); )   {
+        const Entry& e = m_tracks[id];
+        if ( e.particle ) return id;
+        if ( e.equivalent == id ) break;
+        id = e.equivalent;
+      }
+      return INVALID;
+    }
+  }    // End namespace sim
+}      // End namespace dd4hep
+
+#endif // DDG4_GEANT4PARTICLETABLE_H
@@ -130,6 +130,8 @@ namespace dd4hep {
     protected:
       /// Property: Hit creation mode. Maybe one of the enum HitCreationFlags
       int  m_hitCreationMode = 0;
+      /// Property: Optimization flags of the hit collections. See Geant4HitCollection::OptimizationFlags
+      int  m_collectionOptimization = 0;
 #if defined(G__ROOT) || defined(__CLING__) || defined(__ROOTCLING__)
       /// Reference to the detector description object
       Detector*            m_detDesc {0};
@@ -169,6 +171,11 @@ namespace dd4hep {
         return m_hitCreationMode;
       }
 
+      /// Property access to the optimization flags of the hit collections
+      int collectionOptimization() const  {
+        return m_collectionOptimization;
+      }
+
       /// G4VSensitiveDetector internals: Access to the detector name
       std::string detectorName() const {
         return detector().name();
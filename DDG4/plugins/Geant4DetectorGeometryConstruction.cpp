@@ -26,6 +26,9 @@ namespace dd4hep {
      *  On demand (ie. when calling "Construct") the dd4hep geometry is converted
      *  to Geant4 with all volumes, assemblies, shapes, materials etc.
      *  The actuak work is performed by the Geant4Converter class called by this method.
+     *  If the property "GeometryCache" names a directory, the converted geometry
+     *  is saved there and restored by subsequent jobs with the same geometry
+     *  (see Geant4GeometryCache).
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -56,10 +59,17 @@ namespace dd4hep {
       /// Property: Flag to dump all sensitives after the conversion procedure
       bool m_printSensitives        = false;
 
+      /// Property: Flag to cache touchable lookups of the Geant4 volume manager
+      bool m_volumeIDCache          = true;
+      /// Property: Number of threads to convert the solids (default: 0, sequential)
+      int  m_conversionThreads      = 0;
+
       /// Property: Printout level of info object
       int  m_geoInfoPrintLevel;
       /// Property: G4 GDML dump file name (default: empty. If non empty, dump)
       std::string m_dumpGDML;
+      /// Property: Directory of the geometry cache (default: empty. If non empty, use cache)
+      std::string m_geometryCache;
 
       /// Write GDML file
       int writeGDML(const char* gdml_output);
@@ -107,6 +117,7 @@ namespace dd4hep {
 #include <DDG4/Geant4Converter.h>
 #include <DDG4/Geant4Kernel.h>
 #include <DDG4/Factories.h>
+#include "Geant4GeometryCache.h"
 
 #include <TGeoScaledShape.h>
 
@@ -123,6 +134,7 @@ namespace dd4hep {
 //#endif
 
 #include <cmath>
+#include <memory>
 
 using namespace std;
 using namespace dd4hep;
@@ -145,9 +157,12 @@ Geant4DetectorGeometryConstruction::Geant4DetectorGeometryConstruction(Geant4Con
   declareProperty("PrintPlacements",   m_printPlacements);
   declareProperty("PrintSensitives",   m_printSensitives);
   declareProperty("GeoInfoPrintLevel", m_geoInfoPrintLevel = DEBUG);
+  declareProperty("VolumeIDCache",     m_volumeIDCache);
+  declareProperty("ConversionThreads", m_conversionThreads);
 
   declareProperty("DumpHierarchy",     m_dumpHierarchy);
   declareProperty("DumpGDML",          m_dumpGDML="");
+  declareProperty("GeometryCache",     m_geometryCache="");
   InstanceCount::increment(this);
 }
 
@@ -169,15 +184,28 @@ void Geant4DetectorGeometryConstruction::constructGeo(Geant4DetectorConstruction
   conv.debugSurfaces    = m_debugSurfaces;
   conv.debugPlacements  = m_debugPlacements;
   conv.debugReflections = m_debugReflections;
+  conv.numThreads       = m_conversionThreads;
 
-  ctxt->geometry = conv.create(world).detach();
+  unique_ptr<Geant4GeometryCache> cache;
+  if ( !m_geometryCache.empty() )  {
+    cache.reset(new Geant4GeometryCache(ctxt->description, m_geometryCache, outputLevel()));
+    ctxt->geometry = cache->restore(conv, world);
+  }
+  bool restored = ctxt->geometry != nullptr;
+  if ( !restored )  {
+    ctxt->geometry = conv.create(world).detach();
+  }
   ctxt->geometry->printLevel = outputLevel();
+  ctxt->geometry->volumeIDCache = m_volumeIDCache;
   g4map.attach(ctxt->geometry);
   G4VPhysicalVolume* w = ctxt->geometry->world();
   // Save away the reference to the world volume
   context()->kernel().setWorld(w);
   // Create Geant4 volume manager only if not yet available
   g4map.volumeManager();
+  if ( cache && !restored )  {
+    cache->save(*ctxt->geometry, world);
+  }
   if ( m_dumpHierarchy != 0 )   {
     Geant4HierarchyDump dmp(ctxt->description, m_dumpHierarchy);
     dmp.dump("",w);
@@ -97,6 +97,7 @@ Geant4EventReaderGuineaPig::Geant4EventReaderGuineaPig(const string& nam)
       " Error:"+string(strerror(errno));
     throw runtime_error(err);
   }
+  m_asyncAccess = true;
 }
 
 /// Default destructor
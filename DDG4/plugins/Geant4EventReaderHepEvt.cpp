@@ -130,6 +130,7 @@ Geant4EventReaderHepEvt::Geant4EventReaderHepEvt(const string& nam, int format)
       " Error:"+string(strerror(errno));
     throw runtime_error(err);
   }
+  m_asyncAccess = true;
 }
 
 /// Default destructor
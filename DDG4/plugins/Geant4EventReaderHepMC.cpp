@@ -15,7 +15,7 @@
  *
  @{
   \package Geant4EventReaderHepMC
- * \brief Plugin to read HepMC2 ASCII files
+ * \brief Plugins to read HepMC2 ASCII files
  *
  *
 @}
@@ -27,6 +27,7 @@
 #include "DDG4/Geant4InputAction.h"
 
 // C/C++ include files
+#include <cstdint>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -36,8 +37,12 @@ namespace dd4hep {
 
     /// HepMC namespace declaration
     namespace HepMC {
+      /// HepMC EventData class used internally by the Geant4EventReaderHepMC plugins
+      class EventData;
       /// HepMC EventStream class used internally by the Geant4EventReaderHepMC plugin
       class EventStream;
+      /// HepMC MappedInput class used internally by the Geant4EventReaderHepMCMapped plugin
+      class MappedInput;
     }
 
     /// Class to populate Geant4 primaries from HepMC(2) files.
@@ -73,6 +78,67 @@ namespace dd4hep {
       virtual EventReaderStatus skipEvent() override { return EVENT_READER_OK; }
 
     };
+
+    /// Class to populate Geant4 primaries from memory mapped HepMC(2) files.
+    /**
+     *  Reads the same HepMC ASCII format as Geant4EventReaderHepMC, but
+     *  parses the lines directly from the memory mapped file without
+     *  copying them to string streams.
+     *
+     *  Direct access to events is supported by an index of the event
+     *  offsets in the file. The index is built when the first event is
+     *  not read in sequence (e.g. when skipping events) and cached in
+     *  the file given by the parameter "IndexFile" (Default: input file
+     *  name with extension ".idx". Empty: do not cache).
+     *
+     *  Regular files only: use Geant4EventReaderHepMC to read from pipes.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class Geant4EventReaderHepMCMapped : public Geant4EventReader  {
+      typedef HepMC::EventData   EventData;
+      typedef HepMC::MappedInput MappedInput;
+    protected:
+      /// Start of the memory mapped input file
+      const char*           m_data;
+      /// Size of the memory mapped input file
+      size_t                m_size;
+      /// Modification time of the input file to validate the index cache
+      long                  m_time;
+      /// File offsets of the event records. Built on demand
+      std::vector<uint64_t> m_offsets;
+      /// Parameter: Name of the file caching the event offsets
+      std::string           m_indexFile;
+      /// Current position in the mapped file
+      MappedInput*          m_input;
+      /// Data of the current event
+      EventData*            m_events;
+
+      /// Load the event offsets from the index file
+      bool loadIndex();
+      /// Save the event offsets to the index file
+      void saveIndex()  const;
+      /// Build the event offset index
+      void buildIndex();
+
+    public:
+      /// Initializing constructor
+      explicit Geant4EventReaderHepMCMapped(const std::string& nam);
+      /// Default destructor
+      virtual ~Geant4EventReaderHepMCMapped();
+      /// Read an event and fill a vector of MCParticles.
+      virtual EventReaderStatus readParticles(int event_number,
+                                              Vertices& vertices,
+                                              std::vector<Particle*>& particles)  override;
+      /// Move to the indicated event number using the event index
+      virtual EventReaderStatus moveToEvent(int event_number)  override;
+      /// Skip event
+      virtual EventReaderStatus skipEvent() override  { return moveToEvent(m_currEvent+1); }
+      /// Set the parameters of the reader
+      virtual EventReaderStatus setParameters(std::map< std::string, std::string >& parameters)  override;
+    };
   }     /* End namespace sim   */
 }       /* End namespace dd4hep       */
 
@@ -92,7 +158,14 @@ namespace dd4hep {
 
 // C/C++ include files
 #include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 using namespace std;
 using namespace dd4hep::sim;
@@ -100,6 +173,7 @@ typedef dd4hep::detail::ReferenceBitMask<int> PropertyMask;
 
 // Factory entry
 DECLARE_GEANT4_EVENT_READER(Geant4EventReaderHepMC)
+DECLARE_GEANT4_EVENT_READER(Geant4EventReaderHepMCMapped)
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -138,20 +212,18 @@ namespace dd4hep {
       /// The known_io enum is used to track which type of input is being read
       enum known_io { gen=1, ascii, extascii, ascii_pdt, extascii_pdt };
 
-      /// HepMC EventStream class used internally by the Geant4EventReaderHepMC plugin
+      /// HepMC EventData class used internally by the Geant4EventReaderHepMC plugins
       /*
        *  \author  P.Kostka (main author)
        *  \author  M.Frank  (code reshuffeling into new DDG4 scheme)
        *  \version 1.0
        *  \ingroup DD4HEP_SIMULATION
        */
-      class EventStream {
+      class EventData {
       public:
         typedef std::map<int,Geant4Vertex*> Vertices;
         typedef std::map<int,Geant4Particle*> Particles;
 
-        istream& instream;
-
         // io information
         string key;
         double mom_unit, pos_unit;
@@ -163,34 +235,180 @@ namespace dd4hep {
         Particles m_particles;
 
         /// Default constructor
-        EventStream(istream& in) : instream(in), mom_unit(0.0), pos_unit(0.0),
-                                   io_type(0), xsection(0.0), xsection_err(0.0)
+        EventData() : mom_unit(0.0), pos_unit(0.0),
+                      io_type(0), xsection(0.0), xsection_err(0.0)
         { use_default_units();                       }
-        /// Check if data stream is in proper state and has data
-        bool ok()  const;
-        Geant4Vertex* vertex(int i);
         Particles& particles() { return m_particles; }
         Vertices&  vertices()  { return m_vertices;  }
         void set_io(int typ, const string& k)
         { io_type = typ;    key = k;                 }
         void use_default_units()
         { mom_unit = CLHEP::MeV;   pos_unit = CLHEP::mm;           }
-        bool read();
         void clear();
       };
 
+      /// HepMC EventStream class used internally by the Geant4EventReaderHepMC plugin
+      /*
+       *  \author  P.Kostka (main author)
+       *  \author  M.Frank  (code reshuffeling into new DDG4 scheme)
+       *  \version 1.0
+       *  \ingroup DD4HEP_SIMULATION
+       */
+      class EventStream : public EventData {
+      public:
+        istream& instream;
+
+        /// Default constructor
+        EventStream(istream& in) : EventData(), instream(in)  {  }
+        /// Check if data stream is in proper state and has data
+        bool ok()  const;
+        bool read();
+      };
+
+      /// Zero-copy tokenizer of one line of a memory mapped file
+      /**
+       *  Supports the subset of the istringstream interface used
+       *  by the line parsers below.
+       *
+       *  \author  M.Frank
+       *  \version 1.0
+       *  \ingroup DD4HEP_SIMULATION
+       */
+      class LineParser  {
+      public:
+        const char* begin  = nullptr;
+        const char* ptr    = nullptr;
+        const char* end    = nullptr;
+        bool        failed = false;
+
+        /// Attach the parser to a new line
+        void assign(const char* b, const char* e)
+        {  begin = ptr = b; end = e; failed = false;     }
+        bool fail()  const                  {  return failed;      }
+        bool eof()   const                  {  return ptr >= end;  }
+        bool operator!()  const             {  return failed;      }
+        explicit operator bool()  const     {  return !failed;     }
+        void clear()                        {  failed = false;     }
+        string str()  const                 {  return string(begin, end); }
+        /// Skip leading blanks and return the end of the next token
+        const char* token()  {
+          while( ptr < end && ::isspace((unsigned char)*ptr) ) ++ptr;
+          const char* e = ptr;
+          while( e < end && !::isspace((unsigned char)*e) ) ++e;
+          return e;
+        }
+        /// Extract an integer number
+        template <typename T> LineParser& integer(T& value)  {
+          const char* e = token(), *p = ptr;
+          bool neg = p < e && *p == '-';
+          if ( p < e && (*p == '-' || *p == '+') ) ++p;
+          if ( failed || p == e || !::isdigit((unsigned char)*p) )  {
+            failed = true;
+            return *this;
+          }
+          T val = 0;
+          for( ; p < e && ::isdigit((unsigned char)*p); ++p ) val = 10*val + T(*p - '0');
+          value = neg ? T(0)-val : val;
+          ptr = p;
+          return *this;
+        }
+        /// Extract a floating point number
+        template <typename T> LineParser& real(T& value, T (*convert)(const char*, char**))  {
+          char buff[64], *stop = nullptr;
+          const char* e = token();
+          size_t len = e - ptr;
+          if ( failed || len == 0 || len >= sizeof(buff) )  {
+            failed = true;
+            return *this;
+          }
+          ::memcpy(buff, ptr, len);
+          buff[len] = 0;
+          T val = (*convert)(buff, &stop);
+          if ( stop == buff )  {
+            failed = true;
+            return *this;
+          }
+          value = val;
+          ptr += stop - buff;
+          return *this;
+        }
+        LineParser& operator>>(int& value)            {  return integer(value);       }
+        LineParser& operator>>(long& value)           {  return integer(value);       }
+        LineParser& operator>>(unsigned long& value)  {  return integer(value);       }
+        LineParser& operator>>(float& value)          {  return real(value, ::strtof); }
+        LineParser& operator>>(double& value)         {  return real(value, ::strtod); }
+        LineParser& operator>>(string& value)  {
+          const char* e = token();
+          if ( failed || e == ptr )  {
+            failed = true;
+            return *this;
+          }
+          value.assign(ptr, e);
+          ptr = e;
+          return *this;
+        }
+      };
+
+      /// Line by line access to a memory mapped file
+      /**
+       *  Supports the subset of the istream interface used by the parsers below.
+       *
+       *  \author  M.Frank
+       *  \version 1.0
+       *  \ingroup DD4HEP_SIMULATION
+       */
+      class MappedInput  {
+      public:
+        const char* ptr    = nullptr;
+        const char* end    = nullptr;
+        bool        at_end = false;
+        bool        bad    = false;
+
+        /// Attach the input to a region of the mapped file
+        void assign(const char* b, const char* e)
+        {  ptr = b; end = e; at_end = false; bad = false;  }
+        bool good()  const                  {  return !at_end && !bad;  }
+        bool eof()  const                   {  return at_end;           }
+        bool operator!()  const             {  return bad;              }
+        void clear(ios::iostate state)
+        {  at_end = (state&ios::eofbit) != 0; bad = (state&(ios::badbit|ios::failbit)) != 0; }
+        char peek()  {
+          if ( ptr < end ) return *ptr;
+          at_end = true;
+          return char(EOF);
+        }
+        /// Move to the next line. Returns the end of the current line
+        const char* next_line()  {
+          const char* e = ptr < end ? (const char*)::memchr(ptr, '\n', end-ptr) : nullptr;
+          if ( e ) {
+            ptr = e + 1;
+            return e;
+          }
+          ptr = end;
+          at_end = true;
+          return end;
+        }
+      };
+
       char get_input(istream& is, istringstream& iline);
+      char get_input(MappedInput& is, LineParser& iline);
       int read_until_event_end(istream & is);
-      int read_weight_names(EventStream &, istringstream& iline);
-      int read_particle(EventStream &info, istringstream& iline, Geant4Particle * p);
-      int read_vertex(EventStream &info, istream& is, istringstream & iline);
-      int read_event_header(EventStream &info, istringstream & input, EventHeader& header);
-      int read_cross_section(EventStream &info, istringstream & input);
-      int read_units(EventStream &info, istringstream & input);
-      int read_heavy_ion(EventStream &, istringstream & input);
-      int read_pdf(EventStream &, istringstream & input);
-      Geant4Vertex* vertex(EventStream& info, int i);
-      void fix_particles(EventStream &info);
+      int read_until_event_end(MappedInput & is);
+      template <typename LINE> int read_weight_names(EventData &, LINE& iline);
+      template <typename LINE> int read_particle(EventData &info, LINE& iline, Geant4Particle * p);
+      template <typename STREAM, typename LINE> int read_vertex(EventData &info, STREAM& is, LINE & iline);
+      template <typename LINE> int read_event_header(EventData &info, LINE & input, EventHeader& header);
+      template <typename LINE> int read_cross_section(EventData &info, LINE & input);
+      template <typename LINE> int read_units(EventData &info, LINE & input);
+      template <typename LINE> int read_heavy_ion(EventData &, LINE & input);
+      template <typename LINE> int read_pdf(EventData &, LINE & input);
+      template <typename STREAM, typename LINE> bool read_event(EventData &info, STREAM& instream, LINE& input_line);
+      int read_io_key(EventData &info, const string& key);
+      Geant4Vertex* vertex(EventData& info, int i);
+      void fix_particles(EventData &info);
+      void fill_event(EventData &info, const string& name,
+                      Geant4EventReader::Vertices& vertices,
+                      Geant4EventReader::Particles& output);
     }
   }
 }
@@ -210,6 +428,7 @@ Geant4EventReaderHepMC::Geant4EventReaderHepMC(const string& nam)
            nam.c_str(), ::strerror(errno));
   }
   m_events = new HepMC::EventStream(m_input);
+  m_asyncAccess = true;
 }
 
 /// Default destructor
@@ -239,59 +458,192 @@ Geant4EventReaderHepMC::EventReaderStatus
 Geant4EventReaderHepMC::readParticles(int /* ev_id */,
                                       Vertices&  vertices,
                                       Particles& output) {
-
-  //fg: for now we create exactly one event vertex here ( as before )
-  //    this needs revisiting as HepMC allows to have more than one vertex ...
-  Geant4Vertex* primary_vertex = new Geant4Vertex ;
-  vertices.emplace_back( primary_vertex );
-  primary_vertex->x = 0;
-  primary_vertex->y = 0;
-  primary_vertex->z = 0;
-
   if ( !m_events->ok() )  {
     vertices.clear();
     output.clear();
     return EVENT_READER_EOF;
   }
   else if ( m_events->read() )  {
-    EventStream::Particles& parts = m_events->particles();
-
-    Position pos(primary_vertex->x,primary_vertex->y,primary_vertex->z);
-
-    output.reserve(parts.size());
-    transform(parts.begin(),parts.end(),back_inserter(output),detail::reference2nd(parts));
-    m_events->clear();
-    if (pos.mag2() > numeric_limits<double>::epsilon() )  {
-      for(Particles::iterator k=output.begin(); k != output.end(); ++k) {
-        Geant4ParticleHandle p(*k);
-        p->vsx += pos.x();
-        p->vsy += pos.y();
-        p->vsz += pos.z();
-        p->vex += pos.x();
-        p->vey += pos.y();
-        p->vez += pos.z();
-      }
+    HepMC::fill_event(*m_events, m_name, vertices, output);
+    ++m_currEvent;
+    return EVENT_READER_OK;
+  }
+  vertices.clear();
+  output.clear();
+  return EVENT_READER_EOF;
+}
+
+/// Initializing constructor
+Geant4EventReaderHepMCMapped::Geant4EventReaderHepMCMapped(const string& nam)
+  : Geant4EventReader(nam), m_data(nullptr), m_size(0), m_time(0), m_input(0), m_events(0)
+{
+  struct stat st;
+  int fd = ::open(nam.c_str(), O_RDONLY);
+  if ( fd < 0 )  {
+    except("Geant4EventReaderHepMCMapped","+++ Failed to open input file: %s Error:%s.",
+           nam.c_str(), ::strerror(errno));
+  }
+  if ( ::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) )  {
+    ::close(fd);
+    except("Geant4EventReaderHepMCMapped","+++ %s is no regular file. "
+           "Use Geant4EventReaderHepMC to read from streams.", nam.c_str());
+  }
+  m_size = st.st_size;
+  m_time = st.st_mtime;
+  if ( m_size > 0 )  {
+    void* ptr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if ( ptr == MAP_FAILED )  {
+      ::close(fd);
+      except("Geant4EventReaderHepMCMapped","+++ Failed to map input file: %s Error:%s.",
+             nam.c_str(), ::strerror(errno));
     }
-    for(Particles::const_iterator k=output.begin(); k != output.end(); ++k) {
-      Geant4ParticleHandle p(*k);
-      printout(VERBOSE,m_name,
-               "+++ %s ID:%3d status:%08X typ:%9d Mom:(%+.2e,%+.2e,%+.2e)[MeV] "
-               "time: %+.2e [ns] #Dau:%3d #Par:%1d",
-               "",p->id,p->status,p->pdgID,
-               p->psx/CLHEP::MeV,p->psy/CLHEP::MeV,p->psz/CLHEP::MeV,p->time/CLHEP::ns,
-               p->daughters.size(),
-               p->parents.size());
-      //output.emplace_back(p);
-
-      //add particles to the 'primary vertex'
-      if ( p->parents.size() == 0 )  {
-        PropertyMask status(p->status);
-        if ( status.isSet(G4PARTICLE_GEN_EMPTY) || status.isSet(G4PARTICLE_GEN_DOCUMENTATION) )
-          primary_vertex->in.insert(p->id);  // Beam particles and primary quarks etc.
-        else
-          primary_vertex->out.insert(p->id); // Stuff, to be given to Geant4 together with daughters
-      }
+    ::madvise(ptr, m_size, MADV_SEQUENTIAL);
+    m_data = (const char*)ptr;
+  }
+  ::close(fd);
+  m_indexFile    = nam + ".idx";
+  m_directAccess = true;
+  m_asyncAccess  = true;
+  m_events = new HepMC::EventData();
+  m_input  = new HepMC::MappedInput();
+  m_input->assign(m_data, m_data+m_size);
+  // The listing type is declared once in the file header: needed for direct access.
+  // Read all lines before the first event: files may start with blank lines.
+  while( m_input->peek() != 'E' && m_input->good() )  {
+    HepMC::LineParser line;
+    string key;
+    HepMC::get_input(*m_input, line);
+    if ( line >> key ) HepMC::read_io_key(*m_events, key.substr(0,key.find('\r')));
+  }
+  m_input->assign(m_data, m_data+m_size);
+}
+
+/// Default destructor
+Geant4EventReaderHepMCMapped::~Geant4EventReaderHepMCMapped()    {
+  detail::deletePtr(m_events);
+  detail::deletePtr(m_input);
+  if ( m_data )  {
+    ::munmap((void*)m_data, m_size);
+    m_data = nullptr;
+  }
+}
+
+/// Set the parameters of the reader
+Geant4EventReader::EventReaderStatus
+Geant4EventReaderHepMCMapped::setParameters(std::map< std::string, std::string >& parameters)  {
+  _getParameterValue(parameters, "IndexFile", m_indexFile, m_name + ".idx");
+  return EVENT_READER_OK;
+}
+
+namespace  {
+  /// Header of the event index file of the Geant4EventReaderHepMCMapped
+  struct HepMCIndexHeader  {
+    char     magic[8];
+    uint64_t file_size;
+    int64_t  file_time;
+    uint64_t num_events;
+  };
+  const char s_hepmcIndexMagic[8] = { 'D','D','4','H','E','P','M','C' };
+}
+
+/// Load the event offsets from the index file
+bool Geant4EventReaderHepMCMapped::loadIndex()   {
+  HepMCIndexHeader hdr;
+  FILE* f = std::fopen(m_indexFile.c_str(), "rb");
+  if ( !f )  {
+    return false;
+  }
+  bool ok = std::fread(&hdr, sizeof(hdr), 1, f) == 1
+    && std::memcmp(hdr.magic, s_hepmcIndexMagic, sizeof(hdr.magic)) == 0
+    && hdr.file_size == m_size && hdr.file_time == m_time;
+  if ( ok )  {
+    m_offsets.resize(hdr.num_events);
+    ok = std::fread(m_offsets.data(), sizeof(uint64_t), hdr.num_events, f) == hdr.num_events;
+  }
+  std::fclose(f);
+  if ( !ok )  {
+    m_offsets.clear();
+    printout(INFO,"EventReaderHepMCMapped","+++ Ignore outdated event index %s", m_indexFile.c_str());
+    return false;
+  }
+  printout(INFO,"EventReaderHepMCMapped","+++ Loaded index of %ld events from %s",
+           m_offsets.size(), m_indexFile.c_str());
+  return true;
+}
+
+/// Save the event offsets to the index file
+void Geant4EventReaderHepMCMapped::saveIndex()  const   {
+  // Several readers may index the same file: write a temporary and rename it
+  string tmp = m_indexFile + ".XXXXXX";
+  int fd = ::mkstemp(&tmp[0]);
+  FILE* f = fd >= 0 ? ::fdopen(fd, "wb") : nullptr;
+  if ( !f )  {
+    if ( fd >= 0 ) ::close(fd);
+    printout(INFO,"EventReaderHepMCMapped","+++ Cannot write event index %s: %s",
+             m_indexFile.c_str(), ::strerror(errno));
+    return;
+  }
+  HepMCIndexHeader hdr;
+  std::memcpy(hdr.magic, s_hepmcIndexMagic, sizeof(hdr.magic));
+  hdr.file_size  = m_size;
+  hdr.file_time  = m_time;
+  hdr.num_events = m_offsets.size();
+  bool ok = std::fwrite(&hdr, sizeof(hdr), 1, f) == 1
+    && std::fwrite(m_offsets.data(), sizeof(uint64_t), m_offsets.size(), f) == m_offsets.size();
+  ok = (std::fclose(f) == 0) && ok;
+  if ( !ok || ::rename(tmp.c_str(), m_indexFile.c_str()) != 0 )  {
+    printout(INFO,"EventReaderHepMCMapped","+++ Cannot write event index %s: %s",
+             m_indexFile.c_str(), ::strerror(errno));
+    ::unlink(tmp.c_str());
+  }
+}
+
+/// Build the event offset index
+void Geant4EventReaderHepMCMapped::buildIndex()   {
+  if ( !m_indexFile.empty() && loadIndex() )  {
+    return;
+  }
+  // Event records start with a line beginning with 'E'
+  m_offsets.clear();
+  for( const char *p = m_data, *e = m_data+m_size; p && p < e; )  {
+    if ( *p == 'E' ) m_offsets.emplace_back(p - m_data);
+    p = (const char*)::memchr(p, '\n', e-p);
+    p = p ? p+1 : nullptr;
+  }
+  printout(INFO,"EventReaderHepMCMapped","+++ Indexed %ld events of %s",
+           m_offsets.size(), m_name.c_str());
+  if ( !m_indexFile.empty() )  {
+    saveIndex();
+  }
+}
+
+/// Move to the indicated event number using the event index
+Geant4EventReader::EventReaderStatus
+Geant4EventReaderHepMCMapped::moveToEvent(int event_number) {
+  if ( event_number != m_currEvent )  {
+    if ( m_offsets.empty() )  {
+      buildIndex();
+    }
+    if ( event_number < 0 || size_t(event_number) >= m_offsets.size() )  {
+      return EVENT_READER_EOF;
     }
+    printout(INFO,"EventReaderHepMCMapped::moveToEvent","Current event:%d Move to event %d",
+             m_currEvent, event_number);
+    m_input->assign(m_data + m_offsets[event_number], m_data + m_size);
+    m_currEvent = event_number;
+  }
+  printout(DEBUG,"EventReaderHepMCMapped::moveToEvent","Current event number: %d",m_currEvent);
+  return EVENT_READER_OK;
+}
+
+/// Read an event and fill a vector of MCParticles.
+Geant4EventReader::EventReaderStatus
+Geant4EventReaderHepMCMapped::readParticles(int /* ev_id */,
+                                            Vertices&  vertices,
+                                            Particles& output) {
+  HepMC::LineParser line;
+  if ( m_input->good() && HepMC::read_event(*m_events, *m_input, line) )  {
+    HepMC::fill_event(*m_events, m_name, vertices, output);
     ++m_currEvent;
     return EVENT_READER_OK;
   }
@@ -300,10 +652,63 @@ Geant4EventReaderHepMC::readParticles(int /* ev_id */,
   return EVENT_READER_EOF;
 }
 
-void HepMC::fix_particles(EventStream& info)  {
-  EventStream::Particles& parts = info.particles();
-  EventStream::Vertices&  verts = info.vertices();
-  EventStream::Particles::iterator i;
+/// Fill the output of the reader from the event data
+void HepMC::fill_event(EventData& info, const string& name,
+                       Geant4EventReader::Vertices& vertices,
+                       Geant4EventReader::Particles& output)  {
+  typedef Geant4EventReader::Particles Particles;
+  EventData::Particles& parts = info.particles();
+
+  //fg: for now we create exactly one event vertex here ( as before )
+  //    this needs revisiting as HepMC allows to have more than one vertex ...
+  Geant4Vertex* primary_vertex = new Geant4Vertex ;
+  vertices.emplace_back( primary_vertex );
+  primary_vertex->x = 0;
+  primary_vertex->y = 0;
+  primary_vertex->z = 0;
+
+  Position pos(primary_vertex->x,primary_vertex->y,primary_vertex->z);
+
+  output.reserve(parts.size());
+  transform(parts.begin(),parts.end(),back_inserter(output),detail::reference2nd(parts));
+  info.clear();
+  if (pos.mag2() > numeric_limits<double>::epsilon() )  {
+    for(Particles::iterator k=output.begin(); k != output.end(); ++k) {
+      Geant4ParticleHandle p(*k);
+      p->vsx += pos.x();
+      p->vsy += pos.y();
+      p->vsz += pos.z();
+      p->vex += pos.x();
+      p->vey += pos.y();
+      p->vez += pos.z();
+    }
+  }
+  for(Particles::const_iterator k=output.begin(); k != output.end(); ++k) {
+    Geant4ParticleHandle p(*k);
+    printout(VERBOSE,name,
+             "+++ %s ID:%3d status:%08X typ:%9d Mom:(%+.2e,%+.2e,%+.2e)[MeV] "
+             "time: %+.2e [ns] #Dau:%3d #Par:%1d",
+             "",p->id,p->status,p->pdgID,
+             p->psx/CLHEP::MeV,p->psy/CLHEP::MeV,p->psz/CLHEP::MeV,p->time/CLHEP::ns,
+             p->daughters.size(),
+             p->parents.size());
+    //output.emplace_back(p);
+
+    //add particles to the 'primary vertex'
+    if ( p->parents.size() == 0 )  {
+      PropertyMask status(p->status);
+      if ( status.isSet(G4PARTICLE_GEN_EMPTY) || status.isSet(G4PARTICLE_GEN_DOCUMENTATION) )
+        primary_vertex->in.insert(p->id);  // Beam particles and primary quarks etc.
+      else
+        primary_vertex->out.insert(p->id); // Stuff, to be given to Geant4 together with daughters
+    }
+  }
+}
+
+void HepMC::fix_particles(EventData& info)  {
+  EventData::Particles& parts = info.particles();
+  EventData::Vertices&  verts = info.vertices();
+  EventData::Particles::iterator i;
   std::set<int>::const_iterator id, ip;
   for(i=parts.begin(); i != parts.end(); ++i)  {
     Geant4ParticleHandle p((*i).second);
@@ -321,7 +726,7 @@ void HepMC::fix_particles(EventStream& info)  {
       p->vez = v->z;
       v->in.insert(p->id);
       for(id=v->out.begin(); id!=v->out.end();++id)    {
-        EventStream::Particles::iterator ipp = parts.find(*id);
+        EventData::Particles::iterator ipp = parts.find(*id);
         Geant4Particle* dau = ipp != parts.end() ? (*ipp).second : 0;
         if ( !dau )
           cout << "ERROR: Invalid daughter particle: " << *id << endl;
@@ -334,7 +739,7 @@ void HepMC::fix_particles(EventStream& info)  {
   for(const auto& iv : verts)   {
     Geant4Vertex* v = iv.second;
     for (int pout : v->out)   {
-      EventStream::Particles::iterator ipp = parts.find(pout);
+      EventData::Particles::iterator ipp = parts.find(pout);
       Geant4Particle* p = (*ipp).second;
       for (int d : v->in)   {
         p->parents.insert(d);
@@ -360,8 +765,8 @@ void HepMC::fix_particles(EventStream& info)  {
   }
 }
 
-Geant4Vertex* HepMC::vertex(EventStream& info, int i)   {
-  EventStream::Vertices::iterator it=info.vertices().find(i);
+Geant4Vertex* HepMC::vertex(EventData& info, int i)   {
+  EventData::Vertices::iterator it=info.vertices().find(i);
   return (it==info.vertices().end()) ? 0 : (*it).second;
 }
 
@@ -385,6 +790,30 @@ char HepMC::get_input(istream& is, istringstream& iline)  {
   return iline ? value : -1;
 }
 
+char HepMC::get_input(MappedInput& is, LineParser& iline)  {
+  char value = is.peek();
+  if ( is.ptr >= is.end ) {    // nothing left to read
+    is.clear(ios::badbit);
+    return -1;
+  }
+  const char* start = is.ptr;
+  iline.assign(start, is.next_line());
+  if ( iline.end-start > 1 && start[1] == ' ' ) iline.ptr = start + 1;
+  return iline ? value : -1;
+}
+
+int HepMC::read_until_event_end(MappedInput & is) {
+  while ( is.good() ) {
+    char val = is.peek();
+    if( val == 'E' ) {  // next event
+      return 1;
+    }
+    is.next_line();
+    if ( !is.good() ) return 0;
+  }
+  return 0;
+}
+
 int HepMC::read_until_event_end(istream & is) {
   string line;
   while ( is ) {
@@ -398,9 +827,9 @@ int HepMC::read_until_event_end(istream & is) {
   return 0;
 }
 
-int HepMC::read_weight_names(EventStream&, istringstream&)   {
+template <typename LINE> int HepMC::read_weight_names(EventData&, LINE&)   {
 #if 0
-  int HepMC::read_weight_names(EventStream& info, istringstream& iline)
+  int HepMC::read_weight_names(EventData& info, istringstream& iline)
     size_t name_size = 0;
   iline >> name_size;
   info.weights.names.clear();
@@ -431,7 +860,7 @@ int HepMC::read_weight_names(EventStream&, istringstream&)   {
   return 1;
 }
 
-int HepMC::read_particle(EventStream &info, istringstream& input, Geant4Particle * p)   {
+template <typename LINE> int HepMC::read_particle(EventData &info, LINE& input, Geant4Particle * p)   {
   float ene = 0., theta = 0., phi = 0;
   int   size = 0, stat=0;
   PropertyMask status(p->status);
@@ -489,7 +918,8 @@ int HepMC::read_particle(EventStream &info, istringstream& input, Geant4Particle
   return 1;
 }
 
-int HepMC::read_vertex(EventStream &info, istream& is, istringstream & input)    {
+template <typename STREAM, typename LINE>
+int HepMC::read_vertex(EventData &info, STREAM& is, LINE & input)    {
   int id=0, dummy = 0, num_orphans_in=0, num_particles_out=0, weights_size=0;
   vector<float> weights;
   Geant4Vertex* v = new Geant4Vertex();
@@ -567,7 +997,7 @@ int HepMC::read_vertex(EventStream &info, istream& is, istringstream & input)
   return 1;
 }
 
-int HepMC::read_event_header(EventStream &info, istringstream & input, EventHeader& header)   {
+template <typename LINE> int HepMC::read_event_header(EventData &info, LINE & input, EventHeader& header)   {
   // read values into temp variables, then fill GenEvent
   int random_states_size = 0;
   input >> header.id;
@@ -609,12 +1039,12 @@ int HepMC::read_event_header(EventStream &info, istringstream & input, EventHead
   return 1;
 }
 
-int HepMC::read_cross_section(EventStream &info, istringstream & input)   {
+template <typename LINE> int HepMC::read_cross_section(EventData &info, LINE & input)   {
   input >> info.xsection >> info.xsection_err;
   return input.fail() ? 0 : 1;
 }
 
-int HepMC::read_units(EventStream &info, istringstream & input)   {
+template <typename LINE> int HepMC::read_units(EventData &info, LINE & input)   {
   if( info.io_type == gen )  {
     string mom, pos;
     input >> mom >> pos;
@@ -632,7 +1062,7 @@ int HepMC::read_units(EventStream &info, istringstream & input)   {
   return input.fail() ? 0 : 1;
 }
 
-int HepMC::read_heavy_ion(EventStream &, istringstream & input)  {
+template <typename LINE> int HepMC::read_heavy_ion(EventData &, LINE & input)  {
   // read values into temp variables, then create a new HeavyIon object
   int nh =0, np =0, nt =0, nc =0,
     neut = 0, prot = 0, nw =0, nwn =0, nwnw =0;
@@ -658,7 +1088,7 @@ int HepMC::read_heavy_ion(EventStream &, istringstream & input)  {
   return input.fail() ? 0 : 1;
 }
 
-int HepMC::read_pdf(EventStream &, istringstream & input)  {
+template <typename LINE> int HepMC::read_pdf(EventData &, LINE & input)  {
   // read values into temp variables, then create a new PdfInfo object
   int id1 =0, id2 =0;
   double  x1 = 0., x2 = 0., scale = 0., pdf1 = 0., pdf2 = 0.;
@@ -704,25 +1134,51 @@ bool HepMC::EventStream::ok()  const   {
   return true;
 }
 
-void HepMC::EventStream::clear()   {
+void HepMC::EventData::clear()   {
   detail::releaseObjects(m_vertices);
   detail::releaseObjects(m_particles);
 }
 
+/// Interprete the listing keys. Returns the io type of end keys, 0 otherwise
+int HepMC::read_io_key(EventData& info, const string& key_value)   {
+  if( key_value == "HepMC::IO_GenEvent-START_EVENT_LISTING" )
+    info.set_io(gen,key_value);
+  else if( key_value == "HepMC::IO_Ascii-START_EVENT_LISTING" )
+    info.set_io(ascii,key_value);
+  else if( key_value == "HepMC::IO_ExtendedAscii-START_EVENT_LISTING" )
+    info.set_io(extascii,key_value);
+  else if( key_value == "HepMC::IO_Ascii-START_PARTICLE_DATA" )
+    info.set_io(ascii_pdt,key_value);
+  else if( key_value == "HepMC::IO_ExtendedAscii-START_PARTICLE_DATA" )
+    info.set_io(extascii_pdt,key_value);
+  else if( key_value == "HepMC::IO_GenEvent-END_EVENT_LISTING" )
+    return gen;
+  else if( key_value == "HepMC::IO_Ascii-END_EVENT_LISTING" )
+    return ascii;
+  else if( key_value == "HepMC::IO_ExtendedAscii-END_EVENT_LISTING" )
+    return extascii;
+  else if( key_value == "HepMC::IO_Ascii-END_PARTICLE_DATA" )
+    return ascii_pdt;
+  else if( key_value == "HepMC::IO_ExtendedAscii-END_PARTICLE_DATA" )
+    return extascii_pdt;
+  return 0;
+}
+
 bool HepMC::EventStream::read()   {
-  EventStream& info = *this;
+  istringstream input_line;
+  return read_event(*this, instream, input_line);
+}
+
+/// Read the next event from a stream (istream or mapped file)
+template <typename STREAM, typename LINE>
+bool HepMC::read_event(EventData& info, STREAM& instream, LINE& input_line)   {
   bool event_read = false;
-  static int num_evt = 0;
-  int num_line = 0, num_line_accepted = 0;
 
-  detail::releaseObjects(vertices());
-  detail::releaseObjects(particles());
+  detail::releaseObjects(info.vertices());
+  detail::releaseObjects(info.particles());
 
-  ++num_evt;
   while( instream.good() ) {
     char value = instream.peek();
-    istringstream input_line;
-    ++num_line;
     if      ( value == 'E' && event_read )
       break;
     else if ( instream.eof() && event_read )
@@ -739,7 +1195,6 @@ bool HepMC::EventStream::read()   {
     if( !input_line || value < 0 )
       goto Skip;
 
-    ++num_line_accepted;
     switch( value )   {
     case 'H':  {
       int iotype = 0;
@@ -747,32 +1202,12 @@ bool HepMC::EventStream::read()   {
       input_line >> key_value;
       // search for event listing key before first event only.
       key_value = key_value.substr(0,key_value.find('\r'));
-      if ( key_value == "H" && (this->io_type == gen || this->io_type == extascii) ) {
+      if ( key_value == "H" && (info.io_type == gen || info.io_type == extascii) ) {
         read_heavy_ion(info, input_line);
         break;
       }
-      else if( key_value == "HepMC::IO_GenEvent-START_EVENT_LISTING" )
-        this->set_io(gen,key_value);
-      else if( key_value == "HepMC::IO_Ascii-START_EVENT_LISTING" )
-        this->set_io(ascii,key_value);
-      else if( key_value == "HepMC::IO_ExtendedAscii-START_EVENT_LISTING" )
-        this->set_io(extascii,key_value);
-      else if( key_value == "HepMC::IO_Ascii-START_PARTICLE_DATA" )
-        this->set_io(ascii_pdt,key_value);
-      else if( key_value == "HepMC::IO_ExtendedAscii-START_PARTICLE_DATA" )
-        this->set_io(extascii_pdt,key_value);
-      else if( key_value == "HepMC::IO_GenEvent-END_EVENT_LISTING" )
-        iotype = gen;
-      else if( key_value == "HepMC::IO_Ascii-END_EVENT_LISTING" )
-        iotype = ascii;
-      else if( key_value == "HepMC::IO_ExtendedAscii-END_EVENT_LISTING" )
-        iotype = extascii;
-      else if( key_value == "HepMC::IO_Ascii-END_PARTICLE_DATA" )
-        iotype = ascii_pdt;
-      else if( key_value == "HepMC::IO_ExtendedAscii-END_PARTICLE_DATA" )
-        iotype = extascii_pdt;
-
-      if( iotype != 0 && this->io_type != iotype )  {
+      iotype = read_io_key(info, key_value);
+      if( iotype != 0 && info.io_type != iotype )  {
         cerr << "GenEvent::find_end_key: iotype keys have changed. "
              << "MALFORMED INPUT" << endl;
         instream.clear(ios::badbit);
@@ -784,7 +1219,7 @@ bool HepMC::EventStream::read()   {
       continue;
     }
     case 'E':           // deal with the event line
-      if ( !read_event_header(info, input_line, this->header) )
+      if ( !read_event_header(info, input_line, info.header) )
         goto Skip;
       event_read = true;
       continue;
@@ -823,9 +1258,9 @@ bool HepMC::EventStream::read()   {
     }
     continue;
   Skip:
-    printout(WARNING,"HepMC::EventStream","+++ Skip event with ID: %d",this->header.id);
-    detail::releaseObjects(vertices());
-    detail::releaseObjects(particles());
+    printout(WARNING,"HepMC::EventStream","+++ Skip event with ID: %d",info.header.id);
+    detail::releaseObjects(info.vertices());
+    detail::releaseObjects(info.particles());
     read_until_event_end(instream);
     event_read = false;
     if ( instream.eof() ) return false;
@@ -834,7 +1269,7 @@ bool HepMC::EventStream::read()   {
   if( not instream.good() ) return false;
  Done:
   fix_particles(info);
-  detail::releaseObjects(vertices());
+  detail::releaseObjects(info.vertices());
   return true;
 }
 
@@ -113,6 +113,10 @@ DECLARE_GEANT4ACTION(Geant4InteractionVertexBoost)
 #include "DDG4/Geant4InteractionMerger.h"
 DECLARE_GEANT4ACTION(Geant4InteractionMerger)
 
+//=============================
+#include "DDG4/Geant4InteractionPileup.h"
+DECLARE_GEANT4ACTION(Geant4InteractionPileup)
+
 //=============================
 #include "DDG4/Geant4PrimaryHandler.h"
 DECLARE_GEANT4ACTION(Geant4PrimaryHandler)
@@ -0,0 +1,601 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "Geant4GeometryCache.h"
+#include <DD4hep/Shapes.h>
+#include <DD4hep/Detector.h>
+#include <DD4hep/IDDescriptor.h>
+#include <DDG4/Geant4Converter.h>
+#include <DDG4/Geant4GeometryInfo.h>
+
+// ROOT include files
+#include <TGeoManager.h>
+#include <TGeoMaterial.h>
+#include <TGeoMatrix.h>
+#include <TGeoMedium.h>
+#include <TGeoNode.h>
+#include <TGeoVolume.h>
+
+// Geant4 include files
+#include <G4GDMLParser.hh>
+#include <G4LogicalVolume.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4ReflectionFactory.hh>
+#include <G4GeometryManager.hh>
+#include <G4PhysicalVolumeStore.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4SolidStore.hh>
+#include <G4Region.hh>
+#include <G4Version.hh>
+
+// C/C++ include files
+#include <map>
+#include <set>
+#include <chrono>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <unistd.h>
+#include <sys/stat.h>
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::sim;
+
+namespace {
+
+  /// Version of the cache file format. Increment on every change
+  constexpr uint32_t CACHE_VERSION = 2;
+  /// Magic word of the index file
+  constexpr char     CACHE_MAGIC[8] = { 'D','D','G','4','G','E','O','C' };
+
+  /// 64 bit FNV-1a hash
+  class Hash  {
+  public:
+    uint64_t value = 14695981039346656037ULL;
+    void add(const void* ptr, size_t len)   {
+      const unsigned char* p = (const unsigned char*)ptr;
+      for( size_t i = 0; i < len; ++i )  {
+        value ^= p[i];
+        value *= 1099511628211ULL;
+      }
+    }
+    void add(const char* s)      {  add(s ? s : "", s ? ::strlen(s)+1 : 1); }
+    void add(const string& s)    {  add(s.c_str(), s.length()+1);            }
+    void add(double d)           {  add(&d, sizeof(d));                      }
+    void add(int64_t i)          {  add(&i, sizeof(i));                      }
+  };
+
+  /// Depth-first enumeration of the unique TGeo volumes and all TGeo nodes
+  class TGeoIndex  {
+  public:
+    vector<const TGeoVolume*>     volumes;
+    vector<const TGeoNode*>       nodes;
+    map<const TGeoVolume*, int>   volumeIndex;
+    map<const TGeoNode*, int>     nodeIndex;
+
+    void scanVolume(const TGeoVolume* vol)  {
+      if ( volumeIndex.emplace(vol, int(volumes.size())).second )  {
+        volumes.emplace_back(vol);
+        for( Int_t i = 0, n = vol->GetNdaughters(); i < n; ++i )  {
+          const TGeoNode* node = vol->GetNode(i);
+          nodeIndex.emplace(node, int(nodes.size()));
+          nodes.emplace_back(node);
+          scanVolume(node->GetVolume());
+        }
+      }
+    }
+    explicit TGeoIndex(const TGeoNode* top)  {
+      nodeIndex.emplace(top, 0);
+      nodes.emplace_back(top);
+      scanVolume(top->GetVolume());
+    }
+  };
+
+  /// Depth-first enumeration of the unique Geant4 logical volumes and all placements
+  class G4Index  {
+  public:
+    vector<const G4LogicalVolume*>         volumes;
+    vector<const G4VPhysicalVolume*>       placements;
+    map<const G4LogicalVolume*, int>       volumeIndex;
+    map<const G4VPhysicalVolume*, int>     placementIndex;
+
+    void scanVolume(const G4LogicalVolume* vol)  {
+      if ( volumeIndex.emplace(vol, int(volumes.size())).second )  {
+        volumes.emplace_back(vol);
+        for( size_t i = 0, n = vol->GetNoDaughters(); i < n; ++i )  {
+          const G4VPhysicalVolume* pv = vol->GetDaughter(i);
+          placementIndex.emplace(pv, int(placements.size()));
+          placements.emplace_back(pv);
+          scanVolume(pv->GetLogicalVolume());
+        }
+      }
+    }
+    explicit G4Index(const G4VPhysicalVolume* world)  {
+      placementIndex.emplace(world, 0);
+      placements.emplace_back(world);
+      scanVolume(world->GetLogicalVolume());
+    }
+  };
+
+  /// Content of the binary index file
+  class CacheIndex  {
+  public:
+    typedef pair<int32_t,int32_t> Relation;
+    uint64_t                 key = 0;
+    uint32_t                 numTGeoVolumes = 0;
+    uint32_t                 numTGeoNodes   = 0;
+    /// Names of the Geant4 logical volumes in enumeration order
+    vector<string>           volumeNames;
+    /// Names and copy numbers of the Geant4 placements in enumeration order
+    vector<pair<string,int32_t> > placementNames;
+    /// Relation Geant4 logical volume index -> TGeo volume index
+    vector<Relation>         volumes;
+    /// Relation Geant4 placement index -> TGeo node index
+    vector<Relation>         placements;
+    /// Placement paths of the volume manager as Geant4 placement indices
+    vector<pair<uint64_t, vector<int32_t> > > paths;
+    /// Assembly imprints: TGeo volume index, Geant4 placement index and TGeo node chain
+    vector<pair<Relation, vector<int32_t> > > imprints;
+
+    template <typename T> static void put(ostream& os, const T& val)  {
+      os.write((const char*)&val, sizeof(T));
+    }
+    static void put(ostream& os, const string& val)  {
+      put(os, uint32_t(val.length()));
+      os.write(val.c_str(), val.length());
+    }
+    template <typename T> static void get(istream& is, T& val)  {
+      is.read((char*)&val, sizeof(T));
+    }
+    static void get(istream& is, string& val)  {
+      uint32_t len = 0;
+      get(is, len);
+      val.resize(len);
+      if ( len > 0 ) is.read(&val[0], len);
+    }
+    bool write(const string& fname)  const  {
+      ofstream os(fname, ios::binary|ios::trunc);
+      os.write(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+      put(os, CACHE_VERSION);
+      put(os, key);
+      put(os, numTGeoVolumes);
+      put(os, numTGeoNodes);
+      put(os, uint32_t(volumeNames.size()));
+      for( const auto& n : volumeNames ) put(os, n);
+      put(os, uint32_t(placementNames.size()));
+      for( const auto& n : placementNames )  { put(os, n.first); put(os, n.second); }
+      put(os, uint32_t(volumes.size()));
+      for( const auto& r : volumes )  { put(os, r.first); put(os, r.second); }
+      put(os, uint32_t(placements.size()));
+      for( const auto& r : placements )  { put(os, r.first); put(os, r.second); }
+      put(os, uint32_t(paths.size()));
+      for( const auto& p : paths )  {
+        put(os, p.first);
+        put(os, uint32_t(p.second.size()));
+        os.write((const char*)p.second.data(), p.second.size()*sizeof(int32_t));
+      }
+      put(os, uint32_t(imprints.size()));
+      for( const auto& p : imprints )  {
+        put(os, p.first.first);
+        put(os, p.first.second);
+        put(os, uint32_t(p.second.size()));
+        os.write((const char*)p.second.data(), p.second.size()*sizeof(int32_t));
+      }
+      return os.good();
+    }
+    bool read(const string& fname)  {
+      char     magic[sizeof(CACHE_MAGIC)];
+      uint32_t version = 0, num = 0;
+      ifstream is(fname, ios::binary);
+      is.read(magic, sizeof(magic));
+      get(is, version);
+      if ( !is.good() || ::memcmp(magic, CACHE_MAGIC, sizeof(magic)) != 0 || version != CACHE_VERSION )
+        return false;
+      get(is, key);
+      get(is, numTGeoVolumes);
+      get(is, numTGeoNodes);
+      get(is, num);
+      volumeNames.resize(num);
+      for( auto& n : volumeNames ) get(is, n);
+      get(is, num);
+      placementNames.resize(num);
+      for( auto& n : placementNames )  { get(is, n.first); get(is, n.second); }
+      get(is, num);
+      volumes.resize(num);
+      for( auto& r : volumes )  { get(is, r.first); get(is, r.second); }
+      get(is, num);
+      placements.resize(num);
+      for( auto& r : placements )  { get(is, r.first); get(is, r.second); }
+      get(is, num);
+      paths.resize(num);
+      for( auto& p : paths )  {
+        get(is, p.first);
+        get(is, num);
+        p.second.resize(num);
+        is.read((char*)p.second.data(), num*sizeof(int32_t));
+      }
+      get(is, num);
+      imprints.resize(num);
+      for( auto& p : imprints )  {
+        get(is, p.first.first);
+        get(is, p.first.second);
+        get(is, num);
+        p.second.resize(num);
+        is.read((char*)p.second.data(), num*sizeof(int32_t));
+      }
+      return is.good();
+    }
+  };
+
+  /// Names as seen after reading GDML: the reader strips the pointer references
+  string stripped(const string& name)   {
+    size_t idx = name.find("0x");
+    return idx == string::npos ? name : name.substr(0, idx);
+  }
+
+  /// Optical surfaces and property tables are not restored by the cache
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,17,0)
+  bool hasOpticalProperties(const Detector& description)   {
+    TGeoManager& mgr = description.manager();
+    return (mgr.GetListOfGDMLMatrices()   && mgr.GetListOfGDMLMatrices()->GetEntries()   > 0) ||
+      (mgr.GetListOfOpticalSurfaces()     && mgr.GetListOfOpticalSurfaces()->GetEntries() > 0) ||
+      (mgr.GetListOfSkinSurfaces()        && mgr.GetListOfSkinSurfaces()->GetEntries()    > 0) ||
+      (mgr.GetListOfBorderSurfaces()      && mgr.GetListOfBorderSurfaces()->GetEntries()  > 0);
+  }
+#else
+  bool hasOpticalProperties(const Detector& /* description */)   {
+    return false;
+  }
+#endif
+
+  /// Drop a geometry read from GDML, which does not match the cache index
+  void cleanGeometry()   {
+    G4GeometryManager::GetInstance()->OpenGeometry();
+    G4PhysicalVolumeStore::Clean();
+    G4LogicalVolumeStore::Clean();
+    G4SolidStore::Clean();
+  }
+
+  /// Rebuild the Geant4 assembly volumes. Child assemblies must be converted before their parents
+  void restoreAssemblies(Geant4Converter& cnv, const TGeoVolume* vol, set<const TGeoVolume*>& done)   {
+    if ( done.insert(vol).second )   {
+      for( Int_t i = 0, n = vol->GetNdaughters(); i < n; ++i )  {
+        const TGeoNode* node = vol->GetNode(i);
+        restoreAssemblies(cnv, node->GetVolume(), done);
+        if ( node->GetVolume()->IsA() == TGeoVolumeAssembly::Class() )
+          cnv.handleAssembly(node->GetName(), node);
+      }
+    }
+  }
+
+  double seconds_since(const chrono::steady_clock::time_point& start)   {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  }
+}
+
+/// Initializing constructor. Computes the geometry hash
+Geant4GeometryCache::Geant4GeometryCache(const Detector& desc, const string& dir, PrintLevel level)
+  : description(desc), directory(dir), printLevel(level)
+{
+  char text[32];
+  ::snprintf(text, sizeof(text), "%016llx", hash(desc.world()));
+  key = text;
+}
+
+/// Compute the hash of the geometry below the top detector element
+unsigned long long int Geant4GeometryCache::hash(DetElement top)   {
+  TGeoIndex idx(top.placement().ptr());
+  set<const TGeoMaterial*> materials;
+  Hash h;
+  h.add(int64_t(CACHE_VERSION));
+  h.add(int64_t(G4VERSION_NUMBER));
+  for( const TGeoVolume* vol : idx.volumes )  {
+    Volume      v(vol);
+    TGeoShape*  shape = vol->GetShape();
+    TGeoMedium* med   = vol->GetMedium();
+    h.add(vol->GetName());
+    h.add(int64_t(v.testFlagBit(Volume::VETO_SIMU)));
+    h.add(shape->IsA()->GetName());
+    try  {
+      for( double d : get_shape_dimensions(shape) ) h.add(d);
+    }
+    catch( const exception& )   {
+      h.add(shape->GetName());
+    }
+    if ( med )  {
+      h.add(med->GetName());
+      materials.insert(med->GetMaterial());
+    }
+    // The volume paths of the volume manager depend on the readout of the sensitive volumes
+    SensitiveDetector sd = v.sensitiveDetector();
+    if ( sd.isValid() )  {
+      Readout ro = sd.readout();
+      h.add(sd.name());
+      if ( ro.isValid() )  {
+        h.add(ro.name());
+        h.add(ro.idSpec().fieldDescription());
+      }
+    }
+    for( Int_t i = 0, n = vol->GetNdaughters(); i < n; ++i )  {
+      const TGeoNode*   node = vol->GetNode(i);
+      const TGeoMatrix* mat  = node->GetMatrix();
+      const Double_t*   tr   = mat->GetTranslation();
+      const Double_t*   rot  = mat->GetRotationMatrix();
+      h.add(node->GetName());
+      h.add(int64_t(node->GetNumber()));
+      h.add(int64_t(idx.volumeIndex[node->GetVolume()]));
+      for( int j = 0; j < 3; ++j ) h.add(tr[j]);
+      for( int j = 0; j < 9; ++j ) h.add(rot[j]);
+      PlacedVolume pv(node);
+      if ( pv.data() )  {
+        for( const auto& id : pv.volIDs() )  {
+          h.add(id.first);
+          h.add(int64_t(id.second));
+        }
+      }
+    }
+  }
+  for( const TGeoMaterial* mat : materials )  {
+    h.add(mat->GetName());
+    h.add(mat->GetDensity());
+    h.add(mat->GetTemperature());
+    h.add(mat->GetPressure());
+    for( Int_t i = 0, n = mat->GetNelements(); i < n; ++i )  {
+      Double_t a = 0e0, z = 0e0, w = 0e0;
+      const_cast<TGeoMaterial*>(mat)->GetElementProp(a, z, w, i);
+      h.add(a);
+      h.add(z);
+      h.add(w);
+    }
+  }
+  return h.value;
+}
+
+/// Name of the GDML file of the cache
+string Geant4GeometryCache::gdmlFile()  const   {
+  return directory + "/" + key + ".gdml";
+}
+
+/// Name of the index file of the cache
+string Geant4GeometryCache::indexFile()  const   {
+  return directory + "/" + key + ".g4cache";
+}
+
+/// Check if the cache files exist
+bool Geant4GeometryCache::exists()  const   {
+  struct stat buff;
+  return ::stat(gdmlFile().c_str(), &buff) == 0 && ::stat(indexFile().c_str(), &buff) == 0;
+}
+
+/// Restore the geometry. Returns the detached geometry information or NULL on failure
+Geant4GeometryInfo* Geant4GeometryCache::restore(Geant4Converter& cnv, DetElement top)  const  {
+  auto       start = chrono::steady_clock::now();
+  CacheIndex index;
+  if ( !exists() )   {
+    printout(INFO, "Geant4GeometryCache", "+++ No geometry cache %s present.", indexFile().c_str());
+    return nullptr;
+  }
+  else if ( hasOpticalProperties(description) )   {
+    printout(WARNING, "Geant4GeometryCache", "+++ Geometries with optical surfaces are not cached.");
+    return nullptr;
+  }
+  else if ( !index.read(indexFile()) || ::strtoull(key.c_str(), nullptr, 16) != index.key )   {
+    printout(WARNING, "Geant4GeometryCache", "+++ Invalid geometry cache index %s. [Ignored]",
+             indexFile().c_str());
+    return nullptr;
+  }
+  TGeoIndex tgeo(top.placement().ptr());
+  if ( tgeo.volumes.size() != index.numTGeoVolumes || tgeo.nodes.size() != index.numTGeoNodes )   {
+    printout(WARNING, "Geant4GeometryCache", "+++ Geometry cache %s does not match the geometry. [Ignored]",
+             indexFile().c_str());
+    return nullptr;
+  }
+
+  G4GDMLParser parser;
+  parser.Read(gdmlFile(), false);
+  G4VPhysicalVolume* world = parser.GetWorldVolume();
+  if ( !world )   {
+    printout(WARNING, "Geant4GeometryCache", "+++ Failed to read geometry cache %s. [Ignored]",
+             gdmlFile().c_str());
+    return nullptr;
+  }
+  G4Index g4(world);
+  bool    ok = g4.volumes.size() == index.volumeNames.size() && g4.placements.size() == index.placementNames.size();
+  for( size_t i = 0; ok && i < g4.volumes.size(); ++i )
+    ok = g4.volumes[i]->GetName() == stripped(index.volumeNames[i]);
+  for( size_t i = 0; ok && i < g4.placements.size(); ++i )  {
+    ok = g4.placements[i]->GetName()   == stripped(index.placementNames[i].first) &&
+      g4.placements[i]->GetCopyNo() == index.placementNames[i].second;
+  }
+  for( size_t i = 0; ok && i < index.volumes.size(); ++i )  {
+    const auto& r = index.volumes[i];
+    ok = r.first >= 0 && size_t(r.first) < g4.volumes.size() && r.second >= 0 && size_t(r.second) < tgeo.volumes.size();
+  }
+  for( size_t i = 0; ok && i < index.placements.size(); ++i )  {
+    const auto& r = index.placements[i];
+    ok = r.first >= 0 && size_t(r.first) < g4.placements.size() && r.second >= 0 && size_t(r.second) < tgeo.nodes.size();
+  }
+  for( size_t i = 0; ok && i < index.paths.size(); ++i )  {
+    for( int32_t j : index.paths[i].second )
+      ok = ok && j >= 0 && size_t(j) < g4.placements.size();
+  }
+  for( size_t i = 0; ok && i < index.imprints.size(); ++i )  {
+    const auto& r = index.imprints[i].first;
+    ok = r.first >= 0 && size_t(r.first) < tgeo.volumes.size() && r.second >= 0 && size_t(r.second) < g4.placements.size();
+    for( int32_t j : index.imprints[i].second )
+      ok = ok && j >= 0 && size_t(j) < tgeo.nodes.size();
+  }
+  if ( !ok )   {
+    printout(WARNING, "Geant4GeometryCache", "+++ Geometry structure of %s does not match the index. [Ignored]",
+             gdmlFile().c_str());
+    cleanGeometry();
+    return nullptr;
+  }
+
+  Geant4GeometryInfo& geo = cnv.init();
+  geo.manager = &description.manager();
+  cnv.collect(top, geo);
+  for( const auto& v : geo.volumes )
+    cnv.collectVolume(v.name(), v.ptr());
+  for( const auto& v : geo.vis )
+    cnv.handleVis(v.name(), v);
+  for( const auto& l : geo.limits )
+    cnv.handleLimitSet(l.first, l.second);
+  for( const auto& r : geo.regions )
+    cnv.handleRegion(r.first, r.second);
+
+  for( const auto& r : index.volumes )   {
+    const TGeoVolume* vol   = tgeo.volumes[r.second];
+    G4LogicalVolume*  g4vol = const_cast<G4LogicalVolume*>(g4.volumes[r.first]);
+    Volume            _v(vol);
+    Region            reg = _v.region();
+    LimitSet          lim = _v.limitSet();
+    VisAttr           vis = _v.visAttributes();
+    if ( reg.isValid() )   {
+      G4Region* region = geo.g4Regions[reg];
+      g4vol->SetRegion(region);
+      region->AddRootLogicalVolume(g4vol);
+    }
+    if ( lim.isValid() )
+      g4vol->SetUserLimits(geo.g4Limits[lim]);
+    if ( vis.isValid() )
+      g4vol->SetVisAttributes(geo.g4Vis[vis]);
+    geo.g4Volumes[vol] = g4vol;
+    geo.g4Solids[vol->GetShape()] = g4vol->GetSolid();
+    geo.g4Materials[Material(vol->GetMedium())] = g4vol->GetMaterial();
+  }
+  for( const auto& r : index.placements )
+    geo.g4Placements[tgeo.nodes[r.second]] = const_cast<G4VPhysicalVolume*>(g4.placements[r.first]);
+  for( const auto& p : index.paths )   {
+    Geant4GeometryInfo::Geant4PlacementPath path;
+    path.reserve(p.second.size());
+    for( int32_t i : p.second ) path.emplace_back(g4.placements[i]);
+    geo.g4Paths.emplace(move(path), p.first);
+  }
+  for( const auto& p : index.imprints )   {
+    Geant4GeometryMaps::VolumeChain chain;
+    chain.reserve(p.second.size());
+    for( int32_t i : p.second ) chain.emplace_back(tgeo.nodes[i]);
+    geo.g4VolumeImprints[tgeo.volumes[p.first.first]].emplace_back(move(chain), g4.placements[p.first.second]);
+  }
+  set<const TGeoVolume*> done;
+  restoreAssemblies(cnv, tgeo.nodes[0]->GetVolume(), done);
+  cnv.handleProperties(description.properties());
+  geo.setWorld(top.placement().ptr());
+  geo.valid = true;
+  printout(INFO, "Geant4GeometryCache", "+++ Restored Geant4 geometry from %s in %.2f seconds: "
+           "%ld volumes, %ld placements, %ld volume paths, %ld assemblies.", gdmlFile().c_str(),
+           seconds_since(start), long(index.volumes.size()), long(index.placements.size()),
+           long(index.paths.size()), long(geo.g4AssemblyVolumes.size()));
+  return cnv.detach();
+}
+
+/// Save the converted geometry to the cache files
+bool Geant4GeometryCache::save(const Geant4GeometryInfo& info, DetElement top)  const   {
+  auto       start = chrono::steady_clock::now();
+  G4Index    g4(info.world());
+  TGeoIndex  tgeo(top.placement().ptr());
+  CacheIndex index;
+
+  if ( hasOpticalProperties(description) )   {
+    printout(WARNING, "Geant4GeometryCache", "+++ Geometries with optical surfaces are not cached.");
+    return false;
+  }
+  for( const G4LogicalVolume* vol : g4.volumes )   {
+    G4LogicalVolume* v = const_cast<G4LogicalVolume*>(vol);
+    if ( G4ReflectionFactory::Instance()->IsReflected(v) || G4ReflectionFactory::Instance()->IsConstituent(v) )   {
+      printout(WARNING, "Geant4GeometryCache", "+++ Geometries with reflected volumes [%s] are not cached.",
+               vol->GetName().c_str());
+      return false;
+    }
+    index.volumeNames.emplace_back(vol->GetName());
+  }
+  for( const G4VPhysicalVolume* pv : g4.placements )
+    index.placementNames.emplace_back(pv->GetName(), pv->GetCopyNo());
+
+  index.key            = ::strtoull(key.c_str(), nullptr, 16);
+  index.numTGeoVolumes = tgeo.volumes.size();
+  index.numTGeoNodes   = tgeo.nodes.size();
+  for( const auto& v : info.g4Volumes )   {
+    auto i = g4.volumeIndex.find(v.second);
+    auto j = tgeo.volumeIndex.find(v.first.ptr());
+    if ( i != g4.volumeIndex.end() && j != tgeo.volumeIndex.end() )
+      index.volumes.emplace_back(i->second, j->second);
+  }
+  for( const auto& p : info.g4Placements )   {
+    auto i = g4.placementIndex.find(p.second);
+    auto j = tgeo.nodeIndex.find(p.first.ptr());
+    if ( i != g4.placementIndex.end() && j != tgeo.nodeIndex.end() )
+      index.placements.emplace_back(i->second, j->second);
+  }
+  for( const auto& p : info.g4Paths )   {
+    vector<int32_t> path;
+    path.reserve(p.first.size());
+    for( const G4VPhysicalVolume* pv : p.first )   {
+      auto i = g4.placementIndex.find(pv);
+      if ( i == g4.placementIndex.end() )   {
+        printout(WARNING, "Geant4GeometryCache", "+++ Volume path %s is not part of the geometry tree. "
+                 "Geometry not cached.", Geant4GeometryInfo::placementPath(p.first).c_str());
+        return false;
+      }
+      path.emplace_back(i->second);
+    }
+    index.paths.emplace_back(p.second, move(path));
+  }
+  for( const auto& v : info.g4VolumeImprints )   {
+    auto i = tgeo.volumeIndex.find(v.first.ptr());
+    for( const auto& e : v.second )   {
+      auto j = g4.placementIndex.find(e.second);
+      vector<int32_t> chain;
+      chain.reserve(e.first.size());
+      for( const TGeoNode* n : e.first )   {
+        auto k = tgeo.nodeIndex.find(n);
+        if ( k == tgeo.nodeIndex.end() ) break;
+        chain.emplace_back(k->second);
+      }
+      if ( i == tgeo.volumeIndex.end() || j == g4.placementIndex.end() || chain.size() != e.first.size() )   {
+        printout(WARNING, "Geant4GeometryCache", "+++ Imprint of assembly volume %s is not part of the "
+                 "geometry tree. Geometry not cached.", v.first.name());
+        return false;
+      }
+      index.imprints.emplace_back(make_pair(i->second, j->second), move(chain));
+    }
+  }
+
+  struct stat buff;
+  if ( ::stat(directory.c_str(), &buff) != 0 && ::mkdir(directory.c_str(), 0755) != 0 )   {
+    printout(WARNING, "Geant4GeometryCache", "+++ Cannot create cache directory %s. Geometry not cached.",
+             directory.c_str());
+    return false;
+  }
+  // Write to temporary files first: concurrent jobs may fill the same cache
+  string suffix = "." + to_string(::getpid());
+  string gdml   = directory + "/" + key + suffix + ".gdml";
+  string idx    = indexFile() + suffix;
+  G4GDMLParser parser;
+  parser.Write(gdml, info.world(), true);
+  if ( !index.write(idx) || ::rename(gdml.c_str(), gdmlFile().c_str()) != 0 ||
+       ::rename(idx.c_str(), indexFile().c_str()) != 0 )   {
+    printout(WARNING, "Geant4GeometryCache", "+++ Failed to write geometry cache %s.", indexFile().c_str());
+    ::unlink(gdml.c_str());
+    ::unlink(idx.c_str());
+    return false;
+  }
+  printout(INFO, "Geant4GeometryCache", "+++ Saved Geant4 geometry to %s in %.2f seconds.",
+           gdmlFile().c_str(), seconds_since(start));
+  return true;
+}
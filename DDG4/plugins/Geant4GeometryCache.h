@@ -0,0 +1,88 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDG4_PLUGINS_GEANT4GEOMETRYCACHE_H
+#define DDG4_PLUGINS_GEANT4GEOMETRYCACHE_H
+
+// Framework include files
+#include "DD4hep/Printout.h"
+#include "DD4hep/DetElement.h"
+
+// C/C++ include files
+#include <string>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Forward declarations
+    class Geant4Converter;
+    class Geant4GeometryInfo;
+
+    /// Cache of the Geant4 geometry converted from the dd4hep geometry
+    /**
+     *  The cache consists of two files in the cache directory named by a hash
+     *  of the TGeo geometry (volumes, shapes, materials, placements, volume
+     *  identifiers and readout descriptors of the sensitive volumes):
+     *  - <hash>.gdml:    the Geant4 materials, solids, logical and physical
+     *                    volumes written by the Geant4 GDML writer.
+     *  - <hash>.g4cache: a binary index relating the Geant4 volumes and
+     *                    placements to the TGeo volumes and nodes and
+     *                    containing the placement paths of the volume manager
+     *                    and the imprints of the assembly volumes.
+     *
+     *  When the geometry is restored, the TGeo to Geant4 conversion of solids,
+     *  volumes and placements is skipped. Regions, limit sets, visualization
+     *  attributes, assembly volumes and sensitive detector assignments are
+     *  cheap and are created as usual from the dd4hep geometry.
+     *
+     *  Geometries which are not preserved by the GDML round trip
+     *  (e.g. reflected volumes) are detected and not cached.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class Geant4GeometryCache  {
+    public:
+      /// Reference to the detector description
+      const Detector& description;
+      /// Directory holding the cache files
+      std::string     directory;
+      /// Hash of the TGeo geometry identifying the cache files
+      std::string     key;
+      /// Printout level
+      PrintLevel      printLevel;
+
+    public:
+      /// Initializing constructor. Computes the geometry hash
+      Geant4GeometryCache(const Detector& description, const std::string& directory, PrintLevel level);
+      /// Default destructor
+      ~Geant4GeometryCache() = default;
+      /// Compute the hash of the geometry below the top detector element
+      static unsigned long long int hash(DetElement top);
+      /// Name of the GDML file of the cache
+      std::string gdmlFile()  const;
+      /// Name of the index file of the cache
+      std::string indexFile()  const;
+      /// Check if the cache files exist
+      bool exists()  const;
+      /// Restore the geometry. Returns the detached geometry information or NULL on failure
+      Geant4GeometryInfo* restore(Geant4Converter& converter, DetElement top)  const;
+      /// Save the converted geometry to the cache files
+      bool save(const Geant4GeometryInfo& info, DetElement top)  const;
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+#endif // DDG4_PLUGINS_GEANT4GEOMETRYCACHE_H
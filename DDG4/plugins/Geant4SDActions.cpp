@@ -18,6 +18,8 @@
 #include "G4OpticalPhoton.hh"
 #include "G4VProcess.hh"
 
+// C/C++ include files
+#include <cmath>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -142,6 +144,102 @@ namespace dd4hep {
     }
     typedef Geant4SensitiveAction<Geant4Tracker> Geant4TrackerAction;
 
+    /// Compression of the Monte Carlo contributions of calorimeter hits
+    /**
+     *  If enabled by the property "TruthCompression", the contribution of a step
+     *  is merged into an existing contribution of the hit if it comes from the
+     *  same track within the time window "TruthTimeWindow". Deposit and length
+     *  are summed, time and position are averaged weighted by the deposit.
+     *  All contributions of the hit are searched, hence tracks with steps
+     *  interleaved with other tracks are compressed as well. After compression
+     *  a hit holds about one contribution per track, so the search stays short.
+     *
+     *  Note: the contributions are merged in place into Hit::truth. A separate
+     *  structure-of-arrays pool per collection would need to be copied back to
+     *  Hit::truth at the end of every event, because Geant4Output2ROOT and the
+     *  EDM4hep writer read the contributions from there. It would add a copy
+     *  and peak memory without saving any.
+     *
+     *  The memory held by the contribution vectors is measured at the end of
+     *  every event and reported at finalization.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class CalorimeterTruthCompression {
+    public:
+      typedef Geant4Calorimeter::Hit      Hit;
+      typedef Geant4HitData::Contribution Contribution;
+      /// Reference to the sensitive action
+      Geant4Sensitive* sensitive    = 0;
+      /// Property: Enable truth compression
+      bool             enabled      = false;
+      /// Property: Time window to merge contributions of the same track
+      double           time_window  = 1e0*CLHEP::ns;
+      /// Number of contributions offered
+      unsigned long    num_offered  = 0;
+      /// Number of contributions stored
+      unsigned long    num_stored   = 0;
+      /// Number of events measured
+      unsigned long    num_events   = 0;
+      /// Bytes allocated by the contribution vectors of all measured events
+      double           num_bytes    = 0e0;
+
+      /// Add the contribution to the hit
+      void add(Hit* hit, const Contribution& c)   {
+        if ( enabled )  {
+          ++num_offered;
+          for( auto i = hit->truth.rbegin(); i != hit->truth.rend(); ++i )  {
+            Contribution& e = *i;
+            if ( e.trackID == c.trackID && std::abs(e.time-c.time) <= time_window )  {
+              double sum = e.deposit + c.deposit;
+              if ( sum > 0e0 )  {
+                double w1 = e.deposit/sum, w2 = c.deposit/sum;
+                e.time = w1*e.time + w2*c.time;
+                e.x = float(w1*e.x + w2*c.x);
+                e.y = float(w1*e.y + w2*c.y);
+                e.z = float(w1*e.z + w2*c.z);
+              }
+              e.deposit = sum;
+              e.length += c.length;
+              return;
+            }
+          }
+          ++num_stored;
+        }
+        hit->truth.emplace_back(c);
+      }
+      /// Measure the memory allocated by the contribution vectors of the hits of one event
+      void measure(Geant4HitCollection* coll)   {
+        if ( enabled && coll )  {
+          for( size_t i = 0, n = coll->GetSize(); i < n; ++i )  {
+            Hit* hit = coll->hit(i);
+            num_bytes += double(hit->truth.capacity()*sizeof(Contribution));
+          }
+          ++num_events;
+        }
+      }
+      /// Print the compression summary of all events
+      void report()  const   {
+        if ( enabled && num_offered > 0 )  {
+          sensitive->info("+++ Truth compression: %lu contributions stored for %lu deposits [%.1f %%].",
+                          num_stored, num_offered, 100e0*double(num_stored)/double(num_offered));
+          sensitive->info("+++ Truth compression: contribution vectors allocated %.3f MBytes per event "
+                          "[%lu events]. Without compression %.3f MBytes per event would be needed at least.",
+                          num_events > 0 ? num_bytes/double(num_events)/1024e0/1024e0 : 0e0, num_events,
+                          num_events > 0 ? double(num_offered*sizeof(Contribution))/double(num_events)/1024e0/1024e0 : 0e0);
+        }
+      }
+    };
+
+    /// Declare the truth compression properties and attach the compression to the sensitive action
+    template <typename T> void declareTruthCompression(Geant4SensitiveAction<T>* action, T& data)   {
+      data.sensitive = action;
+      action->declareProperty("TruthCompression", data.enabled);
+      action->declareProperty("TruthTimeWindow",  data.time_window);
+    }
+
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     //               Geant4SensitiveAction<Calorimeter>
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -155,14 +253,33 @@ namespace dd4hep {
      *
      * @}
      */
+    /// Class to implement the standard sensitive detector for calorimeters
+    struct Geant4CalorimeterData : public CalorimeterTruthCompression {};
+
+    /// Initialization overload for specialization
+    template <> void Geant4SensitiveAction<Geant4CalorimeterData>::initialize() {
+      declareTruthCompression(this, m_userData);
+    }
+
+    /// Finalization overload for specialization
+    template <> void Geant4SensitiveAction<Geant4CalorimeterData>::finalize() {
+      m_userData.report();
+    }
+
+    /// G4VSensitiveDetector interface: Method invoked at the end of each event.
+    template <> void Geant4SensitiveAction<Geant4CalorimeterData>::end(G4HCofThisEvent* hce) {
+      m_userData.measure(collection(m_collectionID));
+      Geant4Sensitive::end(hce);
+    }
+
     /// Define collections created by this sensitivie action object
-    template <> void Geant4SensitiveAction<Geant4Calorimeter>::defineCollections() {
+    template <> void Geant4SensitiveAction<Geant4CalorimeterData>::defineCollections() {
       m_collectionID = declareReadoutFilteredCollection<Geant4Calorimeter::Hit>();
     }
 
     /// Method for generating hit(s) using the information of G4Step object.
     template <> bool
-    Geant4SensitiveAction<Geant4Calorimeter>::process(G4Step* step,G4TouchableHistory*) {
+    Geant4SensitiveAction<Geant4CalorimeterData>::process(G4Step* step,G4TouchableHistory*) {
       typedef Geant4Calorimeter::Hit Hit;
       Geant4StepHandler    h(step);
       HitContribution      contrib = Hit::extractContribution(step);
@@ -193,9 +310,8 @@ namespace dd4hep {
         Geant4TouchableHandler handler(step);
         DDSegmentation::Vector3D pos = m_segmentation.position(cell);
         Position global = h.localToGlobal(pos);
-        hit = new Hit(global);
+        hit = coll->create<Hit>(cell, global);
         hit->cellID = cell;
-        coll->add(cell, hit);
         printM2("%s> CREATE hit with deposit:%e MeV  Pos:%8.2f %8.2f %8.2f  %s  [%s]",
                 c_name(),contrib.deposit,pos.X,pos.Y,pos.Z,handler.path().c_str(),
                 coll->GetName().c_str());
@@ -204,13 +320,13 @@ namespace dd4hep {
           except("+++ Invalid CELL ID for hit!");
         }
       }
-      hit->truth.emplace_back(contrib);
+      m_userData.add(hit, contrib);
       hit->energyDeposit += contrib.deposit;
       mark(h.track);
       return true;
     }
     /// Method for generating hit(s) using the information of the G4GFlashSpot object.
-    template <> bool Geant4SensitiveAction<Geant4Calorimeter>::processGFlash(G4GFlashSpot* spot,
+    template <> bool Geant4SensitiveAction<Geant4CalorimeterData>::processGFlash(G4GFlashSpot* spot,
 									     G4TouchableHistory* /*hist*/ )
     {
       typedef Geant4Calorimeter::Hit Hit;
@@ -235,9 +351,8 @@ namespace dd4hep {
 	Geant4TouchableHandler   handler(h.touchable());
         DDSegmentation::Vector3D pos = m_segmentation.position(cell);
         Position global = h.localToGlobal(pos);
-        hit = new Hit(global);
+        hit = coll->create<Hit>(cell, global);
         hit->cellID = cell;
-        coll->add(cell, hit);
         printM2("%s> CREATE hit with deposit:%e MeV  Pos:%8.2f %8.2f %8.2f  %s  [%s]",
                 c_name(),contrib.deposit,pos.X,pos.Y,pos.Z,handler.path().c_str(),
                 coll->GetName().c_str());
@@ -246,12 +361,12 @@ namespace dd4hep {
           except("+++ Invalid CELL ID for hit!");
         }
       }
-      hit->truth.emplace_back(contrib);
+      m_userData.add(hit, contrib);
       hit->energyDeposit += contrib.deposit;
       mark(h.track);
       return true;
     }
-    typedef Geant4SensitiveAction<Geant4Calorimeter> Geant4CalorimeterAction;
+    typedef Geant4SensitiveAction<Geant4CalorimeterData> Geant4CalorimeterAction;
 
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     //               Geant4SensitiveAction<OpticalCalorimeter>
@@ -363,7 +478,23 @@ namespace dd4hep {
      * @}
      */
     /// Class to implement the standard sensitive detector for scintillator calorimeters
-    struct Geant4ScintillatorCalorimeter {};
+    struct Geant4ScintillatorCalorimeter : public CalorimeterTruthCompression {};
+
+    /// Initialization overload for specialization
+    template <> void Geant4SensitiveAction<Geant4ScintillatorCalorimeter>::initialize() {
+      declareTruthCompression(this, m_userData);
+    }
+
+    /// Finalization overload for specialization
+    template <> void Geant4SensitiveAction<Geant4ScintillatorCalorimeter>::finalize() {
+      m_userData.report();
+    }
+
+    /// G4VSensitiveDetector interface: Method invoked at the end of each event.
+    template <> void Geant4SensitiveAction<Geant4ScintillatorCalorimeter>::end(G4HCofThisEvent* hce) {
+      m_userData.measure(collection(m_collectionID));
+      Geant4Sensitive::end(hce);
+    }
 
     /// Define collections created by this sensitivie action object
     template <> void Geant4SensitiveAction<Geant4ScintillatorCalorimeter>::defineCollections() {
@@ -398,9 +529,8 @@ namespace dd4hep {
         Geant4TouchableHandler handler(step);
         DDSegmentation::Vector3D pos = m_segmentation.position(cell);
         Position global = h.localToGlobal(pos);
-        hit = new Hit(global);
+        hit = coll->create<Hit>(cell, global);
         hit->cellID = cell;
-        coll->add(cell, hit);
         printM2("CREATE hit with deposit:%e MeV  Pos:%8.2f %8.2f %8.2f  %s",
                 contrib.deposit,pos.X,pos.Y,pos.Z,handler.path().c_str());
         if ( 0 == hit->cellID )  { // for debugging only!
@@ -408,7 +538,7 @@ namespace dd4hep {
           except("+++ Invalid CELL ID for hit!");
         }
       }
-      hit->truth.emplace_back(contrib);
+      m_userData.add(hit, contrib);
       hit->energyDeposit += contrib.deposit;
       mark(h.track);
       return true;
@@ -439,9 +569,8 @@ namespace dd4hep {
 	Geant4TouchableHandler   handler(h.touchable());
         DDSegmentation::Vector3D pos = m_segmentation.position(cell);
         Position global = h.localToGlobal(pos);
-        hit = new Hit(global);
+        hit = coll->create<Hit>(cell, global);
         hit->cellID = cell;
-        coll->add(cell, hit);
         printM2("CREATE hit with deposit:%e MeV  Pos:%8.2f %8.2f %8.2f  %s",
                 contrib.deposit,pos.X,pos.Y,pos.Z,handler.path().c_str());
         if ( 0 == hit->cellID )  { // for debugging only!
@@ -449,7 +578,7 @@ namespace dd4hep {
           except("+++ Invalid CELL ID for hit!");
         }
       }
-      hit->truth.emplace_back(contrib);
+      m_userData.add(hit, contrib);
       hit->energyDeposit += contrib.deposit;
       mark(h.track);
       return true;
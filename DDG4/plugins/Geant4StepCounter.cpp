@@ -0,0 +1,164 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "DDG4/Geant4SteppingAction.h"
+
+// C/C++ include files
+#include <chrono>
+
+// Forward declarations
+class G4Run;
+class G4Event;
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim   {
+
+    /// Stepping action to measure the stepping throughput of a run
+    /**
+     *  Counts all steps and the steps starting in a sensitive volume
+     *  and prints the number of steps per second at the end of the run.
+     *  In addition the time per event and the heap allocations of the
+     *  hit collections per event are reported.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class Geant4StepCounter : public Geant4SteppingAction  {
+    protected:
+      typedef std::chrono::steady_clock clock_t;
+      /// Start time of the run
+      clock_t::time_point m_start;
+      /// Start time of the current event
+      clock_t::time_point m_eventStart;
+      /// Number of steps seen in this run
+      unsigned long m_numSteps = 0;
+      /// Number of steps starting in a sensitive volume
+      unsigned long m_numSensitive = 0;
+      /// Number of events seen in this run
+      unsigned long m_numEvents = 0;
+      /// Number of hits created in this run
+      unsigned long m_numHits = 0;
+      /// Number of heap allocations of the hit collections in this run
+      unsigned long m_numAllocations = 0;
+      /// Accumulated event processing time in seconds
+      double        m_eventTime = 0e0;
+    public:
+      /// Standard constructor
+      Geant4StepCounter(Geant4Context* context, const std::string& name);
+      /// Default destructor
+      virtual ~Geant4StepCounter();
+      /// User stepping callback
+      virtual void operator()(const G4Step* step, G4SteppingManager* mgr)  override;
+      /// Registered callback on Begin-run
+      void beginRun(const G4Run* run);
+      /// Registered callback on End-run
+      void endRun(const G4Run* run);
+      /// Registered callback on Begin-event
+      void beginEvent(const G4Event* event);
+      /// Registered callback on End-event
+      void endEvent(const G4Event* event);
+    };
+  }
+}
+
+//====================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------
+//
+//  Author     : M.Frank
+//
+//====================================================================
+
+// Framework include files
+#include "DD4hep/InstanceCount.h"
+#include "DD4hep/Printout.h"
+#include "DDG4/Geant4RunAction.h"
+#include "DDG4/Geant4EventAction.h"
+#include "DDG4/Geant4HitCollection.h"
+#include "G4HCofThisEvent.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Event.hh"
+#include "G4Step.hh"
+
+using namespace dd4hep::sim;
+
+#include "DDG4/Factories.h"
+DECLARE_GEANT4ACTION(Geant4StepCounter)
+
+/// Standard constructor
+Geant4StepCounter::Geant4StepCounter(Geant4Context* ctxt, const std::string& nam)
+  : Geant4SteppingAction(ctxt,nam)
+{
+  m_needsControl = true;
+  runAction().callAtBegin(this,&Geant4StepCounter::beginRun);
+  runAction().callAtEnd(this,&Geant4StepCounter::endRun);
+  eventAction().callAtBegin(this,&Geant4StepCounter::beginEvent);
+  eventAction().callAtEnd(this,&Geant4StepCounter::endEvent);
+  InstanceCount::increment(this);
+}
+
+/// Default destructor
+Geant4StepCounter::~Geant4StepCounter() {
+  InstanceCount::decrement(this);
+}
+
+/// User stepping callback
+void Geant4StepCounter::operator()(const G4Step* step, G4SteppingManager*) {
+  const G4VTouchable* touchable = step->GetPreStepPoint()->GetTouchable();
+  const G4VPhysicalVolume* pv = touchable ? touchable->GetVolume() : nullptr;
+  ++m_numSteps;
+  if ( pv && pv->GetLogicalVolume()->GetSensitiveDetector() )
+    ++m_numSensitive;
+}
+
+/// Registered callback on Begin-run
+void Geant4StepCounter::beginRun(const G4Run* /* run */) {
+  m_numSteps = m_numSensitive = 0;
+  m_numEvents = m_numHits = m_numAllocations = 0;
+  m_eventTime = 0e0;
+  m_start = clock_t::now();
+}
+
+/// Registered callback on End-run
+void Geant4StepCounter::endRun(const G4Run* /* run */) {
+  double secs = std::chrono::duration<double>(clock_t::now()-m_start).count();
+  double nevt = m_numEvents > 0 ? double(m_numEvents) : 1e0;
+  always("+++ Run: %lu steps [%lu in sensitive volumes] in %.3f seconds: %.0f steps/second",
+         m_numSteps, m_numSensitive, secs, secs > 0e0 ? double(m_numSteps)/secs : 0e0);
+  always("+++ Run: %lu events: %.3f seconds/event %.0f hits/event %.0f hit storage allocations/event",
+         m_numEvents, m_eventTime/nevt, double(m_numHits)/nevt, double(m_numAllocations)/nevt);
+}
+
+/// Registered callback on Begin-event
+void Geant4StepCounter::beginEvent(const G4Event* /* event */) {
+  m_eventStart = clock_t::now();
+}
+
+/// Registered callback on End-event
+void Geant4StepCounter::endEvent(const G4Event* event) {
+  G4HCofThisEvent* hce = event->GetHCofThisEvent();
+  m_eventTime += std::chrono::duration<double>(clock_t::now()-m_eventStart).count();
+  ++m_numEvents;
+  for( int i = 0, n = hce ? hce->GetNumberOfCollections() : 0; i < n; ++i )  {
+    Geant4HitCollection* coll = dynamic_cast<Geant4HitCollection*>(hce->GetHC(i));
+    if ( coll )  {
+      m_numHits        += coll->GetSize();
+      m_numAllocations += coll->allocations();
+    }
+  }
+}
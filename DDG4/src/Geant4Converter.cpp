@@ -76,6 +76,10 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <exception>
 
 namespace units = dd4hep;
 using namespace dd4hep::detail;
@@ -411,16 +415,27 @@ void* Geant4Converter::handleMaterial(const string& name, Material medium) const
 void* Geant4Converter::handleSolid(const string& name, const TGeoShape* shape) const {
   G4VSolid* solid = 0;
   if ( shape ) {
-    if ( 0 != (solid = data().g4Solids[shape]) )   {
-      return solid;
+    Geant4GeometryMaps::SolidMap& solids = data().g4Solids;
+    Geant4GeometryMaps::SolidMap::const_iterator i = solids.find(shape);
+    if ( i != solids.end() )   {
+      return (*i).second;
     }
+    solid = convertSolid(name, shape);
+    solids[shape] = solid;
+  }
+  return solid;
+}
+
+/// Convert a shape to a Geant4 solid without registering it in the geometry information
+G4VSolid* Geant4Converter::convertSolid(const string& name, const TGeoShape* shape) const {
+  G4VSolid* solid = 0;
+  if ( shape ) {
     TClass*    isa = shape->IsA();
     PrintLevel lvl = debugShapes ? ALWAYS : outputLevel;
     if (isa == TGeoShapeAssembly::Class()) {
       // Assemblies have no corresponding 'shape' in Geant4. Ignore the shape translation.
       // It does not harm, since this 'shape' is never accessed afterwards.
-      data().g4Solids[shape] = solid = convertShape<TGeoShapeAssembly>(shape);
-      return solid;
+      return convertShape<TGeoShapeAssembly>(shape);
     }
     else if (isa == TGeoBBox::Class())
       solid = convertShape<TGeoBBox>(shape);
@@ -472,9 +487,9 @@ void* Geant4Converter::handleSolid(const string& name, const TGeoShape* shape) c
       G4Scale3D        scal(vals[0], vals[1], vals[2]);
       G4VSolid* g4solid = (G4VSolid*)handleSolid(sol->GetName(), sol);
       if ( scal.xx()>0e0 && scal.yy()>0e0 && scal.zz()>0e0 )
-	solid = new G4ScaledSolid(sh->GetName(), g4solid, scal);
+	solid = createSolid<G4ScaledSolid>(sh->GetName(), g4solid, scal);
       else
-	solid = new G4ReflectedSolid(g4solid->GetName()+"_refl", g4solid, scal);
+	solid = createSolid<G4ReflectedSolid>(g4solid->GetName()+"_refl", g4solid, scal);
 #else
       except("Geant4Converter","++ TGeoScaledShape are only supported by Geant4 for versions >= 10.3");
 #endif
@@ -513,14 +528,12 @@ void* Geant4Converter::handleSolid(const string& name, const TGeoShape* shape) c
             double zorig  = rrs->GetOrigin()[2];
             double zcut2  = dz + zorig;
             double zcut1  = 2 * zorig - zcut2;
-            solid = new G4Ellipsoid(name,
-                                    sx * radius * CM_2_MM,
-                                    sy * radius * CM_2_MM,
-                                    radius * CM_2_MM,
-                                    zcut1 * CM_2_MM,
-                                    zcut2 * CM_2_MM);
-            data().g4Solids[shape] = solid;
-            return solid;
+            return createSolid<G4Ellipsoid>(name,
+                                            sx * radius * CM_2_MM,
+                                            sy * radius * CM_2_MM,
+                                            radius * CM_2_MM,
+                                            zcut1 * CM_2_MM,
+                                            zcut2 * CM_2_MM);
           }
         }
       }
@@ -528,21 +541,21 @@ void* Geant4Converter::handleSolid(const string& name, const TGeoShape* shape) c
       if ( matrix->IsRotation() ) {
         MyTransform3D transform(matrix->GetTranslation(),matrix->GetRotationMatrix());
         if (oper == TGeoBoolNode::kGeoSubtraction)
-          solid = new G4SubtractionSolid(name, left, right, transform);
+          solid = createSolid<G4SubtractionSolid>(name, left, right, transform);
         else if (oper == TGeoBoolNode::kGeoUnion)
-          solid = new G4UnionSolid(name, left, right, transform);
+          solid = createSolid<G4UnionSolid>(name, left, right, transform);
         else if (oper == TGeoBoolNode::kGeoIntersection)
-          solid = new G4IntersectionSolid(name, left, right, transform);
+          solid = createSolid<G4IntersectionSolid>(name, left, right, transform);
       }
       else {
         const Double_t *t = matrix->GetTranslation();
         G4ThreeVector transform(t[0] * CM_2_MM, t[1] * CM_2_MM, t[2] * CM_2_MM);
         if (oper == TGeoBoolNode::kGeoSubtraction)
-          solid = new G4SubtractionSolid(name, left, right, 0, transform);
+          solid = createSolid<G4SubtractionSolid>(name, left, right, nullptr, transform);
         else if (oper == TGeoBoolNode::kGeoUnion)
-          solid = new G4UnionSolid(name, left, right, 0, transform);
+          solid = createSolid<G4UnionSolid>(name, left, right, nullptr, transform);
         else if (oper == TGeoBoolNode::kGeoIntersection)
-          solid = new G4IntersectionSolid(name, left, right, 0, transform);
+          solid = createSolid<G4IntersectionSolid>(name, left, right, nullptr, transform);
       }
     }
 
@@ -551,7 +564,6 @@ void* Geant4Converter::handleSolid(const string& name, const TGeoShape* shape) c
              name.c_str(), isa->GetName());
     printout(lvl,"Geant4Converter","++ Successessfully converted shape [%p] of type:%s to %s.",
              solid,isa->GetName(),typeName(typeid(*solid)).c_str());
-    data().g4Solids[shape] = solid;
   }
   return solid;
 }
@@ -1307,16 +1319,105 @@ namespace  {
       }
     }
   }
+
+  /// Helper to convert solids concurrently
+  /**
+   *  The components of boolean and scaled shapes must be converted before the
+   *  shapes using them. The shapes are therefore sorted into levels: level 0
+   *  holds primitive shapes, level N shapes with components of levels < N.
+   *  All shapes of one level are converted concurrently. The results are
+   *  registered sequentially once the level is done, so that the solid map is
+   *  only read while the conversion threads run.
+   *
+   *  \author  M.Frank
+   *  \version 1.0
+   *  \ingroup DD4HEP_SIMULATION
+   */
+  class SolidConversion  {
+  public:
+    typedef pair<string, const TGeoShape*> Item;
+    /// Reference to the converter
+    const Geant4Converter&      converter;
+    /// Conversion level of each shape
+    map<const TGeoShape*, size_t> levels;
+    /// Shapes to be converted ordered by level
+    vector<vector<Item> >         items;
+
+    /// Initializing constructor
+    SolidConversion(const Geant4Converter& cnv) : converter(cnv)  {}
+    /// Add a shape and all its components
+    size_t add(const string& name, const TGeoShape* shape)   {
+      auto i = levels.find(shape);
+      if ( i != levels.end() )
+        return (*i).second;
+      size_t  level = 0;
+      TClass* isa   = shape->IsA();
+      if ( converter.data().g4Solids.find(shape) != converter.data().g4Solids.end() )  {
+        return 0;
+      }
+      else if ( isa == TGeoCompositeShape::Class() )   {
+        const TGeoBoolNode* boolean = ((const TGeoCompositeShape*)shape)->GetBoolNode();
+        level = 1 + max(add(name + "_left",  boolean->GetLeftShape()),
+                        add(name + "_right", boolean->GetRightShape()));
+      }
+      else if ( isa == TGeoScaledShape::Class() )   {
+        const TGeoShape* sol = ((const TGeoScaledShape*)shape)->GetShape();
+        level = 1 + add(sol->GetName(), sol);
+      }
+      levels.emplace(shape, level);
+      if ( items.size() <= level ) items.resize(level+1);
+      items[level].emplace_back(name, shape);
+      return level;
+    }
+    /// Convert all shapes using the requested number of threads
+    void convert(size_t num_threads)   {
+      Geant4GeometryMaps::SolidMap& solids = converter.data().g4Solids;
+      for( const auto& level : items )   {
+        vector<G4VSolid*>     results(level.size(), nullptr);
+        vector<exception_ptr> errors(level.size());
+        atomic<size_t>        next(0);
+        auto worker = [this, &level, &results, &errors, &next]()  {
+          for( size_t i = next++; i < level.size(); i = next++ )   {
+            try  {
+              results[i] = converter.convertSolid(level[i].first, level[i].second);
+            }
+            catch(...)  {
+              errors[i] = current_exception();
+            }
+          }
+        };
+        vector<thread> threads;
+        for( size_t i = 1; i < min(num_threads, level.size()); ++i )
+          threads.emplace_back(worker);
+        worker();
+        for( auto& t : threads ) t.join();
+        for( size_t i = 0; i < level.size(); ++i )   {
+          if ( errors[i] ) rethrow_exception(errors[i]);
+          solids[level[i].second] = results[i];
+        }
+      }
+    }
+  };
 }
 
 /// Create geometry conversion
 Geant4Converter& Geant4Converter::create(DetElement top) {
+  typedef chrono::steady_clock clock_type;
+  auto seconds = [](clock_type::time_point& start)  {
+    clock_type::time_point now = clock_type::now();
+    double secs = chrono::duration<double>(now - start).count();
+    start = now;
+    return secs;
+  };
+  clock_type::time_point start = clock_type::now(), phase = start;
+  double t_collect = 0e0, t_materials = 0e0, t_solids = 0e0, t_volumes = 0e0, t_placements = 0e0;
   Geant4GeometryInfo& geo = this->init();
   World wrld = top.world();
   m_data->clear();
   geo.manager = &wrld.detectorDescription().manager();
   collect(top, geo);
   checkOverlaps = false;
+  t_collect = seconds(phase);
   // We do not have to handle defines etc.
   // All positions and the like are not really named.
   // Hence, start creating the G4 objects for materials, solids and log volumes.
@@ -1326,8 +1427,27 @@ Geant4Converter& Geant4Converter::create(DetElement top) {
 #endif
   
   handle(this,     geo.volumes, &Geant4Converter::collectVolume);
-  handle(this,     geo.solids,  &Geant4Converter::handleSolid);
+  // Materials are registered in the global Geant4 material table and their index
+  // must be reproducible: convert them sequentially in the order of the volumes.
+  for( const auto& vol : geo.volumes )   {
+    TGeoMedium* med = vol->GetMedium();
+    bool is_assembly = vol->IsA() == TGeoVolumeAssembly::Class() || vol->GetShape()->IsA() == TGeoShapeAssembly::Class();
+    if ( med && !is_assembly && !vol.testFlagBit(Volume::VETO_SIMU) )
+      handleMaterial(med->GetName(), Material(med));
+  }
+  printout(outputLevel, "Geant4Converter", "++ Handled %ld materials.", geo.g4Materials.size());
+  t_materials = seconds(phase);
+  if ( numThreads > 1 )   {
+    SolidConversion solids(*this);
+    for( TGeoShape* sh : geo.solids )
+      solids.add(sh->GetName(), sh);
+    solids.convert(numThreads);
+  }
+  else   {
+    handle(this,   geo.solids,  &Geant4Converter::handleSolid);
+  }
   printout(outputLevel, "Geant4Converter", "++ Handled %ld solids.", geo.solids.size());
+  t_solids = seconds(phase);
   handleRefs(this, geo.vis,     &Geant4Converter::handleVis);
   printout(outputLevel, "Geant4Converter", "++ Handled %ld visualization attributes.", geo.vis.size());
   handleMap(this,  geo.limits,  &Geant4Converter::handleLimitSet);
@@ -1336,6 +1456,7 @@ Geant4Converter& Geant4Converter::create(DetElement top) {
   printout(outputLevel, "Geant4Converter", "++ Handled %ld regions.", geo.regions.size());
   handle(this,     geo.volumes, &Geant4Converter::handleVolume);
   printout(outputLevel, "Geant4Converter", "++ Handled %ld volumes.", geo.volumes.size());
+  t_volumes = seconds(phase);
   handleRMap(this, *m_data,     &Geant4Converter::handleAssembly);
   // Now place all this stuff appropriately
   handleRMap(this, *m_data,     &Geant4Converter::handlePlacement);
@@ -1344,6 +1465,7 @@ Geant4Converter& Geant4Converter::create(DetElement top) {
   handleArray(this, geo.manager->GetListOfSkinSurfaces(),   &Geant4Converter::handleSkinSurface);
   handleArray(this, geo.manager->GetListOfBorderSurfaces(), &Geant4Converter::handleBorderSurface);
 #endif
+  t_placements = seconds(phase);
   //==================== Fields
   handleProperties(m_detDesc.properties());
   if ( printSensitives )  {
@@ -1356,5 +1478,8 @@ Geant4Converter& Geant4Converter::create(DetElement top) {
   geo.setWorld(top.placement().ptr());
   geo.valid = true;
   printout(INFO, "Geant4Converter", "+++  Successfully converted geometry to Geant4.");
+  printout(INFO, "Geant4Converter", "+++  Conversion time: %.3f sec [collect: %.3f materials: %.3f "
+           "solids: %.3f (%d threads) volumes: %.3f placements: %.3f]", seconds(start), t_collect,
+           t_materials, t_solids, max(numThreads, 1), t_volumes, t_placements);
   return *this;
 }
@@ -17,17 +17,54 @@
 #include "DDG4/Geant4Data.h"
 #include "G4Allocator.hh"
 
+// C/C++ include files
+#include <cstdlib>
+
 using namespace dd4hep;
 using namespace dd4hep::sim;
 
 G4ThreadLocal G4Allocator<Geant4HitWrapper>* HitWrapperAllocator = 0;
 
+namespace {
+  /// Maximal number of released arena blocks kept per thread
+  constexpr size_t MAX_FREE_ARENA_BLOCKS = 1024;
+  /// Released arena blocks of this thread ready for reuse
+  thread_local std::vector<char*>* s_freeBlocks = 0;
+  /// Flag set once the released blocks of this thread were freed at thread exit
+  thread_local bool s_freeBlocksFinalized = false;
+
+  /// Free the released arena blocks at thread exit
+  class ArenaBlocksGuard  {
+  public:
+    /// Default destructor
+    ~ArenaBlocksGuard()  {
+      if ( s_freeBlocks )  {
+        for( char* b : *s_freeBlocks ) ::free(b);
+        delete s_freeBlocks;
+        s_freeBlocks = 0;
+      }
+      s_freeBlocksFinalized = true;
+    }
+  };
+  thread_local ArenaBlocksGuard s_freeBlocksGuard;
+
+  /// Access the released arena blocks of this thread
+  std::vector<char*>* free_arena_blocks()  {
+    if ( !s_freeBlocks && !s_freeBlocksFinalized )  {
+      (void)&s_freeBlocksGuard;
+      s_freeBlocks = new std::vector<char*>();
+    }
+    return s_freeBlocks;
+  }
+}
+
 Geant4HitWrapper::InvalidHit::~InvalidHit() {
 }
 
 /// Initializing Constructor
-Geant4HitWrapper::HitManipulator::HitManipulator(const ComponentCast& c, const ComponentCast& v)
-  : cast(c), vec_type(v) {
+Geant4HitWrapper::HitManipulator::HitManipulator(const ComponentCast& c, const ComponentCast& v,
+                                                 ComponentCast::destroy_t d)
+  : cast(c), vec_type(v), destruct(d) {
   InstanceCount::increment(this);
 }
 
@@ -39,7 +76,10 @@ Geant4HitWrapper::HitManipulator::~HitManipulator() {
 /// Default destructor
 Geant4HitWrapper::~Geant4HitWrapper() {
   if (m_data.first && m_data.second) {
-    (*m_data.second->cast.destroy)(m_data.first);
+    if ( m_data.second->destruct )
+      (*m_data.second->destruct)(m_data.first);
+    else
+      (*m_data.second->cast.destroy)(m_data.first);
     m_data.first = 0;
   }
 }
@@ -73,6 +113,92 @@ Geant4HitWrapper::Wrapper Geant4HitWrapper::releaseData() {
   return w;
 }
 
+constexpr size_t Geant4HitCollection::KeyIndex::EMPTY;
+constexpr size_t Geant4HitCollection::Arena::BLOCK_SIZE;
+
+/// Resize the table to the given number of slots (power of 2)
+void Geant4HitCollection::KeyIndex::rehash(size_t num_slots)   {
+  std::vector<Slot> slots(num_slots, Slot(0, EMPTY));
+  size_t mask = num_slots - 1;
+  for( const Slot& s : m_slots )  {
+    if ( s.second != EMPTY )  {
+      size_t i = hash(s.first) & mask;
+      while( slots[i].second != EMPTY ) i = (i + 1) & mask;
+      slots[i] = s;
+    }
+  }
+  m_slots.swap(slots);
+  ++m_allocations;
+}
+
+/// Insert new key. Returns false if the key is already present
+bool Geant4HitCollection::KeyIndex::insert(VolumeID key, size_t index)   {
+  if ( 2*(m_count+1) > m_slots.size() )  {
+    rehash(m_slots.empty() ? 1024 : 2*m_slots.size());
+  }
+  size_t mask = m_slots.size() - 1;
+  for( size_t i = hash(key) & mask; ; i = (i + 1) & mask )  {
+    Slot& s = m_slots[i];
+    if ( s.second == EMPTY )  {
+      s.first  = key;
+      s.second = index;
+      ++m_count;
+      return true;
+    }
+    else if ( s.first == key )  {
+      return false;
+    }
+  }
+}
+
+/// Remove all entries
+void Geant4HitCollection::KeyIndex::clear()   {
+  if ( m_count > 0 )  {
+    std::fill(m_slots.begin(), m_slots.end(), Slot(0, EMPTY));
+    m_count = 0;
+  }
+}
+
+/// Default destructor: release all blocks
+Geant4HitCollection::Arena::~Arena()   {
+  release();
+}
+
+/// Attach a new memory block
+void* Geant4HitCollection::Arena::extend(size_t len, size_t alignment)   {
+  if ( len + alignment > BLOCK_SIZE )  {
+    throw std::runtime_error("Geant4HitCollection: Object too large for the hit arena.");
+  }
+  std::vector<char*>* free_blocks = free_arena_blocks();
+  char* block = 0;
+  if ( free_blocks && !free_blocks->empty() )  {
+    block = free_blocks->back();
+    free_blocks->pop_back();
+  }
+  else if ( !(block = (char*)::malloc(BLOCK_SIZE)) )  {
+    throw std::bad_alloc();
+  }
+  else  {
+    ++m_allocations;
+  }
+  m_blocks.emplace_back(block);
+  m_used = 0;
+  return allocate(len, alignment);
+}
+
+/// Release all memory blocks
+void Geant4HitCollection::Arena::release()   {
+  std::vector<char*>* free_blocks = free_arena_blocks();
+  for( char* b : m_blocks )  {
+    if ( free_blocks && free_blocks->size() < MAX_FREE_ARENA_BLOCKS )
+      free_blocks->emplace_back(b);
+    else
+      ::free(b);
+  }
+  m_blocks.clear();
+  m_used = BLOCK_SIZE;
+}
+
 /// Default destructor
 Geant4HitCollection::Compare::~Compare()  {
 }
@@ -81,6 +207,7 @@ Geant4HitCollection::Compare::~Compare()  {
 Geant4HitCollection::~Geant4HitCollection() {
   m_hits.clear();
   m_keys.clear();
+  m_arena.release();
   InstanceCount::decrement(this);
 }
 
@@ -99,11 +226,32 @@ void Geant4HitCollection::newInstance() {
   InstanceCount::increment(this);
 }
 
+/// Set optimization flags
+void Geant4HitCollection::setOptimize(int flag)   {
+  if ( (flag&OPTIMIZE_HASHEDSTORAGE) && !m_flags.bits.hashedStorage )  {
+    for( const auto& k : m_keys )
+      m_index.insert(k.first, k.second);
+    m_keys.clear();
+  }
+  m_flags.value |= flag;
+}
+
+/// Register the hit index of a new key. Returns false if the key is already present
+bool Geant4HitCollection::insertKey(VolumeID key, size_t index)   {
+  if ( m_flags.bits.hashedStorage )
+    return m_index.insert(key, index);
+  else if ( m_keys.emplace(key, index).second )
+    return ++m_allocations, true;
+  return false;
+}
+
 /// Clear the collection (Deletes all valid references to real hits)
 void Geant4HitCollection::clear()   {
   m_lastHit = ULONG_MAX;
   m_hits.clear();
   m_keys.clear();
+  m_index.clear();
+  m_arena.release();
 }
 
 /// Find hit in a collection by comparison of attributes
@@ -124,14 +272,18 @@ void* Geant4HitCollection::findHit(const Compare& cmp)  {
 
 /// Find hit in a collection by comparison of the key
 Geant4HitWrapper* Geant4HitCollection::findHitByKey(VolumeID key)   {
-  Keys::const_iterator i=m_keys.find(key);
-  if ( i == m_keys.end() ) return 0;
-  m_lastHit = (*i).second;
+  size_t index = findKey(key);
+  if ( index == ULONG_MAX ) return 0;
+  m_lastHit = index;
   return &m_hits.at(m_lastHit);
 }
 
 /// Release all hits from the Geant4 container and pass ownership to the caller
 void Geant4HitCollection::releaseData(const ComponentCast& cast, std::vector<void*>* result) {
+  if ( !m_arena.empty() )  {
+    throw std::runtime_error("Geant4HitCollection: Hits of "+GetName()+" are owned by the collection "
+                             "[OPTIMIZE_HASHEDSTORAGE] and cannot be released.");
+  }
   result->reserve(m_hits.size());
   for (size_t j = 0, n = m_hits.size(); j < n; ++j) {
     Geant4HitWrapper& w = m_hits.at(j);
@@ -143,6 +295,7 @@ void Geant4HitCollection::releaseData(const ComponentCast& cast, std::vector<voi
   }
   m_lastHit = ULONG_MAX;
   m_keys.clear();
+  m_index.clear();
 }
 
 /// Release all hits from the Geant4 container. Ownership stays with the container
@@ -160,6 +313,10 @@ void Geant4HitCollection::getData(const ComponentCast& cast, std::vector<void*>*
 
 /// Release all hits from the Geant4 container and pass ownership to the caller
 void Geant4HitCollection::releaseHitsUnchecked(std::vector<void*>& result) {
+  if ( !m_arena.empty() )  {
+    throw std::runtime_error("Geant4HitCollection: Hits of "+GetName()+" are owned by the collection "
+                             "[OPTIMIZE_HASHEDSTORAGE] and cannot be released.");
+  }
   result.reserve(m_hits.size());
   for (size_t j = 0, n = m_hits.size(); j < n; ++j) {
     Geant4HitWrapper& w = m_hits.at(j);
@@ -167,6 +324,7 @@ void Geant4HitCollection::releaseHitsUnchecked(std::vector<void*>& result) {
   }
   m_lastHit = ULONG_MAX;
   m_keys.clear();
+  m_index.clear();
 }
 
 /// Release all hits from the Geant4 container. Ownership stays with the container
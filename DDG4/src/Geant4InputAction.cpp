@@ -22,6 +22,13 @@
 
 #include "G4Event.hh"
 
+// C/C++ include files
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <exception>
+#include <condition_variable>
+
 using namespace std;
 using namespace dd4hep::sim;
 typedef dd4hep::detail::ReferenceBitMask<int> PropertyMask;
@@ -30,7 +37,7 @@ typedef Geant4InputAction::Vertices Vertices ;
 
 /// Initializing constructor
 Geant4EventReader::Geant4EventReader(const std::string& nam)
-  : m_name(nam), m_directAccess(false), m_currEvent(0), m_inputAction(0)
+  : m_name(nam), m_directAccess(false), m_asyncAccess(false), m_currEvent(0), m_inputAction(0)
 {
 }
 
@@ -116,6 +123,119 @@ Geant4EventReader::moveToEvent(int /* event_number */)   {
 }
 #endif
 
+/// Thread reading ahead the events of an event reader
+/**
+ *  The events are read in sequence and queued together with the reader
+ *  status. The queue is bounded: the thread waits if the simulation
+ *  falls behind. Reading stops after the first failure, whose status
+ *  is then returned for all further requests.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_SIMULATION
+ */
+class Geant4InputAction::Prefetcher  {
+public:
+  /// Event data read ahead
+  struct Event  {
+    int       number;
+    int       status;
+    Vertices  vertices;
+    Particles particles;
+  };
+  /// Reference to the event reader
+  Geant4EventReader*  reader;
+  /// Maximal number of queued events
+  size_t              max_queue;
+  /// Next event number to be read
+  int                 next;
+  /// Protection of the queue
+  mutex               lock;
+  /// Signal that an event was taken from the queue
+  condition_variable  taken;
+  /// Signal that an event was queued
+  condition_variable  queued;
+  /// Queue of events read ahead
+  deque<Event>        queue;
+  /// Exception of the reader thread to be reported to the consumer
+  exception_ptr       error;
+  /// Flag to stop the reader thread
+  bool                stop = false;
+  /// The reader thread
+  thread              worker;
+
+  /// Initializing constructor
+  Prefetcher(Geant4EventReader* rdr, int first, size_t num)
+    : reader(rdr), max_queue(num > 0 ? num : 1), next(first)
+  {
+    worker = thread([this]() { this->run(); });
+  }
+  /// Default destructor: stop the thread and release all events not consumed
+  ~Prefetcher()  {
+    {
+      lock_guard<mutex> guard(lock);
+      stop = true;
+    }
+    taken.notify_all();
+    worker.join();
+    for( auto& e : queue )  {
+      for_each(e.particles.begin(),e.particles.end(),detail::deleteObject<Particle>);
+      for_each(e.vertices.begin(),e.vertices.end(),detail::deleteObject<Vertex>);
+    }
+  }
+  /// Thread function: read events until stopped or the reader fails
+  void run()  {
+    for(;;)  {
+      {
+        unique_lock<mutex> guard(lock);
+        taken.wait(guard, [this]() { return stop || queue.size() < max_queue; });
+        if ( stop ) return;
+      }
+      Event evt { next, Geant4EventReader::EVENT_READER_ERROR, Vertices(), Particles() };
+      exception_ptr exc;
+      try  {
+        evt.status = reader->moveToEvent(evt.number);
+        if ( evt.status == Geant4EventReader::EVENT_READER_OK )
+          evt.status = reader->readParticles(evt.number, evt.vertices, evt.particles);
+      }
+      catch(...)  {
+        exc = current_exception();
+        evt.status = Geant4EventReader::EVENT_READER_ERROR;
+      }
+      bool last = evt.status != Geant4EventReader::EVENT_READER_OK;
+      {
+        lock_guard<mutex> guard(lock);
+        error = exc;
+        queue.emplace_back(move(evt));
+      }
+      queued.notify_all();
+      if ( last ) return;
+      ++next;
+    }
+  }
+  /// Take the next event from the queue. Waits until it was read
+  int read(int event_number, Vertices& vertices, Particles& particles)  {
+    unique_lock<mutex> guard(lock);
+    queued.wait(guard, [this]() { return !queue.empty(); });
+    Event& evt = queue.front();
+    if ( evt.status != Geant4EventReader::EVENT_READER_OK )  {
+      // Keep the failure for subsequent requests
+      if ( error ) rethrow_exception(error);
+      return evt.status;
+    }
+    else if ( evt.number != event_number )  {
+      dd4hep::except("Geant4InputAction","+++ Event %d requested, but event %d was read ahead. "
+             "Read-ahead requires sequential access.", event_number, evt.number);
+    }
+    vertices.insert(vertices.end(), evt.vertices.begin(), evt.vertices.end());
+    particles.insert(particles.end(), evt.particles.begin(), evt.particles.end());
+    queue.pop_front();
+    guard.unlock();
+    taken.notify_all();
+    return Geant4EventReader::EVENT_READER_OK;
+  }
+};
+
 /// Standard constructor
 Geant4InputAction::Geant4InputAction(Geant4Context* ctxt, const string& nam)
   : Geant4GeneratorAction(ctxt,nam), m_reader(0), m_currentEventNumber(0)
@@ -126,11 +246,13 @@ Geant4InputAction::Geant4InputAction(Geant4Context* ctxt, const string& nam)
   declareProperty("MomentumScale",  m_momScale = 1.0);
   declareProperty("HaveAbort",      m_abort = true);
   declareProperty("Parameters",     m_parameters = {});
+  declareProperty("Prefetch",       m_prefetch = 0);
   m_needsControl = true;
 }
 
 /// Default destructor
 Geant4InputAction::~Geant4InputAction()   {
+  m_prefetcher.reset();
 }
 
 /// helper to report Geant4 exceptions
@@ -173,29 +295,43 @@ int Geant4InputAction::readParticles(int evt_number,
       abortRun(issue(evid)+err,"Error when creating reader for file %s",m_input.c_str());
       return Geant4EventReader::EVENT_READER_NO_FACTORY;
     }
+    if ( m_prefetch > 0 && !m_reader->hasAsyncAccess() )  {
+      warning("+++ The reader %s does not support reading ahead. Property Prefetch ignored.",
+              tn.first.c_str());
+    }
   }
-  int status = m_reader->moveToEvent(evid);
-  if(status == Geant4EventReader::EVENT_READER_EOF ) {
-    long nEvents = context()->kernel().property("NumEvents").value<long>();
-    if(nEvents < 0) {
-      //context()->kernel().runManager().AbortRun(true);
-      throw DD4hep_End_Of_File();
+  int status = Geant4EventReader::EVENT_READER_OK;
+  if ( m_prefetch > 0 && m_reader->hasAsyncAccess() )  {
+    if ( !m_prefetcher )  {
+      m_prefetcher.reset(new Prefetcher(m_reader, evid, m_prefetch));
+      info("+++ Reading ahead %d events of %s", m_prefetch, m_input.c_str());
     }
+    status = m_prefetcher->read(evid, vertices, particles);
   }
+  else  {
+    status = m_reader->moveToEvent(evid);
+    if(status == Geant4EventReader::EVENT_READER_EOF ) {
+      long nEvents = context()->kernel().property("NumEvents").value<long>();
+      if(nEvents < 0) {
+        //context()->kernel().runManager().AbortRun(true);
+        throw DD4hep_End_Of_File();
+      }
+    }
 
-  if ( Geant4EventReader::EVENT_READER_OK != status )  {
-    string msg = issue(evid)+"Error when moving to event - ";
-    if ( status == Geant4EventReader::EVENT_READER_EOF ) msg += " EOF: [end of file].";
-    else msg += " Unknown error condition";
-    if ( m_abort )  {
-      abortRun(msg,"Error when reading file %s",m_input.c_str());
+    if ( Geant4EventReader::EVENT_READER_OK != status )  {
+      string msg = issue(evid)+"Error when moving to event - ";
+      if ( status == Geant4EventReader::EVENT_READER_EOF ) msg += " EOF: [end of file].";
+      else msg += " Unknown error condition";
+      if ( m_abort )  {
+        abortRun(msg,"Error when reading file %s",m_input.c_str());
+        return status;
+      }
+      error(msg.c_str());
+      except("Error when reading file %s.", m_input.c_str());
       return status;
     }
-    error(msg.c_str());
-    except("Error when reading file %s.", m_input.c_str());
-    return status;
+    status = m_reader->readParticles(evid, vertices, particles);
   }
-  status = m_reader->readParticles(evid, vertices, particles);
   if(status == Geant4EventReader::EVENT_READER_EOF ) {
     long nEvents = context()->kernel().property("NumEvents").value<long>();
     if(nEvents < 0) {
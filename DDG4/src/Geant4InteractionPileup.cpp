@@ -0,0 +1,274 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "DD4hep/Memory.h"
+#include "DD4hep/Plugins.h"
+#include "DD4hep/Printout.h"
+#include "DD4hep/Primitives.h"
+#include "DD4hep/InstanceCount.h"
+#include "DDG4/Geant4Random.h"
+#include "DDG4/Geant4Context.h"
+#include "DDG4/Geant4InputAction.h"
+#include "DDG4/Geant4InputHandling.h"
+#include "DDG4/Geant4InteractionPileup.h"
+
+// C/C++ include files
+#include <cmath>
+#include <mutex>
+#include <sstream>
+#include <algorithm>
+
+using namespace dd4hep::sim;
+
+/// Shared pool of pre-loaded pileup events
+/**
+ *  The pool is immutable once loaded. Events are handed out as deep copies,
+ *  because the merging of the interactions modifies particles and vertices.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_SIMULATION
+ */
+class Geant4InteractionPileup::Pool   {
+public:
+  typedef Geant4EventReader::Vertices  Vertices;
+  typedef Geant4EventReader::Particles Particles;
+  /// Pre-loaded event
+  struct Event  {
+    Vertices  vertices;
+    Particles particles;
+  };
+  /// The loaded events
+  std::vector<Event> events;
+  /// Approximate memory footprint of the loaded events in bytes
+  std::size_t        bytes = 0;
+
+public:
+  /// Default constructor
+  Pool() = default;
+  /// Inhibit copy constructor
+  Pool(const Pool& copy) = delete;
+  /// Default destructor
+  ~Pool()   {
+    for( Event& e : events )   {
+      std::for_each(e.particles.begin(), e.particles.end(), detail::deleteObject<Geant4Particle>);
+      std::for_each(e.vertices.begin(),  e.vertices.end(),  detail::deleteObject<Geant4Vertex>);
+    }
+  }
+  /// Approximate memory footprint of an event
+  static std::size_t footprint(const Event& e)   {
+    // Rough size of a node of a std::set<int>
+    const std::size_t node = 4*sizeof(void*) + sizeof(int);
+    std::size_t bytes = sizeof(Event);
+    for( const Geant4Particle* p : e.particles )
+      bytes += sizeof(Geant4Particle) + sizeof(p) + node*(p->parents.size()+p->daughters.size());
+    for( const Geant4Vertex* v : e.vertices )
+      bytes += sizeof(Geant4Vertex) + sizeof(v) + node*(v->in.size()+v->out.size());
+    return bytes;
+  }
+  /// Deep copy of a pooled particle
+  static Geant4Particle* copy(const Geant4Particle* p)   {
+    Geant4Particle* q = new Geant4Particle(p->id);
+    q->originalG4ID = p->originalG4ID;
+    q->g4Parent     = p->g4Parent;
+    q->reason       = p->reason;
+    q->mask         = p->mask;
+    q->steps        = p->steps;
+    q->secondaries  = p->secondaries;
+    q->pdgID        = p->pdgID;
+    q->status       = p->status;
+    q->genStatus    = p->genStatus;
+    q->charge       = p->charge;
+    std::copy(p->colorFlow, p->colorFlow+2, q->colorFlow);
+    std::copy(p->spin, p->spin+3, q->spin);
+    q->vsx = p->vsx;  q->vsy = p->vsy;  q->vsz = p->vsz;
+    q->vex = p->vex;  q->vey = p->vey;  q->vez = p->vez;
+    q->psx = p->psx;  q->psy = p->psy;  q->psz = p->psz;
+    q->pex = p->pex;  q->pey = p->pey;  q->pez = p->pez;
+    q->mass       = p->mass;
+    q->time       = p->time;
+    q->properTime = p->properTime;
+    q->parents    = p->parents;
+    q->daughters  = p->daughters;
+    q->process    = p->process;
+    return q;
+  }
+};
+
+namespace {
+  /// Registry of the loaded event pools. Access protected by the registry lock
+  std::map<std::string, std::weak_ptr<const Geant4InteractionPileup::Pool> > s_pools;
+  std::mutex s_poolLock;
+}
+
+/// Standard constructor
+Geant4InteractionPileup::Geant4InteractionPileup(Geant4Context* ctxt, const std::string& nam)
+  : Geant4GeneratorAction(ctxt,nam)
+{
+  InstanceCount::increment(this);
+  declareProperty("Input",       m_input);
+  declareProperty("Parameters",  m_parameters = {});
+  declareProperty("PoolSize",    m_poolSize = 100);
+  declareProperty("MaxMemory",   m_maxMemory = 0e0);
+  declareProperty("MeanPileup",  m_mean = 1e0);
+  declareProperty("Poisson",     m_poisson = true);
+  declareProperty("Mask",        m_mask = 100);
+  declareProperty("MomentumScale", m_momScale = 1e0);
+  declareProperty("Offset",      m_offset);
+  declareProperty("Sigma",       m_sigma);
+  m_needsControl = true;
+}
+
+/// Default destructor
+Geant4InteractionPileup::~Geant4InteractionPileup()  {
+  if ( m_pool )   {
+    std::lock_guard<std::mutex> lock(s_poolLock);
+    m_pool.reset();
+  }
+  InstanceCount::decrement(this);
+}
+
+/// Load the event pool according to the properties
+std::shared_ptr<const Geant4InteractionPileup::Pool> Geant4InteractionPileup::load()  const  {
+  typedef Geant4EventReader::Vertices  Vertices;
+  typedef Geant4EventReader::Particles Particles;
+  std::map<std::string, std::string> params = m_parameters;
+  TypeName tn = TypeName::split(m_input,"|");
+  std::unique_ptr<Geant4EventReader> reader(PluginService::Create<Geant4EventReader*>(tn.first,tn.second));
+
+  if ( !reader )   {
+    PluginDebug dbg;
+    reader.reset(PluginService::Create<Geant4EventReader*>(tn.first,tn.second));
+    except("+++ Failed to create file reader of type %s. Cannot open dataset %s",
+           tn.first.c_str(), tn.second.c_str());
+  }
+  else if ( !reader->hasAsyncAccess() )   {
+    except("+++ The reader %s depends on the event context and cannot fill a pileup pool.",
+           tn.first.c_str());
+  }
+  reader->setParameters(params);
+  reader->checkParameters(params);
+
+  std::shared_ptr<Pool> pool = std::make_shared<Pool>();
+  const std::size_t max_bytes = std::size_t(m_maxMemory * 1024e0 * 1024e0);
+  pool->events.reserve(m_poolSize);
+  for( int evid = 0; evid < m_poolSize; ++evid )   {
+    Pool::Event evt;
+    int status = reader->moveToEvent(evid);
+    if ( status == Geant4EventReader::EVENT_READER_OK )
+      status = reader->readParticles(evid, evt.vertices, evt.particles);
+    if ( status != Geant4EventReader::EVENT_READER_OK || evt.particles.empty() || evt.vertices.empty() )  {
+      std::for_each(evt.particles.begin(), evt.particles.end(), detail::deleteObject<Geant4Particle>);
+      std::for_each(evt.vertices.begin(),  evt.vertices.end(),  detail::deleteObject<Geant4Vertex>);
+      if ( status == Geant4EventReader::EVENT_READER_EOF ) break;
+      if ( status != Geant4EventReader::EVENT_READER_OK )  {
+        except("+++ Error %d when reading event %d from %s.", status, evid, m_input.c_str());
+      }
+      continue;
+    }
+    std::size_t bytes = Pool::footprint(evt);
+    if ( max_bytes > 0 && pool->bytes + bytes > max_bytes )  {
+      std::for_each(evt.particles.begin(), evt.particles.end(), detail::deleteObject<Geant4Particle>);
+      std::for_each(evt.vertices.begin(),  evt.vertices.end(),  detail::deleteObject<Geant4Vertex>);
+      info("+++ Memory budget of %.1f MB exhausted after %ld events.",
+           m_maxMemory, long(pool->events.size()));
+      break;
+    }
+    pool->bytes += bytes;
+    pool->events.emplace_back(std::move(evt));
+  }
+  if ( pool->events.empty() )   {
+    except("+++ No pileup events could be loaded from %s.", m_input.c_str());
+  }
+  info("+++ Loaded %ld pileup events (%.1f MB) from %s",
+       long(pool->events.size()), double(pool->bytes)/1024e0/1024e0, m_input.c_str());
+  return pool;
+}
+
+/// Access or load the event pool according to the properties
+std::shared_ptr<const Geant4InteractionPileup::Pool> Geant4InteractionPileup::pool()   {
+  if ( !m_pool )   {
+    std::stringstream key;
+    key << m_input << "|" << m_poolSize << "|" << m_maxMemory;
+    for( const auto& p : m_parameters )
+      key << "|" << p.first << "=" << p.second;
+    std::lock_guard<std::mutex> lock(s_poolLock);
+    std::weak_ptr<const Pool>& entry = s_pools[key.str()];
+    m_pool = entry.lock();
+    if ( !m_pool )   {
+      m_pool = load();
+      entry  = m_pool;
+    }
+  }
+  return m_pool;
+}
+
+/// Sample the number of pileup interactions for one event
+int Geant4InteractionPileup::multiplicity(Geant4Random& rndm)  const   {
+  if ( !m_poisson )   {
+    return int(std::lround(m_mean));
+  }
+  else if ( m_mean <= 0e0 )   {
+    return 0;
+  }
+  else if ( m_mean > 100e0 )   {
+    // Gaussian approximation: the product method below would underflow
+    return std::max(0, int(std::lround(rndm.gauss(m_mean, std::sqrt(m_mean)))));
+  }
+  const double limit = std::exp(-m_mean);
+  double prod = rndm.rndm();
+  int    num  = 0;
+  while ( prod > limit )   {
+    prod *= rndm.rndm();
+    ++num;
+  }
+  return num;
+}
+
+/// Event generation action callback
+void Geant4InteractionPileup::operator()(G4Event* /* event */)  {
+  typedef Geant4PrimaryEvent::Interaction Interaction;
+  std::shared_ptr<const Pool> events = pool();
+  Geant4Random&       rndm = context()->event().random();
+  Geant4PrimaryEvent* evt  = context()->event().extension<Geant4PrimaryEvent>();
+  const std::size_t   num_pool  = events->events.size();
+  const int           num_inter = multiplicity(rndm);
+
+  for( int i = 0; i < num_inter; ++i )   {
+    std::size_t which = std::min(num_pool-1, std::size_t(rndm.rndm()*double(num_pool)));
+    const Pool::Event& e = events->events[which];
+    Interaction* inter = new Interaction();
+    int mask = m_mask + i;
+    evt->add(mask, inter);
+    for( const Geant4Vertex* v : e.vertices )
+      inter->vertices[mask].emplace_back(new Geant4Vertex(*v));
+    for( const Geant4Particle* p : e.particles )   {
+      Geant4Particle* q = Pool::copy(p);
+      q->psx *= m_momScale;
+      q->psy *= m_momScale;
+      q->psz *= m_momScale;
+      inter->particles.emplace(q->id, q);
+    }
+
+    double dx = rndm.gauss(m_offset.x(), m_sigma.x());
+    double dy = rndm.gauss(m_offset.y(), m_sigma.y());
+    double dz = rndm.gauss(m_offset.z(), m_sigma.z());
+    double dt = rndm.gauss(m_offset.t(), m_sigma.t());
+    smearInteraction(this, inter, dx, dy, dz, dt);
+    print("+++ Pileup interaction %d from pool event %ld (%d particles) "
+          "at (%+.2e mm, %+.2e mm, %+.2e mm, %+.2e ns)",
+          mask, long(which), int(e.particles.size()), dx, dy, dz, dt);
+  }
+  debug("+++ Added %d pileup interactions from a pool of %ld events.", num_inter, long(num_pool));
+}
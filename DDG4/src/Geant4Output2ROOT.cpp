@@ -17,12 +17,15 @@
 #include "DD4hep/InstanceCount.h"
 #include "DDG4/Geant4HitCollection.h"
 #include "DDG4/Geant4Output2ROOT.h"
+#include "DDG4/Geant4OutputQueue.h"
 #include "DDG4/Geant4Particle.h"
 #include "DDG4/Geant4Data.h"
 // Geant4 include files
 #include "G4HCofThisEvent.hh"
+#include "G4Event.hh"
 
 // ROOT include files
+#include "TROOT.h"
 #include "TFile.h"
 #include "TTree.h"
 #include "TBranch.h"
@@ -31,6 +34,69 @@ using namespace dd4hep::sim;
 using namespace dd4hep;
 using namespace std;
 
+namespace {
+  /// Copy the persistent data of a MC particle
+  Geant4Particle* copy_particle(Geant4Particle* source)  {
+    Geant4Particle* p = new Geant4Particle();
+    p->get_data(*source);
+    // get_data moves the (non-persistent) extension: give it back
+    p->extension.swap(source->extension);
+    std::copy(source->spin, source->spin+3, p->spin);
+    std::copy(source->colorFlow, source->colorFlow+2, p->colorFlow);
+    return p;
+  }
+}
+
+/// Event data handed to the writer thread
+/**
+ *  The record owns the objects: they are deleted once the record was written.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_SIMULATION
+ */
+class Geant4Output2ROOT::Record  {
+public:
+  /// Data of one branch
+  struct Item  {
+    string                   name;
+    const ComponentCast*     vec_type;
+    ComponentCast::destroy_t destroy;
+    vector<void*>            objects;
+  };
+  /// Event identifier
+  int          eventID = 0;
+  /// Branch data of the event
+  vector<Item> items;
+  /// Default destructor
+  ~Record()  {
+    for( auto& i : items )
+      for( void* o : i.objects ) (*i.destroy)(o);
+  }
+  /// Add new branch data
+  vector<void*>& add(const string& nam, const ComponentCast& vec_type, const ComponentCast& obj_type)  {
+    items.emplace_back(Item{nam, &vec_type, obj_type.destroy, vector<void*>()});
+    return items.back().objects;
+  }
+};
+
+/// Writer thread of the ROOT output
+/**
+ *  Written records are deleted by the writer thread together with their objects.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_SIMULATION
+ */
+class Geant4Output2ROOT::Writer : public Geant4OutputQueue<Record>  {
+public:
+  /// Initializing constructor
+  Writer(Geant4Output2ROOT* out, size_t num)
+    : Geant4OutputQueue<Record>(out->name(), num, out->m_errorFatal, [out](Record& rec) { out->write(rec); })
+  {
+  }
+};
+
 /// Standard constructor
 Geant4Output2ROOT::Geant4Output2ROOT(Geant4Context* ctxt, const string& nam)
   : Geant4OutputAction(ctxt, nam), m_file(0), m_tree(0) {
@@ -38,12 +104,19 @@ Geant4Output2ROOT::Geant4Output2ROOT(Geant4Context* ctxt, const string& nam)
   declareProperty("HandleMCTruth", m_handleMCTruth = true);
   declareProperty("DisabledCollections",  m_disabledCollections);
   declareProperty("DisableParticles",     m_disableParticles);
+  declareProperty("WriterThread",         m_writerThread);
+  declareProperty("QueueSize",            m_queueSize);
+  declareProperty("BasketSize",           m_basketSize);
+  declareProperty("CompressionLevel",     m_compressionLevel);
+  declareProperty("AutoFlush",            m_autoFlush);
   InstanceCount::increment(this);
 }
 
 /// Default destructor
 Geant4Output2ROOT::~Geant4Output2ROOT() {
   InstanceCount::decrement(this);
+  m_record.reset();
+  m_writer.reset();
   if (m_file) {
     TDirectory::TContext ctxt(m_file);
     m_tree->Write();
@@ -74,7 +147,19 @@ void Geant4Output2ROOT::beginRun(const G4Run* run) {
       detail::deletePtr (m_file);
       throw runtime_error("Failed to open ROOT output file:'" + m_output + "'");
     }
+    if ( m_compressionLevel >= 0 )  {
+      m_file->SetCompressionLevel(m_compressionLevel);
+    }
     m_tree = section("EVENT");
+    if ( m_autoFlush != 0 )  {
+      m_tree->SetAutoFlush(m_autoFlush);
+    }
+    if ( m_writerThread )  {
+      ROOT::EnableThreadSafety();
+      m_writer.reset(new Writer(this, m_queueSize));
+      printout(INFO, name(), "+++ Writing events to %s from a writer thread [Queue size: %d]",
+               m_output.c_str(), m_queueSize);
+    }
   }
   Geant4OutputAction::beginRun(run);
 }
@@ -88,7 +173,7 @@ int Geant4Output2ROOT::fill(const string& nam, const ComponentCast& type, void*
       const std::type_info& typ = type.type();
       TClass* cl = TBuffer::GetClass(typ);
       if (cl) {
-        b = m_tree->Branch(nam.c_str(), cl->GetName(), (void*) 0);
+        b = m_tree->Branch(nam.c_str(), cl->GetName(), (void*) 0, m_basketSize);
         b->SetAutoDelete(false);
         m_branches.emplace(nam, b);
       }
@@ -117,8 +202,26 @@ int Geant4Output2ROOT::fill(const string& nam, const ComponentCast& type, void*
   return 0;
 }
 
+/// Write an event record handed over to the writer thread
+void Geant4Output2ROOT::write(Record& record)   {
+  for( auto& i : record.items )
+    fill(i.name, *i.vec_type, &i.objects);
+  commitEntry();
+}
+
 /// Commit data at end of filling procedure
 void Geant4Output2ROOT::commit(OutputContext<G4Event>& ctxt) {
+  if ( m_record )  {
+    m_writer->push(move(m_record));
+  }
+  else  {
+    commitEntry();
+  }
+  Geant4OutputAction::commit(ctxt);
+}
+
+/// Fill NULL pointers to all branches, which have less entries than the event and close the entry
+void Geant4Output2ROOT::commitEntry()   {
   if (m_file) {
     TObjArray* a = m_tree->GetListOfBranches();
     Long64_t evt = m_tree->GetEntries() + 1;
@@ -138,11 +241,28 @@ void Geant4Output2ROOT::commit(OutputContext<G4Event>& ctxt) {
     }
     m_tree->SetEntries(evt);
   }
-  Geant4OutputAction::commit(ctxt);
 }
 
 /// Callback to store the Geant4 event
-void Geant4Output2ROOT::saveEvent(OutputContext<G4Event>& /* ctxt */) {
+void Geant4Output2ROOT::saveEvent(OutputContext<G4Event>& ctxt) {
+  m_record.reset();
+  if ( m_writer )  {
+    // Hits owned by their collection cannot be handed to the writer thread:
+    // Write such events synchronously once all queued events are written.
+    G4HCofThisEvent* hce = ctxt.context->GetHCofThisEvent();
+    bool async = true;
+    for (int i = 0, n = hce ? hce->GetNumberOfCollections() : 0; i < n; ++i) {
+      Geant4HitCollection* coll = dynamic_cast<Geant4HitCollection*>(hce->GetHC(i));
+      if ( coll && !coll->canReleaseHits() ) async = false;
+    }
+    if ( async )  {
+      m_record.reset(new Record());
+      m_record->eventID = ctxt.context->GetEventID();
+    }
+    else  {
+      m_writer->drain();
+    }
+  }
   if ( !m_disableParticles )  {
     Geant4ParticleMap* parts = context()->event().extension<Geant4ParticleMap>();
     if ( parts )   {
@@ -150,6 +270,15 @@ void Geant4Output2ROOT::saveEvent(OutputContext<G4Event>& /* ctxt */) {
       typedef Geant4ParticleMap::ParticleMap ParticleMap;
       Manip* manipulator = Geant4HitWrapper::manipulator<Geant4Particle>();
       const ParticleMap& pm = parts->particles();
+      if ( m_record )  {
+        // The particle map is cleared at the end of the event: hand copies to the writer
+        vector<void*>& particles = m_record->add("MCParticles",manipulator->vec_type,manipulator->cast);
+        particles.reserve(pm.size());
+        for ( const auto& i : pm )   {
+          particles.emplace_back(copy_particle(i.second));
+        }
+        return;
+      }
       vector<void*> particles;
       particles.reserve(pm.size());
       for ( const auto& i : pm )   {
@@ -170,11 +299,8 @@ void Geant4Output2ROOT::saveCollection(OutputContext<G4Event>& /* ctxt */, G4VHi
     }
   }
   if (coll) {
-    vector<void*> hits;
-    coll->getHitsUnchecked(hits);
     size_t nhits = coll->GetSize();
     if ( m_handleMCTruth && m_truth && nhits > 0 )   {
-      hits.reserve(nhits);
       try  {
         for(size_t i=0; i<nhits; ++i)   {
           Geant4HitData* h = coll->hit(i);
@@ -199,6 +325,14 @@ void Geant4Output2ROOT::saveCollection(OutputContext<G4Event>& /* ctxt */, G4VHi
         printout(ERROR,name(),"+++ Exception while saving collection %s.",hc_nam.c_str());
       }
     }
+    if ( m_record )  {
+      // The writer thread takes over the hits. Leave an empty collection behind.
+      coll->releaseHitsUnchecked(m_record->add(hc_nam, coll->vector_type(), coll->type()));
+      coll->clear();
+      return;
+    }
+    vector<void*> hits;
+    coll->getHitsUnchecked(hits);
     fill(hc_nam, coll->vector_type(), &hits);
   }
 }
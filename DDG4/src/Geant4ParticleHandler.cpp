@@ -36,6 +36,7 @@
 
 // C/C++ include files
 #include <set>
+#include <chrono>
 #include <stdexcept>
 #include <algorithm>
 
@@ -113,9 +114,12 @@ bool Geant4ParticleHandler::adopt(Geant4Action* action)    {
 
 /// Clear particle maps
 void Geant4ParticleHandler::clear()  {
-  detail::releaseObjects(m_particleMap);
-  m_particleMap.clear();
-  m_equivalentTracks.clear();
+  m_tracks.clear();
+  for( Particle* p : m_particles )  {
+    if ( p ) p->release();
+  }
+  m_particles.clear();
+  m_equivalents.clear();
 }
 
 /// Mark a Geant4 track to be kept for later MC truth analysis
@@ -216,7 +220,7 @@ void Geant4ParticleHandler::begin(const G4Track* track)   {
       except("+++ Tracking preaction: Primary particle without generator particle!");
     }
     reason |= (G4PARTICLE_PRIMARY|G4PARTICLE_ABOVE_ENERGY_THRESHOLD);
-    m_particleMap[h.id()] = prim_part->addRef();
+    m_tracks.setParticle(h.id(), prim_part->addRef());
   }
 
   if ( prim_part )   {
@@ -336,15 +340,13 @@ void Geant4ParticleHandler::end(const G4Track* track)   {
   // - to be kept due to creator process
   //
   if ( !mask.isNull() )   {
-    m_equivalentTracks[g4_id] = g4_id;
-    ParticleMap::iterator ip = m_particleMap.find(g4_id);
+    m_tracks.setEquivalent(g4_id, g4_id);
+    Particle* part = m_tracks.particle(g4_id);
     if ( mask.isSet(G4PARTICLE_PRIMARY) )   {
-      ph.dump2(outputLevel()-1,name(),"Add Primary",h.id(),ip!=m_particleMap.end());
+      ph.dump2(outputLevel()-1,name(),"Add Primary",h.id(),part != 0);
     }
     // Create a new MC particle from the current track information saved in the pre-tracking action
-    Particle* part = 0;
-    if ( ip==m_particleMap.end() ) part = m_particleMap[g4_id] = new Particle();
-    else part = (*ip).second;
+    if ( !part ) part = m_tracks.newParticle(g4_id);
     part->get_data(m_currTrack);
   }
   else   {
@@ -352,20 +354,18 @@ void Geant4ParticleHandler::end(const G4Track* track)   {
     //
     // We will not store them on the record, but have to memorise the
     // track identifier in order to restore the history for the created hits.
-    int pid = m_currTrack.g4Parent;
-    m_equivalentTracks[g4_id] = pid;
     // Need to find the last stored particle and OR this particle's mask
     // with the mask of the last stored particle
-    auto iend = m_equivalentTracks.end(), iequiv=m_equivalentTracks.end();
-    ParticleMap::iterator ip;
-    for(ip=m_particleMap.find(pid); ip == m_particleMap.end(); ip=m_particleMap.find(pid))  {
-      if (iequiv=m_equivalentTracks.find(pid); iequiv == iend) break;  // ERROR
-      pid = (*iequiv).second;
+    int pid = m_tracks.stored(m_currTrack.g4Parent);
+    if ( pid != Geant4ParticleTable::INVALID )  {
+      // Refer directly to the stored particle: shortens the lookup for the daughters
+      m_tracks.setEquivalent(g4_id, pid);
+      m_tracks.particle(pid)->reason |= track_reason;
     }
-    if ( ip != m_particleMap.end() )
-      (*ip).second->reason |= track_reason;
-    else
+    else  {
+      m_tracks.setEquivalent(g4_id, m_currTrack.g4Parent);
       ph.dumpWithVertex(outputLevel()+3,name(),"FATAL: No real particle parent present");
+    }
   }
 }
 
@@ -375,8 +375,9 @@ void Geant4ParticleHandler::beginEvent(const G4Event* event)  {
   info("+++ Event %d Begin event action. Access event related information.",event->GetEventID());
   m_primaryMap = context()->event().extension<Geant4PrimaryMap>();
   m_globalParticleID = interaction->nextPID();
-  m_particleMap.clear();
-  m_equivalentTracks.clear();
+  m_tracks.reset();
+  m_particles.clear();
+  m_equivalents.clear();
   /// Call the user particle handler
   if ( m_userHandler )  {
     m_userHandler->begin(event);
@@ -387,18 +388,26 @@ void Geant4ParticleHandler::beginEvent(const G4Event* event)  {
 void Geant4ParticleHandler::dumpMap(const char* tag)  const  {
   const string& n = name();
   Geant4ParticleHandle::header4(INFO,n,tag);
-  for(ParticleMap::const_iterator iend=m_particleMap.end(), i=m_particleMap.begin(); i!=iend; ++i)  {
-    Geant4ParticleHandle((*i).second).dump4(INFO,n,tag);
+  // Before rebasing the particles are in the track table, afterwards in the final record
+  for(int i=0, num=m_tracks.size(); i<num; ++i)  {
+    if ( Particle* p = m_tracks.particle(i) )
+      Geant4ParticleHandle(p).dump4(INFO,n,tag);
+  }
+  for( Particle* p : m_particles )  {
+    if ( p ) Geant4ParticleHandle(p).dump4(INFO,n,tag);
   }
 }
 
 /// Post-event action callback
 void Geant4ParticleHandler::endEvent(const G4Event* event)  {
+  typedef std::chrono::steady_clock clock_t;
+  clock_t::time_point start = clock_t::now();
   int count = 0;
   int level = outputLevel();
+  int num_candidates = m_tracks.numParticles();
   do {
     if ( level <= VERBOSE ) dumpMap("Particle  ");
-    debug("+++ Iteration:%d Tracks:%d Equivalents:%d",++count,m_particleMap.size(),m_equivalentTracks.size());
+    debug("+++ Iteration:%d Tracks:%d Equivalents:%d",++count,m_tracks.numParticles(),m_tracks.size());
   } while( recombineParents() > 0 );
 
   if ( level <= VERBOSE ) dumpMap(  "Recombined");
@@ -414,28 +423,43 @@ void Geant4ParticleHandler::endEvent(const G4Event* event)  {
   setVertexEndpointBit();
 
   // Now export the data to the final record.
+  ParticleMap      particles;
+  TrackEquivalents equivalents;
+  for(size_t i=0; i<m_particles.size(); ++i)  {
+    if ( m_particles[i] ) particles.emplace_hint(particles.end(), int(i), m_particles[i]);
+  }
+  for(size_t i=0; i<m_equivalents.size(); ++i)  {
+    if ( m_equivalents[i] != Geant4ParticleTable::INVALID )
+      equivalents.emplace_hint(equivalents.end(), int(i), m_equivalents[i]);
+  }
   Geant4ParticleMap* part_map = context()->event().extension<Geant4ParticleMap>();
-  part_map->adopt(m_particleMap, m_equivalentTracks);
+  part_map->adopt(particles, equivalents);
+  m_particles.clear();
+  m_equivalents.clear();
   m_primaryMap = 0;
   clear();
+  debug("+++ Event %d: Reduced %d particle candidates to %ld particles in %d iterations [%.3f ms]",
+        event->GetEventID(), num_candidates, long(part_map->particleMap.size()), count,
+        std::chrono::duration<double,std::milli>(clock_t::now()-start).count());
 }
 
 /// Rebase the simulated tracks, so that they fit to the generator particles
 void Geant4ParticleHandler::rebaseSimulatedTracks(int )   {
   /// No we have to update the map of equivalent tracks and assign the 'equivalentTrack' entry
-  TrackEquivalents equivalents, orgParticles;
-  ParticleMap      finalParticles;
-  ParticleMap::const_iterator ipar, iend, i;
-  int count;
+  vector<Particle*>& finalParticles = m_particles;
+  vector<int>&       equivalents    = m_equivalents;
+  int count = 0, num_tracks = m_tracks.size();
 
   Geant4PrimaryInteraction* interaction = context()->event().extension<Geant4PrimaryInteraction>();
   ParticleMap& pm = interaction->particles;
 
   // (1.0) Copy the pre-defined particle mapping for the simulated tracks
   //       It is assumed the mapping is ZERO based without holes.
-  for(count = 0, iend=pm.end(), i=pm.begin(); i!=iend; ++i)  {
-    Particle* p = (*i).second;
-    orgParticles[p->id] = p->id;
+  finalParticles.clear();
+  finalParticles.reserve(pm.size() + m_tracks.numParticles() + 1);
+  for(const auto& i : pm)  {
+    Particle* p = i.second;
+    if ( p->id >= int(finalParticles.size()) ) finalParticles.resize(p->id+1, nullptr);
     finalParticles[p->id] = p;
     if ( p->id > count ) count = p->id;
     if ( (p->reason&G4PARTICLE_PRIMARY) != G4PARTICLE_PRIMARY )  {
@@ -443,37 +467,64 @@ void Geant4ParticleHandler::rebaseSimulatedTracks(int )   {
     }
   }
   // (1.1) Define the new particle mapping for the simulated tracks
-  for(++count, iend=m_particleMap.end(), i=m_particleMap.begin(); i!=iend; ++i)  {
-    Particle* p = (*i).second;
-    if ( (p->reason&G4PARTICLE_PRIMARY) != G4PARTICLE_PRIMARY )  {
-      //if ( orgParticles.find(p->id) == orgParticles.end() )  {
-      orgParticles[p->id] = count;
-      finalParticles[count] = p;
+  finalParticles.resize(++count, nullptr);
+  for(int g4_id = 0; g4_id < num_tracks; ++g4_id)  {
+    Particle* p = m_tracks.particle(g4_id);
+    if ( p && (p->reason&G4PARTICLE_PRIMARY) != G4PARTICLE_PRIMARY )  {
+      finalParticles.emplace_back(p);
       p->id = count;
       ++count;
     }
   }
   // (2) Re-evaluate the corresponding geant4 track equivalents using the new mapping
-  for(TrackEquivalents::iterator ie=m_equivalentTracks.begin(),ie_end=m_equivalentTracks.end(); ie!=ie_end; ++ie)  {
-    int g4_equiv = (*ie).first;
-    while( (ipar=m_particleMap.find(g4_equiv)) == m_particleMap.end() )  {
-      TrackEquivalents::const_iterator iequiv = m_equivalentTracks.find(g4_equiv);
-      if ( iequiv == ie_end )  {
-        break;  // ERROR !! Will be handled by printout below because ipar==end()
+  //     The equivalent of a track always has a smaller identifier: the search
+  //     stops at the first track with a known result.
+  vector<int>  holders(num_tracks, Geant4ParticleTable::INVALID);
+  vector<char> checked(finalParticles.size(), 0);
+  equivalents.assign(num_tracks, Geant4ParticleTable::INVALID);
+  for(int g4_id = 0; g4_id < num_tracks; ++g4_id)  {
+    int equiv = m_tracks.equivalent(g4_id);
+    if ( equiv == Geant4ParticleTable::INVALID )  {
+      continue;  // Not a Geant4 track of this event
+    }
+    int g4_equiv = g4_id;
+    Particle* part = nullptr;
+    while( !(part=m_tracks.particle(g4_equiv)) )  {
+      int next = m_tracks.equivalent(g4_equiv);
+      if ( next == Geant4ParticleTable::INVALID || next == g4_equiv )  {
+        break;  // ERROR !! Will be handled by printout below because part==0
+      }
+      if ( next < g4_id && holders[next] != Geant4ParticleTable::INVALID )  {
+        g4_equiv = holders[next];
+        part = m_tracks.particle(g4_equiv);
+        break;
       }
-      g4_equiv = (*iequiv).second;
+      g4_equiv = next;
     }
-    TrackEquivalents::mapped_type equiv = (*ie).second;
-    if ( ipar != m_particleMap.end() )   {
-      Geant4ParticleHandle p = (*ipar).second;
-      equivalents[(*ie).first] = p->id;  // requires (1) to be filled properly!
-      const G4ParticleDefinition* def = p.definition();
-      int pdg = int(fabs(def->GetPDGEncoding())+0.1);
-      if ( pdg != 0 && pdg<36 && !(pdg > 10 && pdg < 17) && pdg != 22 )  {
+    if ( part )   {
+      Geant4ParticleHandle p = part;
+      holders[g4_id] = g4_equiv;
+      equivalents[g4_id] = p->id;  // requires (1) to be filled properly!
+      // The check for quarks and gluons needs the particle definition (expensive!):
+      // Evaluate it only once per particle
+      if ( size_t(p->id) >= checked.size() ) checked.resize(p->id+1, 0);
+      char& check = checked[p->id];
+      if ( !check )  {
+        const G4ParticleDefinition* def = p.definition();
+        int pdg = def ? int(fabs(def->GetPDGEncoding())+0.1) : 0;
+        check = 1;
+        if ( pdg != 0 && pdg<36 && !(pdg > 10 && pdg < 17) && pdg != 22 )  {
+          check |= 2;
+        }
+        pdg = int(fabs(p->pdgID)+0.1);
+        if ( pdg != 0 && pdg<36 && !(pdg > 10 && pdg < 17) && pdg != 22 )  {
+          check |= 4;
+        }
+      }
+      if ( check&2 )  {
         error("+++ ERROR: Geant4 particle for track:%d last known is:%d -- is gluon or quark!",equiv,g4_equiv);
       }
-      pdg = int(fabs(p->pdgID)+0.1);
-      if ( pdg != 0 && pdg<36 && !(pdg > 10 && pdg < 17) && pdg != 22 )  {
+      if ( check&4 )  {
         error("+++ ERROR(2): Geant4 particle for track:%d last known is:%d -- is gluon or quark!",equiv,g4_equiv);
       }
     }
@@ -488,16 +539,12 @@ void Geant4ParticleHandler::rebaseSimulatedTracks(int )   {
   // Note:
   //     We rely here on the ordering of the particles accoding to their
   //     Processing by Geant4 to establish mother daughter relationships.
-  //     == > use finalParticles map and NOT m_particleMap.
-  int equiv_id = -1;
-  for(iend=finalParticles.end(), i=finalParticles.begin(); i!=iend; ++i)  {
-    Particle* p = (*i).second;
-    if ( p->g4Parent > 0 )  {
-      TrackEquivalents::iterator iequ = equivalents.find(p->g4Parent);
-      if ( iequ != equivalents.end() )  {
-        equiv_id = (*iequ).second;//equivalents[p->g4Parent];
-        if ( (ipar=finalParticles.find(equiv_id)) != finalParticles.end() )  {
-          Particle* q = (*ipar).second;
+  //     == > use finalParticles and NOT the track table.
+  for( Particle* p : finalParticles )  {
+    if ( p && p->g4Parent > 0 )  {
+      int equiv_id = p->g4Parent < num_tracks ? equivalents[p->g4Parent] : int(Geant4ParticleTable::INVALID);
+      if ( equiv_id != Geant4ParticleTable::INVALID && equiv_id < int(finalParticles.size()) )  {
+        if ( Particle* q = finalParticles[equiv_id] )  {
           bool      prim = (p->reason&G4PARTICLE_PRIMARY) == G4PARTICLE_PRIMARY;
           // We assume that the mother daughter relationship
           // is filled by the event readers!
@@ -506,8 +553,9 @@ void Geant4ParticleHandler::rebaseSimulatedTracks(int )   {
           }
           if ( !p->parents.empty() )  {
             int parent_id = (*p->parents.begin());
+            // Daughters are added with increasing identifiers: append
             if ( parent_id == q->id )
-              q->daughters.insert(p->id);
+              q->daughters.emplace_hint(q->daughters.end(), p->id);
             else if ( !prim )
               error("+++ Inconsistency in equivalent record! Parent: %d Daughter:%d",q->id, p->id);
           }
@@ -522,30 +570,8 @@ void Geant4ParticleHandler::rebaseSimulatedTracks(int )   {
             p->g4Parent,p->id);
     }
   }
-#if 0
-  for(iend=finalParticles.end(), i=finalParticles.begin(); i!=iend; ++i)  {
-    Particle* p = (*i).second;
-    if ( p->g4Parent > 0 )  {
-      int parent_id = (*p->parents.begin());
-      if ( (ipar=finalParticles.find(parent_id)) != finalParticles.end() )  {
-        Particle* q = (*ipar).second;
-        // Generator particles have a proper history.
-        // We only deal with particles, which are not of MC origin.
-        //p->parents.insert(q->id);
-        if ( parent_id == q->id )
-          q->daughters.insert(p->id);
-        else
-          error("+++ Inconsistency in equivalent record! Parent: %d Daughter:%d",q->id, p->id);
-        continue;
-      }
-      error("+++ Inconsistency in particle record: Geant4 parent %d "
-            "of particle %d not in record of final particles!",
-            p->g4Parent,p->id);
-    }
-  }
-#endif
-  m_equivalentTracks = equivalents;
-  m_particleMap = finalParticles;
+  // All particles of the track table are now owned by the final record
+  m_tracks.reset();
 }
 
 /// Default callback to be answered if the particle should be kept if NO user handler is installed
@@ -578,11 +604,12 @@ bool Geant4ParticleHandler::defaultKeepParticle(Particle& particle)   {
 /// Clean the monte carlo record. Remove all unwanted stuff.
 /// This is the core of the object executed at the end of each event action.
 int Geant4ParticleHandler::recombineParents()  {
-  set<int> remove;
+  vector<int> remove;
 
   /// Need to start from BACK, to clean first the latest produced stuff.
-  for(ParticleMap::reverse_iterator i=m_particleMap.rbegin(); i!=m_particleMap.rend(); ++i)  {
-    Particle* p = (*i).second;
+  for(int g4_id = m_tracks.size()-1; g4_id >= 0; --g4_id)  {
+    Particle* p = m_tracks.particle(g4_id);
+    if ( !p ) continue;
     PropertyMask mask(p->reason);
     // Allow the user to force the particle handling either by
     // or the reason mask with G4PARTICLE_KEEP_USER or
@@ -614,8 +641,7 @@ int Geant4ParticleHandler::recombineParents()  {
       //continue;
     }
     else if ( mask.isSet(G4PARTICLE_KEEP_PROCESS) )  {
-      if(ParticleMap::iterator ip = m_particleMap.find(p->g4Parent); ip != m_particleMap.end() )   {
-        Particle* parent_part = (*ip).second;
+      if( Particle* parent_part = m_tracks.particle(p->g4Parent) )   {
         PropertyMask parent_mask(parent_part->reason);
         if ( parent_mask.isSet(G4PARTICLE_ABOVE_ENERGY_THRESHOLD) )   {
           parent_mask.set(G4PARTICLE_KEEP_PARENT);
@@ -628,11 +654,9 @@ int Geant4ParticleHandler::recombineParents()  {
 
     /// Remove this track from the list and also do the cleanup in the parent's children list
     if ( remove_me )  {
-      int g4_id = (*i).first;
-      remove.insert(g4_id);
-      m_equivalentTracks[g4_id] = p->g4Parent;
-      if(ParticleMap::iterator ip = m_particleMap.find(p->g4Parent); ip != m_particleMap.end() )   {
-        Particle* parent_part = (*ip).second;
+      remove.emplace_back(g4_id);
+      m_tracks.setEquivalent(g4_id, p->g4Parent);
+      if( Particle* parent_part = m_tracks.particle(p->g4Parent) )   {
         PropertyMask(parent_part->reason).set(mask.value());
         parent_part->steps += p->steps;
         parent_part->secondaries += p->secondaries;
@@ -644,10 +668,7 @@ int Geant4ParticleHandler::recombineParents()  {
     }
   }
   for( int r : remove )  {
-    if( auto ir = m_particleMap.find(r); ir != m_particleMap.end() )  {
-      (*ir).second->release();
-      m_particleMap.erase(ir);
-    }
+    m_tracks.dropParticle(r);
   }
   return int(remove.size());
 }
@@ -655,17 +676,20 @@ int Geant4ParticleHandler::recombineParents()  {
 /// Check the record consistency
 void Geant4ParticleHandler::checkConsistency()  const   {
   int num_errors = 0;
+  auto in_record = [this](int id)  {
+    return size_t(id) < m_particles.size() && m_particles[id] != nullptr;
+  };
 
   /// First check the consistency of the particle map itself
-  for(const auto [idx, particle] : m_particleMap )  {
+  for( Particle* particle : m_particles )  {
+    if ( !particle ) continue;
     Geant4ParticleHandle p(particle);
     PropertyMask mask(p->reason);
     PropertyMask status(p->status);
     set<int>& daughters = p->daughters;
-    ParticleMap::const_iterator j;
     // For all particles, the set of daughters must be contained in the record.
     for( int id_dau : daughters )   {
-      if ( j=m_particleMap.find(id_dau); j == m_particleMap.end() )   {
+      if ( !in_record(id_dau) )   {
         ++num_errors;
         error("+++ Particle:%d Daughter %d is not in particle map!",p->id,id_dau);
       }
@@ -675,9 +699,9 @@ void Geant4ParticleHandler::checkConsistency()  const   {
     if ( !mask.isSet(G4PARTICLE_PRIMARY) && !status.anySet(G4PARTICLE_GEN_STATUS) )  {
       bool in_map = false, in_parent_list = false;
       int  parent_id = -1;
-      if( auto eq_it=m_equivalentTracks.find(p->g4Parent); eq_it != m_equivalentTracks.end() )   {
-        parent_id = (*eq_it).second;
-        in_map    = (j=m_particleMap.find(parent_id)) != m_particleMap.end();
+      if( size_t(p->g4Parent) < m_equivalents.size() && m_equivalents[p->g4Parent] != Geant4ParticleTable::INVALID )   {
+        parent_id = m_equivalents[p->g4Parent];
+        in_map    = in_record(parent_id);
         in_parent_list = p->parents.find(parent_id) != p->parents.end();
       }
       if ( !in_map || !in_parent_list )  {
@@ -700,15 +724,16 @@ void Geant4ParticleHandler::checkConsistency()  const   {
 
 void Geant4ParticleHandler::setVertexEndpointBit() {
 
-  ParticleMap& pm = m_particleMap;
-  ParticleMap::const_iterator iend, i;
-  for(iend=pm.end(), i=pm.begin(); i!=iend; ++i)  {
-    Particle* p = (*i).second;
-
-    if( p->parents.empty() ) {
+  const vector<Particle*>& pm = m_particles;
+  for( Particle* p : pm )  {
+    if( !p || p->parents.empty() ) {
+      continue;
+    }
+    int parent_id = *p->parents.begin();
+    Geant4Particle *parent( size_t(parent_id) < pm.size() ? pm[parent_id] : nullptr );
+    if( !parent ) {
       continue;
     }
-    Geant4Particle *parent(pm[ *p->parents.begin() ]);
     const double X( parent->vex - p->vsx );
     const double Y( parent->vey - p->vsy );
     const double Z( parent->vez - p->vsz );
@@ -0,0 +1,76 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "DDG4/Geant4ParticleTable.h"
+
+// C/C++ include files
+#include <algorithm>
+
+using namespace dd4hep::sim;
+
+/// Default destructor
+Geant4ParticleTable::~Geant4ParticleTable()   {
+  clear();
+  for( Particle* p : m_pool ) p->release();
+  m_pool.clear();
+}
+
+/// Release all particles and reset the table. The allocated memory is kept
+void Geant4ParticleTable::clear()   {
+  for( int i = 0; i <= m_maxID; ++i )   {
+    if ( m_tracks[i].particle ) m_tracks[i].particle->release();
+  }
+  reset();
+}
+
+/// Reset the table without releasing the particles (ownership was passed on)
+void Geant4ParticleTable::reset()   {
+  std::fill(m_tracks.begin(), m_tracks.begin()+(m_maxID+1), Entry());
+  m_maxID = INVALID;
+  m_numParticles = 0;
+}
+
+/// Create a new particle candidate for a track. Pooled objects are reused
+Geant4Particle* Geant4ParticleTable::newParticle(int g4_id)   {
+  Particle* p = nullptr;
+  if ( m_pool.empty() )   {
+    p = new Particle();
+  }
+  else  {
+    p = m_pool.back();
+    m_pool.pop_back();
+  }
+  setParticle(g4_id, p);
+  return p;
+}
+
+/// Remove the particle candidate of a track from the table
+void Geant4ParticleTable::dropParticle(int g4_id)   {
+  Particle* p = particle(g4_id);
+  if ( p )   {
+    m_tracks[g4_id].particle = nullptr;
+    --m_numParticles;
+    // Only keep objects nobody else refers to
+    if ( p->ref > 1 )   {
+      p->release();
+      return;
+    }
+    p->parents.clear();
+    p->daughters.clear();
+    p->extension.reset();
+    std::fill(p->spin, p->spin+3, 0e0);
+    std::fill(p->colorFlow, p->colorFlow+2, 0);
+    m_pool.emplace_back(p);
+  }
+}
@@ -107,6 +107,7 @@ Geant4Sensitive::Geant4Sensitive(Geant4Context* ctxt, const string& nam, DetElem
     throw runtime_error(format("Geant4Sensitive", "DDG4: Detector elemnt for %s is invalid.", nam.c_str()));
   }
   declareProperty("HitCreationMode", m_hitCreationMode = SIMPLE_MODE);
+  declareProperty("CollectionOptimization", m_collectionOptimization = Geant4HitCollection::OPTIMIZE_NONE);
   m_sequence  = context()->kernel().sensitiveAction(m_detector.name());
   m_sensitive = description_ref.sensitiveDetector(det.name());
   m_readout   = m_sensitive.readout();
@@ -438,6 +439,8 @@ void Geant4SensDetActionSequence::begin(G4HCofThisEvent* hce) {
   for (size_t count = 0; count < m_collections.size(); ++count) {
     const HitCollection& cr = m_collections[count];
     Geant4HitCollection* col = (*cr.second.second)(name(), cr.first, cr.second.first);
+    if ( cr.second.first && cr.second.first->collectionOptimization() )
+      col->setOptimize(cr.second.first->collectionOptimization());
     int id = m_detector->GetCollectionID(count);
     m_hce->AddHitsCollection(id, col);
   }
@@ -58,6 +58,12 @@ namespace dd4hep {
 
     static const double CM_2_MM = (CLHEP::centimeter/dd4hep::centimeter);
 
+    /// Lock serializing the registration of Geant4 solids in the G4SolidStore
+    dd4hep_mutex_t& solidStoreLock()   {
+      static dd4hep_mutex_t s_lock;
+      return s_lock;
+    }
+
     /// Convert a specific TGeo shape into the geant4 equivalent
     template <typename T> G4VSolid* convertShape(const TGeoShape* shape)    {
       if ( shape )   {
@@ -73,18 +79,18 @@ namespace dd4hep {
 
     template <> G4VSolid* convertShape<TGeoBBox>(const TGeoShape* shape)  {
       const TGeoBBox* sh = (const TGeoBBox*) shape;
-      return new G4Box(sh->GetName(), sh->GetDX() * CM_2_MM, sh->GetDY() * CM_2_MM, sh->GetDZ() * CM_2_MM);
+      return createSolid<G4Box>(sh->GetName(), sh->GetDX() * CM_2_MM, sh->GetDY() * CM_2_MM, sh->GetDZ() * CM_2_MM);
     }
 
     template <> G4VSolid* convertShape<TGeoTube>(const TGeoShape* shape)  {
       const TGeoTube* sh = (const TGeoTube*) shape;
-      return new G4Tubs(sh->GetName(), sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM, sh->GetDz() * CM_2_MM, 0, 2. * M_PI);
+      return createSolid<G4Tubs>(sh->GetName(), sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM, sh->GetDz() * CM_2_MM, 0, 2. * M_PI);
     }
 
     template <> G4VSolid* convertShape<TGeoTubeSeg>(const TGeoShape* shape)  {
       const TGeoTubeSeg* sh = (const TGeoTubeSeg*) shape;
-      return new G4Tubs(sh->GetName(), sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM, sh->GetDz() * CM_2_MM,
-                        sh->GetPhi1() * DEGREE_2_RAD, (sh->GetPhi2()-sh->GetPhi1()) * DEGREE_2_RAD);
+      return createSolid<G4Tubs>(sh->GetName(), sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM, sh->GetDz() * CM_2_MM,
+                                 sh->GetPhi1() * DEGREE_2_RAD, (sh->GetPhi2()-sh->GetPhi1()) * DEGREE_2_RAD);
     }
 
     template <> G4VSolid* convertShape<TGeoCtub>(const TGeoShape* shape)  {
@@ -93,45 +99,45 @@ namespace dd4hep {
       const Double_t* hn = sh->GetNhigh();
       G4ThreeVector   lowNorm (ln[0], ln[1], ln[2]);
       G4ThreeVector   highNorm(hn[0], hn[1], hn[2]);
-      return new G4CutTubs(sh->GetName(),
-                           sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM, sh->GetDz() * CM_2_MM,
-                           sh->GetPhi1() * DEGREE_2_RAD, (sh->GetPhi2()-sh->GetPhi1()) * DEGREE_2_RAD, lowNorm, highNorm);
+      return createSolid<G4CutTubs>(sh->GetName(),
+                                    sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM, sh->GetDz() * CM_2_MM,
+                                    sh->GetPhi1() * DEGREE_2_RAD, (sh->GetPhi2()-sh->GetPhi1()) * DEGREE_2_RAD, lowNorm, highNorm);
     }
 
     template <> G4VSolid* convertShape<TGeoEltu>(const TGeoShape* shape)  {
       const TGeoEltu* sh = (const TGeoEltu*) shape;
-      return new G4EllipticalTube(sh->GetName(),sh->GetA() * CM_2_MM, sh->GetB() * CM_2_MM, sh->GetDz() * CM_2_MM);
+      return createSolid<G4EllipticalTube>(sh->GetName(),sh->GetA() * CM_2_MM, sh->GetB() * CM_2_MM, sh->GetDz() * CM_2_MM);
     }
 
     template <> G4VSolid* convertShape<TwistedTubeObject>(const TGeoShape* shape)  {
       const TwistedTubeObject* sh = (const TwistedTubeObject*) shape;
-      return new G4TwistedTubs(sh->GetName(),sh->GetPhiTwist() * DEGREE_2_RAD,
-                               sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM,
-                               sh->GetNegativeEndZ() * CM_2_MM, sh->GetPositiveEndZ() * CM_2_MM,
-                               sh->GetNsegments(), (sh->GetPhi2()-sh->GetPhi1()) * DEGREE_2_RAD);
+      return createSolid<G4TwistedTubs>(sh->GetName(),sh->GetPhiTwist() * DEGREE_2_RAD,
+                                        sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM,
+                                        sh->GetNegativeEndZ() * CM_2_MM, sh->GetPositiveEndZ() * CM_2_MM,
+                                        sh->GetNsegments(), (sh->GetPhi2()-sh->GetPhi1()) * DEGREE_2_RAD);
     }
 
     template <> G4VSolid* convertShape<TGeoTrd1>(const TGeoShape* shape)  {
       const TGeoTrd1* sh = (const TGeoTrd1*) shape;
-      return new G4Trd(sh->GetName(),
-                       sh->GetDx1() * CM_2_MM, sh->GetDx2() * CM_2_MM,
-                       sh->GetDy() * CM_2_MM, sh->GetDy() * CM_2_MM,
-                       sh->GetDz() * CM_2_MM);
+      return createSolid<G4Trd>(sh->GetName(),
+                                sh->GetDx1() * CM_2_MM, sh->GetDx2() * CM_2_MM,
+                                sh->GetDy() * CM_2_MM, sh->GetDy() * CM_2_MM,
+                                sh->GetDz() * CM_2_MM);
     }
 
     template <> G4VSolid* convertShape<TGeoTrd2>(const TGeoShape* shape)  {
       const TGeoTrd2* sh = (const TGeoTrd2*) shape;
-      return new G4Trd(sh->GetName(),
-                       sh->GetDx1() * CM_2_MM, sh->GetDx2() * CM_2_MM,
-                       sh->GetDy1() * CM_2_MM, sh->GetDy2() * CM_2_MM,
-                       sh->GetDz() * CM_2_MM);
+      return createSolid<G4Trd>(sh->GetName(),
+                                sh->GetDx1() * CM_2_MM, sh->GetDx2() * CM_2_MM,
+                                sh->GetDy1() * CM_2_MM, sh->GetDy2() * CM_2_MM,
+                                sh->GetDz() * CM_2_MM);
     }
 
     template <> G4VSolid* convertShape<TGeoHype>(const TGeoShape* shape)  {
       const TGeoHype* sh = (const TGeoHype*) shape;
-      return new G4Hype(sh->GetName(), sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM,
-                        sh->GetStIn() * DEGREE_2_RAD, sh->GetStOut() * DEGREE_2_RAD,
-                        sh->GetDz() * CM_2_MM);
+      return createSolid<G4Hype>(sh->GetName(), sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM,
+                                 sh->GetStIn() * DEGREE_2_RAD, sh->GetStOut() * DEGREE_2_RAD,
+                                 sh->GetDz() * CM_2_MM);
     }
 
     template <> G4VSolid* convertShape<TGeoArb8>(const TGeoShape* shape)  {
@@ -140,7 +146,7 @@ namespace dd4hep {
       Double_t* vtx_xy = sh->GetVertices();
       for ( size_t i=0; i<8; ++i, vtx_xy +=2 )
         vertices.emplace_back(vtx_xy[0] * CM_2_MM, vtx_xy[1] * CM_2_MM);
-      return new G4GenericTrap(sh->GetName(), sh->GetDz() * CM_2_MM, vertices);
+      return createSolid<G4GenericTrap>(sh->GetName(), sh->GetDz() * CM_2_MM, vertices);
     }
 
     template <> G4VSolid* convertShape<TGeoXtru>(const TGeoShape* shape)  {
@@ -154,7 +160,7 @@ namespace dd4hep {
         z.emplace_back(G4ExtrudedSolid::ZSection(sh->GetZ(i) * CM_2_MM, {sh->GetXOffset(i), sh->GetYOffset(i)}, sh->GetScale(i)));
         polygon.emplace_back(sh->GetX(i) * CM_2_MM,sh->GetY(i) * CM_2_MM);
       }
-      return new G4ExtrudedSolid(sh->GetName(), polygon, z);
+      return createSolid<G4ExtrudedSolid>(sh->GetName(), polygon, z);
     }
 
     template <> G4VSolid* convertShape<TGeoPgon>(const TGeoShape* shape)  {
@@ -165,8 +171,8 @@ namespace dd4hep {
         rmax.emplace_back(sh->GetRmax(i) * CM_2_MM);
         z.emplace_back(sh->GetZ(i) * CM_2_MM);
       }
-      return new G4Polyhedra(sh->GetName(), sh->GetPhi1() * DEGREE_2_RAD, sh->GetDphi() * DEGREE_2_RAD,
-                             sh->GetNedges(), sh->GetNz(), &z[0], &rmin[0], &rmax[0]);
+      return createSolid<G4Polyhedra>(sh->GetName(), sh->GetPhi1() * DEGREE_2_RAD, sh->GetDphi() * DEGREE_2_RAD,
+                                      sh->GetNedges(), sh->GetNz(), &z[0], &rmin[0], &rmax[0]);
     }
 
     template <> G4VSolid* convertShape<TGeoPcon>(const TGeoShape* shape)  {
@@ -177,46 +183,46 @@ namespace dd4hep {
         rmax.emplace_back(sh->GetRmax(i) * CM_2_MM);
         z.emplace_back(sh->GetZ(i) * CM_2_MM);
       }
-      return new G4Polycone(sh->GetName(), sh->GetPhi1() * DEGREE_2_RAD, sh->GetDphi() * DEGREE_2_RAD,
-                            sh->GetNz(), &z[0], &rmin[0], &rmax[0]);
+      return createSolid<G4Polycone>(sh->GetName(), sh->GetPhi1() * DEGREE_2_RAD, sh->GetDphi() * DEGREE_2_RAD,
+                                     sh->GetNz(), &z[0], &rmin[0], &rmax[0]);
     }
 
     template <> G4VSolid* convertShape<TGeoCone>(const TGeoShape* shape)  {
       const TGeoCone* sh = (const TGeoCone*) shape;
-      return new G4Cons(sh->GetName(), sh->GetRmin1() * CM_2_MM, sh->GetRmax1() * CM_2_MM, sh->GetRmin2() * CM_2_MM,
-                        sh->GetRmax2() * CM_2_MM, sh->GetDz() * CM_2_MM, 0.0, 2.*M_PI);
+      return createSolid<G4Cons>(sh->GetName(), sh->GetRmin1() * CM_2_MM, sh->GetRmax1() * CM_2_MM, sh->GetRmin2() * CM_2_MM,
+                                 sh->GetRmax2() * CM_2_MM, sh->GetDz() * CM_2_MM, 0.0, 2.*M_PI);
     }
 
     template <> G4VSolid* convertShape<TGeoConeSeg>(const TGeoShape* shape)  {
       const TGeoConeSeg* sh = (const TGeoConeSeg*) shape;
-      return new G4Cons(sh->GetName(), sh->GetRmin1() * CM_2_MM, sh->GetRmax1() * CM_2_MM,
-                        sh->GetRmin2() * CM_2_MM, sh->GetRmax2() * CM_2_MM,
-                        sh->GetDz() * CM_2_MM,
-                        sh->GetPhi1() * DEGREE_2_RAD, (sh->GetPhi2()-sh->GetPhi1()) * DEGREE_2_RAD);
+      return createSolid<G4Cons>(sh->GetName(), sh->GetRmin1() * CM_2_MM, sh->GetRmax1() * CM_2_MM,
+                                 sh->GetRmin2() * CM_2_MM, sh->GetRmax2() * CM_2_MM,
+                                 sh->GetDz() * CM_2_MM,
+                                 sh->GetPhi1() * DEGREE_2_RAD, (sh->GetPhi2()-sh->GetPhi1()) * DEGREE_2_RAD);
     }
 
     template <> G4VSolid* convertShape<TGeoParaboloid>(const TGeoShape* shape)  {
       const TGeoParaboloid* sh = (const TGeoParaboloid*) shape;
-      return new G4Paraboloid(sh->GetName(), sh->GetDz() * CM_2_MM, sh->GetRlo() * CM_2_MM, sh->GetRhi() * CM_2_MM);
+      return createSolid<G4Paraboloid>(sh->GetName(), sh->GetDz() * CM_2_MM, sh->GetRlo() * CM_2_MM, sh->GetRhi() * CM_2_MM);
     }
 
     template <> G4VSolid* convertShape<TGeoSphere>(const TGeoShape* shape)  {
       const TGeoSphere* sh = (const TGeoSphere*) shape;
-      return new G4Sphere(sh->GetName(), sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM, sh->GetPhi1() * DEGREE_2_RAD,
-                          sh->GetPhi2() * DEGREE_2_RAD, sh->GetTheta1() * DEGREE_2_RAD, sh->GetTheta2() * DEGREE_2_RAD);
+      return createSolid<G4Sphere>(sh->GetName(), sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM, sh->GetPhi1() * DEGREE_2_RAD,
+                                   sh->GetPhi2() * DEGREE_2_RAD, sh->GetTheta1() * DEGREE_2_RAD, sh->GetTheta2() * DEGREE_2_RAD);
     }
 
     template <> G4VSolid* convertShape<TGeoTorus>(const TGeoShape* shape)  {
       const TGeoTorus* sh = (const TGeoTorus*) shape;
-      return new G4Torus(sh->GetName(), sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM, sh->GetR() * CM_2_MM,
-                         sh->GetPhi1() * DEGREE_2_RAD, sh->GetDphi() * DEGREE_2_RAD);
+      return createSolid<G4Torus>(sh->GetName(), sh->GetRmin() * CM_2_MM, sh->GetRmax() * CM_2_MM, sh->GetR() * CM_2_MM,
+                                  sh->GetPhi1() * DEGREE_2_RAD, sh->GetDphi() * DEGREE_2_RAD);
     }
 
     template <> G4VSolid* convertShape<TGeoTrap>(const TGeoShape* shape)  {
       const TGeoTrap* sh = (const TGeoTrap*) shape;
-      return new G4Trap(sh->GetName(), sh->GetDz() * CM_2_MM, sh->GetTheta() * DEGREE_2_RAD, sh->GetPhi() * DEGREE_2_RAD,
-                        sh->GetH1() * CM_2_MM, sh->GetBl1() * CM_2_MM, sh->GetTl1() * CM_2_MM, sh->GetAlpha1() * DEGREE_2_RAD,
-                        sh->GetH2() * CM_2_MM, sh->GetBl2() * CM_2_MM, sh->GetTl2() * CM_2_MM, sh->GetAlpha2() * DEGREE_2_RAD);
+      return createSolid<G4Trap>(sh->GetName(), sh->GetDz() * CM_2_MM, sh->GetTheta() * DEGREE_2_RAD, sh->GetPhi() * DEGREE_2_RAD,
+                                 sh->GetH1() * CM_2_MM, sh->GetBl1() * CM_2_MM, sh->GetTl1() * CM_2_MM, sh->GetAlpha1() * DEGREE_2_RAD,
+                                 sh->GetH2() * CM_2_MM, sh->GetBl2() * CM_2_MM, sh->GetTl2() * CM_2_MM, sh->GetAlpha2() * DEGREE_2_RAD);
     }
 
     template <> G4VSolid* convertShape<G4GenericTrap>(const TGeoShape* shape)  {
@@ -225,7 +231,7 @@ namespace dd4hep {
       Double_t* vtx_xy = sh->GetVertices();
       for ( size_t i=0; i<8; ++i, vtx_xy +=2 )
         vertices.emplace_back(vtx_xy[0] * CM_2_MM, vtx_xy[1] * CM_2_MM);
-      return new G4GenericTrap(sh->GetName(), sh->GetDz() * CM_2_MM, vertices);
+      return createSolid<G4GenericTrap>(sh->GetName(), sh->GetDz() * CM_2_MM, vertices);
     }
   }    // End namespace sim
 }      // End namespace dd4hep
@@ -242,7 +248,7 @@ namespace dd4hep {
 
     template <> G4VSolid* convertShape<TGeoTessellated>(const TGeoShape* shape)  {
       TGeoTessellated*   sh  = (TGeoTessellated*) shape;
-      G4TessellatedSolid* g4 = new G4TessellatedSolid(sh->GetName());
+      G4TessellatedSolid* g4 = createSolid<G4TessellatedSolid>(sh->GetName());
       int num_facet = sh->GetNfacets();
 
       printout(DEBUG,"TessellatedSolid","+++ %s> Converting %d facets", sh->GetName(), num_facet);
@@ -273,6 +279,9 @@ namespace dd4hep {
         }
         g4->AddFacet(g4f);
       }
+      // Closing the solid builds the voxel structure. This is the expensive part
+      // and may be executed concurrently for different solids.
+      g4->SetSolidClosed(true);
       return g4;
     }
     
@@ -14,8 +14,10 @@
 #define DDG4_SRC_GEANT4SHAPECONVERTER_H
 
 // Framework include files
+#include "DD4hep/Mutex.h"
 
 // C/C++ include files
+#include <utility>
 
 // Forward declarations
 class TGeoShape;
@@ -30,6 +32,15 @@ namespace dd4hep {
     /// Convert a specific TGeo shape into the geant4 equivalent
     template <typename T> G4VSolid* convertShape(const TGeoShape* shape);
 
+    /// Lock serializing the registration of Geant4 solids in the G4SolidStore
+    dd4hep_mutex_t& solidStoreLock();
+
+    /// Create a Geant4 solid. The G4SolidStore is not thread-safe, hence the construction is serialized
+    template <typename T, typename... ARGS> T* createSolid(ARGS&&... args)   {
+      dd4hep_lock_t lock(solidStoreLock());
+      return new T(std::forward<ARGS>(args)...);
+    }
+
   }    // End namespace sim
 }      // End namespace dd4hep
 #endif // DDG4_SRC_GEANT4SHAPECONVERTER_H
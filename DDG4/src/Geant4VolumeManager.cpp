@@ -27,6 +27,9 @@
 
 // C/C++ include files
 #include <sstream>
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
 
 using namespace dd4hep::sim::Geant4GeometryMaps;
 using namespace dd4hep::detail::tools;
@@ -39,6 +42,72 @@ using namespace std;
 typedef pair<VolumeID,vector<pair<const BitFieldElement*, VolumeID> > > VolIDDescriptor;
 namespace {
 
+  /// Generation of the populated volume managers. Invalidates the touchable caches
+  atomic<unsigned long> s_volumeManagerGeneration { 0 };
+
+  /// Per-thread cache of volume identifiers found for touchables
+  /**
+   *  Entries are keyed by a hash of the touchable history (depth, physical volumes
+   *  and replica numbers) and point to the entries of Geant4GeometryInfo::g4Paths.
+   *
+   *  \author  M.Frank
+   *  \version 1.0
+   *  \ingroup DD4HEP_SIMULATION
+   */
+  class TouchableCache  {
+  public:
+    typedef Geant4GeometryInfo::Geant4PlacementPath      path_t;
+    typedef pair<const path_t, VolumeID>                 entry_t;
+    /// Geometry information the entries belong to
+    const Geant4GeometryInfo*                 info       { nullptr };
+    /// Volume manager generation the entries belong to
+    unsigned long                             generation { 0 };
+    /// Entry of the last touchable found
+    const entry_t*                            last       { nullptr };
+    /// Entries by touchable hash
+    unordered_map<uint64_t, const entry_t*>   entries;
+
+    /// Drop all entries if they do not belong to the geometry information
+    void check(const Geant4GeometryInfo* geo)  {
+      unsigned long gen = s_volumeManagerGeneration.load(memory_order_acquire);
+      if ( info != geo || generation != gen )  {
+        entries.clear();
+        last       = nullptr;
+        info       = geo;
+        generation = gen;
+      }
+    }
+    /// Mix the bits of a 64 bit word
+    static uint64_t mix(uint64_t h)  {
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdULL;
+      h ^= h >> 33;
+      h *= 0xc4ceb9fe1a85ec53ULL;
+      return h ^ (h >> 33);
+    }
+    /// Hash the touchable history without creating the placement path
+    static uint64_t hash(const G4VTouchable* touchable, int depth)  {
+      uint64_t h = mix(uint64_t(depth));
+      for( int i = 0; i < depth; ++i )  {
+        h = mix(h ^ uint64_t(uintptr_t(touchable->GetVolume(i))));
+        h = mix(h ^ uint64_t(uint32_t(touchable->GetReplicaNumber(i))));
+      }
+      return h;
+    }
+    /// Check if the touchable history has the placement path of the entry
+    static bool matches(const G4VTouchable* touchable, int depth, const entry_t* entry)  {
+      const path_t& path = entry->first;
+      if ( int(path.size()) != depth )
+        return false;
+      for( int i = 0; i < depth; ++i )  {
+        if ( path[i] != touchable->GetVolume(i) )
+          return false;
+      }
+      return true;
+    }
+  };
+  thread_local TouchableCache s_touchableCache;
+
   /// Helper class to populate the Geant4 volume manager
   struct Populator {
     typedef vector<const TGeoNode*> Chain;
@@ -191,6 +260,7 @@ Geant4VolumeManager::Geant4VolumeManager(const Detector& description, Geant4Geom
   if (info && info->valid && info->g4Paths.empty()) {
     Populator p(description, *info);
     p.populate(description.world());
+    ++s_volumeManagerGeneration;
     return;
   }
   throw runtime_error(format("Geant4VolumeManager", "Attempt populate from invalid Geant4 geometry info [Invalid-Info]"));
@@ -237,6 +307,30 @@ VolumeID Geant4VolumeManager::volumeID(const vector<const G4VPhysicalVolume*>& p
 
 /// Access CELLID by Geant4 touchable object
 VolumeID Geant4VolumeManager::volumeID(const G4VTouchable* touchable) const {
+  if ( touchable && checkValidity() && ptr()->volumeIDCache )  {
+    TouchableCache& cache = s_touchableCache;
+    int depth = touchable->GetHistoryDepth();
+    cache.check(ptr());
+    // Consecutive steps are mostly in the same volume
+    if ( cache.last && TouchableCache::matches(touchable, depth, cache.last) )  {
+      return cache.last->second;
+    }
+    uint64_t hash = TouchableCache::hash(touchable, depth);
+    auto i = cache.entries.find(hash);
+    if ( i != cache.entries.end() && TouchableCache::matches(touchable, depth, i->second) )  {
+      cache.last = i->second;
+      return cache.last->second;
+    }
+    Geant4TouchableHandler handler(touchable);
+    auto path = handler.placementPath();
+    const auto& mapping = ptr()->g4Paths;
+    auto j = mapping.find(path);
+    if ( j != mapping.end() )  {
+      cache.last = cache.entries[hash] = &(*j);
+      return cache.last->second;
+    }
+    return volumeID(path);
+  }
   Geant4TouchableHandler handler(touchable);
   return volumeID(handler.placementPath());
 }
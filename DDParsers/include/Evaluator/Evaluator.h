@@ -13,6 +13,9 @@
 #define EVALUATOR_EVALUATOR_H
 
 /// C/C++ include files
+#include <string>
+#include <vector>
+#include <utility>
 #include <ostream>
 
 /// Namespace for the AIDA detector description toolkit
@@ -65,6 +68,62 @@ namespace dd4hep  {
         ERROR_CALCULATION_ERROR     /**< Error during calculation */
       };
 
+      /// Compiled arithmetic expression.
+      /**
+       * Result of Evaluator::compile: the expression is parsed once and stored
+       * as a sequence of stack machine instructions in reverse polish notation.
+       * Functions are resolved at compile time, variables are referenced by name.
+       *
+       * The object is immutable. The evaluation does not access the dictionary
+       * of the evaluator and hence needs no locking. The variables may be bound
+       * to other values than the ones found in the dictionary at compile time.
+       *
+       * Example:
+       * @code
+       *   auto c = eval.compile("2*a+b");
+       *   double r1 = c.second.evaluate().second;          // a, b as at compile time
+       *   double r2 = c.second.evaluate({1.0, 3.0}).second; // a=1, b=3
+       * @endcode
+       *
+       * @ingroup evaluator
+       */
+      class Expression {
+      public:
+        /// Internal: one instruction of the stack machine
+        struct Instruction {
+          enum { CONSTANT, VARIABLE, FUNCTION, OPERATOR };
+          int    what     = CONSTANT;
+          /// Variable index, number of function parameters or operator code
+          int    arg      = 0;
+          double value    = 0e0;
+          void*  function = nullptr;
+        };
+        /// Internal: code generator used by the evaluator
+        struct Builder;
+
+      private:
+        friend struct Builder;
+        std::vector<Instruction> code;
+        std::vector<std::string> names;
+        std::vector<double>      values;
+        std::size_t              depth = 0;
+
+        /// Execute the instructions with the given variable values
+        std::pair<int,double> execute(const double* bindings)  const;
+
+      public:
+        /// Check if the expression contains code
+        bool empty()  const  {  return code.empty();  }
+        /// Names of the variables used by the expression in the order of the bindings
+        const std::vector<std::string>& variables()  const  {  return names;  }
+        /// Variable values found in the dictionary at compile time
+        const std::vector<double>& bindings()  const  {  return values;  }
+        /// Evaluate the expression with the variable values at compile time
+        std::pair<int,double> evaluate()  const;
+        /// Evaluate the expression with other variable values (one per entry of variables())
+        std::pair<int,double> evaluate(const std::vector<double>& bindings)  const;
+      };
+
       /**
        * Constructor.
        */
@@ -104,6 +163,43 @@ namespace dd4hep  {
        */
       std::pair<int,double> evaluate(const std::string& expression, std::ostream& os)  const;
 
+      /**
+       * Compiles the arithmetic expression given as character string.
+       * The syntax is the same as for evaluate(). The compiled expression
+       * may be evaluated any number of times without parsing the string.
+       *
+       * @param  expression input expression.
+       * @return pair(status,compiled expression). On failure the expression is empty.
+       */
+      std::pair<int,Expression> compile(const std::string& expression)  const;
+
+      /**
+       * Compiles the arithmetic expression given as character string.
+       *
+       * @param  expression input expression.
+       * @param  Possible stream identifier for error message
+       * @return pair(status,compiled expression). On failure the expression is empty.
+       */
+      std::pair<int,Expression> compile(const std::string& expression, std::ostream& os)  const;
+
+      /**
+       * Evaluates a compiled expression with the current values of the
+       * variables in the dictionary.
+       *
+       * @param  expression compiled expression.
+       * @return pair(status,result) of the evaluation.
+       */
+      std::pair<int,double> evaluate(const Expression& expression)  const;
+
+      /**
+       * Number of modifications of existing dictionary entries, i.e. redefinitions
+       * and removals of variables and functions. As long as the number does not
+       * change, the result of any successful evaluation stays valid.
+       *
+       * @return modification count.
+       */
+      long generation()  const;
+
       /**
        * Adds to the dictionary a function without parameters.
        * If such a function already exist in the dictionary,
@@ -135,6 +135,28 @@ namespace dd4hep  {
        */
       EvalStatus evaluate(const char* expression) const;
 
+      /**
+       * Compiles the arithmetic expression given as character string.
+       *
+       * @param  expression input expression.
+       * @param  result compiled expression.
+       * @return status of the compilation.
+       */
+      EvalStatus compile(const char* expression, Evaluator::Expression& result) const;
+
+      /**
+       * Evaluates a compiled expression with the current variable values.
+       *
+       * @param  expression compiled expression.
+       * @return result of the evaluation.
+       */
+      EvalStatus evaluate(const Evaluator::Expression& expression) const;
+
+      /**
+       * Number of modifications of existing dictionary entries.
+       */
+      long generation() const;
+
       /**
        * Adds to the dictionary a string constant
        *
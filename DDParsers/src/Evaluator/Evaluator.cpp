@@ -9,6 +9,8 @@
 #include <cmath>        // for pow()
 #include <sstream>
 #include <mutex>
+#include <atomic>
+#include <vector>
 #include <condition_variable>
 #include <cctype>
 #include <cerrno>
@@ -98,6 +100,7 @@ struct EVAL::Object::Struct {
   };
 
   dic_type    theDictionary;
+  std::atomic<long> theGeneration {0};
   int theReadersWaiting = 0;
   bool theWriterWaiting = false;
   std::condition_variable theCond;
@@ -125,6 +128,47 @@ namespace {
   };
 }
 
+/// Internal code generator for compiled expressions
+/**
+ *  The instructions are emitted by the evaluation engine in the order
+ *  the values are pushed to the value stack and the operators are executed.
+ */
+struct EVAL::Expression::Builder {
+  Expression& expr;
+  std::size_t depth = 0;
+
+  explicit Builder(Expression& e) : expr(e) {}
+  void emit(int what, int arg, double value, void* fcn, int pushed, int popped)  {
+    Instruction ins;
+    ins.what     = what;
+    ins.arg      = arg;
+    ins.value    = value;
+    ins.function = fcn;
+    expr.code.push_back(ins);
+    depth -= popped;
+    depth += pushed;
+    if ( depth > expr.depth ) expr.depth = depth;
+  }
+  void constant(double value)  {
+    emit(Instruction::CONSTANT, 0, value, nullptr, 1, 0);
+  }
+  void variable(const string& name, double value)  {
+    std::size_t slot = 0;
+    while ( slot < expr.names.size() && expr.names[slot] != name.c_str() ) ++slot;
+    if ( slot == expr.names.size() )  {
+      expr.names.push_back(name.c_str());
+      expr.values.push_back(value);
+    }
+    emit(Instruction::VARIABLE, int(slot), 0e0, nullptr, 1, 0);
+  }
+  void function(void* fcn, int npar)  {
+    emit(Instruction::FUNCTION, npar, 0e0, fcn, 1, npar);
+  }
+  void op(int code)  {
+    emit(Instruction::OPERATOR, code, 0e0, nullptr, 0, 1);
+  }
+};
+
 //---------------------------------------------------------------------------
 #define REMOVE_BLANKS							\
   for(pointer=name;;pointer++) if (!isspace(*pointer)) break;		\
@@ -144,10 +188,11 @@ static constexpr char sss[MAX_N_PAR+2] = "012345";
 enum { ENDL, LBRA, OR, AND, EQ, NE, GE, GT, LE, LT,
        PLUS, MINUS, MULT, DIV, POW, RBRA, VALUE };
 
-static int engine(char const*, char const*, double &, char const* &, const dic_type &);
+static int engine(char const*, char const*, double &, char const* &, const dic_type &,
+                  EVAL::Expression::Builder*);
 
 static int variable(const string & name, double & result,
-                    const dic_type & dictionary)
+                    const dic_type & dictionary, EVAL::Expression::Builder* code)
 /***********************************************************************
  *                                                                     *
  * Name: variable                                    Date:    03.10.00 *
@@ -160,6 +205,7 @@ static int variable(const string & name, double & result,
  *   name   - name of the variable.                                    *
  *   result - value of the variable.                                   *
  *   dictionary - dictionary of available variables and functions.     *
+ *   code   - optional code generator of a compiled expression.        *
  *                                                                     *
  ***********************************************************************/
 {
@@ -171,12 +217,15 @@ static int variable(const string & name, double & result,
   switch (item.what) {
   case Item::VARIABLE:
     result = item.variable;
+    if (code) code->variable(name, result);
     return EVAL::OK;
   case Item::EXPRESSION: {
     char const* exp_begin = (item.expression.c_str());
     char const* exp_end   = exp_begin + strlen(exp_begin) - 1;
-    if (engine(exp_begin, exp_end, result, exp_end, dictionary) == EVAL::OK)
+    if (engine(exp_begin, exp_end, result, exp_end, dictionary, nullptr) == EVAL::OK) {
+      if (code) code->variable(name, result);
       return EVAL::OK;
+    }
     return EVAL::ERROR_CALCULATION_ERROR;
   }
   default:
@@ -185,7 +234,8 @@ static int variable(const string & name, double & result,
 }
 
 static int function(const string & name, stack<double> & par,
-                    double & result, const dic_type & dictionary)
+                    double & result, const dic_type & dictionary,
+                    EVAL::Expression::Builder* code)
 /***********************************************************************
  *                                                                     *
  * Name: function                                    Date:    03.10.00 *
@@ -199,6 +249,7 @@ static int function(const string & name, stack<double> & par,
  *   par    - stack of parameters.                                     *
  *   result - value of the function.                                   *
  *   dictionary - dictionary of available variables and functions.     *
+ *   code   - optional code generator of a compiled expression.        *
  *                                                                     *
  ***********************************************************************/
 {
@@ -235,11 +286,14 @@ static int function(const string & name, stack<double> & par,
     result = (*fcn.f5)(pp[4],pp[3],pp[2],pp[1],pp[0]);
     break;
   }
-  return (errno == 0) ? EVAL::OK : EVAL::ERROR_CALCULATION_ERROR;
+  if (errno != 0) return EVAL::ERROR_CALCULATION_ERROR;
+  if (code) code->function(item.function, npar);
+  return EVAL::OK;
 }
 
 static int operand(char const* begin, char const* end, double & result,
-                   char const* & endp, const dic_type & dictionary)
+                   char const* & endp, const dic_type & dictionary,
+                   EVAL::Expression::Builder* code)
 /***********************************************************************
  *                                                                     *
  * Name: operand                                     Date:    03.10.00 *
@@ -255,6 +309,7 @@ static int operand(char const* begin, char const* end, double & result,
  *   result - value of the operand.                                    *
  *   endp   - pointer to the character where the evaluation stoped.    *
  *   dictionary - dictionary of available variables and functions.     *
+ *   code   - optional code generator of a compiled expression.        *
  *                                                                     *
  ***********************************************************************/
 {
@@ -273,6 +328,7 @@ static int operand(char const* begin, char const* end, double & result,
 #endif
       result = strtod(pointer, (char **)(&pointer));
     if (errno == 0) {
+      if (code) code->constant(result);
       EVAL_EXIT( EVAL::OK, --pointer );
     }else{
       EVAL_EXIT( EVAL::ERROR_CALCULATION_ERROR, begin );
@@ -293,7 +349,7 @@ static int operand(char const* begin, char const* end, double & result,
   result = 0.0;
   SKIP_BLANKS;
   if (c != '(') {
-    EVAL_STATUS = variable(name, result, dictionary);
+    EVAL_STATUS = variable(name, result, dictionary, code);
     EVAL_EXIT( EVAL_STATUS, (EVAL_STATUS == EVAL::OK) ? --pointer : begin);
   }
 
@@ -315,7 +371,7 @@ static int operand(char const* begin, char const* end, double & result,
     case ',':
       if (pos.size() == 1) {
         par_end = pointer-1;
-        EVAL_STATUS = engine(par_begin, par_end, value, par_end, dictionary);
+        EVAL_STATUS = engine(par_begin, par_end, value, par_end, dictionary, code);
         if (EVAL_STATUS == EVAL::WARNING_BLANK_STRING)
 	  { EVAL_EXIT( EVAL::ERROR_EMPTY_PARAMETER, --par_end ); }
         if (EVAL_STATUS != EVAL::OK)
@@ -330,7 +386,7 @@ static int operand(char const* begin, char const* end, double & result,
         break;
       }else{
         par_end = pointer-1;
-        EVAL_STATUS = engine(par_begin, par_end, value, par_end, dictionary);
+        EVAL_STATUS = engine(par_begin, par_end, value, par_end, dictionary, code);
         switch (EVAL_STATUS) {
         case EVAL::OK:
           par.push(value);
@@ -342,7 +398,7 @@ static int operand(char const* begin, char const* end, double & result,
         default:
           EVAL_EXIT( EVAL_STATUS, par_end );
         }
-        EVAL_STATUS = function(name, par, result, dictionary);
+        EVAL_STATUS = function(name, par, result, dictionary, code);
         EVAL_EXIT( EVAL_STATUS, (EVAL_STATUS == EVAL::OK) ? pointer : begin);
       }
     }
@@ -351,64 +407,62 @@ static int operand(char const* begin, char const* end, double & result,
 
 /***********************************************************************
  *                                                                     *
- * Name: maker                                       Date:    28.09.00 *
- * Author: Evgeni Chernyaev                          Revised:          *
+ * Name: apply                                                         *
  *                                                                     *
- * Function: Executes basic arithmetic operations on values in the top *
- *           of the stack. Result is placed back into the stack.       *
- *           This function is used by engine().                        *
+ * Function: Executes basic arithmetic operation on two values.        *
+ *           This function is used by maker() and by the execution     *
+ *           of compiled expressions.                                  *
  *                                                                     *
  * Parameters:                                                         *
- *   op  - code of the operation.                                      *
- *   val - stack of values.                                            *
+ *   op     - code of the operation.                                   *
+ *   val1   - left operand.                                            *
+ *   val2   - right operand.                                           *
+ *   result - result of the operation.                                 *
  *                                                                     *
  ***********************************************************************/
-static int maker(int op, stack<double> & val)
+static int apply(int op, double val1, double val2, double & result)
 {
-  if (val.size() < 2) return EVAL::ERROR_SYNTAX_ERROR;
-  double val2 = val.top(); val.pop();
-  double val1 = val.top();
   switch (op) {
   case OR:                                // operator ||
-    val.top() = (val1 || val2) ? 1. : 0.;
+    result = (val1 || val2) ? 1. : 0.;
     return EVAL::OK;
   case AND:                               // operator &&
-    val.top() = (val1 && val2) ? 1. : 0.;
+    result = (val1 && val2) ? 1. : 0.;
     return EVAL::OK;
   case EQ:                                // operator ==
-    val.top() = (val1 == val2) ? 1. : 0.;
+    result = (val1 == val2) ? 1. : 0.;
     return EVAL::OK;
   case NE:                                // operator !=
-    val.top() = (val1 != val2) ? 1. : 0.;
+    result = (val1 != val2) ? 1. : 0.;
     return EVAL::OK;
   case GE:                                // operator >=
-    val.top() = (val1 >= val2) ? 1. : 0.;
+    result = (val1 >= val2) ? 1. : 0.;
     return EVAL::OK;
   case GT:                                // operator >
-    val.top() = (val1 >  val2) ? 1. : 0.;
+    result = (val1 >  val2) ? 1. : 0.;
     return EVAL::OK;
   case LE:                                // operator <=
-    val.top() = (val1 <= val2) ? 1. : 0.;
+    result = (val1 <= val2) ? 1. : 0.;
     return EVAL::OK;
   case LT:                                // operator <
-    val.top() = (val1 <  val2) ? 1. : 0.;
+    result = (val1 <  val2) ? 1. : 0.;
     return EVAL::OK;
   case PLUS:                              // operator '+'
-    val.top() = val1 + val2;
+    result = val1 + val2;
     return EVAL::OK;
   case MINUS:                             // operator '-'
-    val.top() = val1 - val2;
+    result = val1 - val2;
     return EVAL::OK;
   case MULT:                              // operator '*'
-    val.top() = val1 * val2;
+    result = val1 * val2;
     return EVAL::OK;
   case DIV:                               // operator '/'
     if (val2 == 0.0) return EVAL::ERROR_CALCULATION_ERROR;
-    val.top() = val1 / val2;
+    result = val1 / val2;
     return EVAL::OK;
   case POW:                               // operator '^' (or '**')
     errno = 0;
-    val.top() = pow(val1,val2);
+    result = pow(val1,val2);
     if (errno == 0) return EVAL::OK;
     ATTR_FALLTHROUGH;
   default:
@@ -416,6 +470,31 @@ static int maker(int op, stack<double> & val)
   }
 }
 
+/***********************************************************************
+ *                                                                     *
+ * Name: maker                                       Date:    28.09.00 *
+ * Author: Evgeni Chernyaev                          Revised:          *
+ *                                                                     *
+ * Function: Executes basic arithmetic operations on values in the top *
+ *           of the stack. Result is placed back into the stack.       *
+ *           This function is used by engine().                        *
+ *                                                                     *
+ * Parameters:                                                         *
+ *   op   - code of the operation.                                     *
+ *   val  - stack of values.                                           *
+ *   code - optional code generator of a compiled expression.          *
+ *                                                                     *
+ ***********************************************************************/
+static int maker(int op, stack<double> & val, EVAL::Expression::Builder* code)
+{
+  if (val.size() < 2) return EVAL::ERROR_SYNTAX_ERROR;
+  double val2 = val.top(); val.pop();
+  double val1 = val.top();
+  int status = apply(op, val1, val2, val.top());
+  if (status == EVAL::OK && code) code->op(op);
+  return status;
+}
+
 /***********************************************************************
  *                                                                     *
  * Name: engine                                      Date:    28.09.00 *
@@ -430,10 +509,12 @@ static int maker(int op, stack<double> & val)
  *   result - result of the evaluation.                                *
  *   endp   - pointer to the character where the evaluation stoped.    *
  *   dictionary - dictionary of available variables and functions.     *
+ *   code   - optional code generator of a compiled expression.        *
  *                                                                     *
  ***********************************************************************/
 static int engine(char const* begin, char const* end, double & result,
-                  char const*& endp, const dic_type & dictionary)
+                  char const*& endp, const dic_type & dictionary,
+                  EVAL::Expression::Builder* code)
 {
   static constexpr int SyntaxTable[17][17] = {
     //E  (  || && == != >= >  <= <  +  -  *  /  ^  )  V - current token
@@ -548,12 +629,13 @@ static int engine(char const* begin, char const* end, double & result,
     case 0:                             // systax error
       EVAL_EXIT( EVAL::ERROR_SYNTAX_ERROR, pointer );
     case 1:                             // operand: number, variable, function
-      EVAL_STATUS = operand(pointer, end, value, pointer, dictionary);
+      EVAL_STATUS = operand(pointer, end, value, pointer, dictionary, code);
       if (EVAL_STATUS != EVAL::OK) { EVAL_EXIT( EVAL_STATUS, pointer ); }
       val.push(value);
       continue;
     case 2:                             // unary + or unary -
       val.push(0.0);
+      if (code) code->constant(0.0);
     case 3: default:                    // next operator
       break;
     }
@@ -578,7 +660,7 @@ static int engine(char const* begin, char const* end, double & result,
         op.push(iCur); pos.push(pointer);
         break;
       case 2:                           // execute top operator
-        EVAL_STATUS = maker(iTop, val); // put current operator in stack
+        EVAL_STATUS = maker(iTop, val, code); // put current operator in stack
         if (EVAL_STATUS != EVAL::OK) {
           EVAL_EXIT( EVAL_STATUS, pos.top() );
         }
@@ -588,7 +670,7 @@ static int engine(char const* begin, char const* end, double & result,
         op.pop(); pos.pop();
         break;
       case 4: default:                  // execute top operator and
-        EVAL_STATUS = maker(iTop, val); // delete it from stack
+        EVAL_STATUS = maker(iTop, val, code); // delete it from stack
         if (EVAL_STATUS != EVAL::OK) {  // repete with the same iCur
           EVAL_EXIT( EVAL_STATUS, pos.top() );
         }
@@ -631,6 +713,7 @@ static int setItem(const char * prefix, const char * name,
   dic_type::iterator iter = imp->theDictionary.find(item_name);
   if (iter != imp->theDictionary.end()) {
     iter->second = item;
+    ++imp->theGeneration;
     if (item_name == name) {
       return EVAL::WARNING_EXISTING_VARIABLE;
     }else{
@@ -709,11 +792,128 @@ Evaluator::Object::EvalStatus Evaluator::Object::evaluate(const char * expressio
                          expression+strlen(expression)-1,
                          s.theResult,
                          s.thePosition,
-                         imp->theDictionary);
+                         imp->theDictionary,
+                         nullptr);
+  }
+  return s;
+}
+
+//---------------------------------------------------------------------------
+Evaluator::Object::EvalStatus
+Evaluator::Object::compile(const char * expression, Expression& result) const {
+  EvalStatus s;
+  result = Expression();
+  if (expression != 0) {
+    Expression::Builder code(result);
+    Struct::ReadLock guard(imp);
+    s.theStatus = engine(expression,
+                         expression+strlen(expression)-1,
+                         s.theResult,
+                         s.thePosition,
+                         imp->theDictionary,
+                         &code);
+  }
+  if (s.theStatus != EVAL::OK) {
+    result = Expression();
+  }
+  return s;
+}
+
+//---------------------------------------------------------------------------
+Evaluator::Object::EvalStatus
+Evaluator::Object::evaluate(const Expression& expression) const {
+  EvalStatus s;
+  const auto& names = expression.variables();
+  std::vector<double> values(names.size());
+  {
+    Struct::ReadLock guard(imp);
+    for(std::size_t i=0; i<names.size(); ++i) {
+      s.theStatus = variable(names[i].c_str(), values[i], imp->theDictionary, nullptr);
+      if (s.theStatus != EVAL::OK) {
+        s.thePosition = names[i].c_str();
+        return s;
+      }
+    }
   }
+  auto result = expression.evaluate(values);
+  s.theStatus = result.first;
+  s.theResult = result.second;
   return s;
 }
 
+//---------------------------------------------------------------------------
+long Evaluator::Object::generation() const {
+  return imp->theGeneration;
+}
+
+//---------------------------------------------------------------------------
+std::pair<int,double> Evaluator::Expression::execute(const double* bindings) const {
+  double  buffer[32];
+  std::vector<double> heap;
+  double* val = buffer;
+  std::size_t top = 0;
+
+  if (code.empty()) {
+    return std::make_pair(int(EVAL::WARNING_BLANK_STRING), 0e0);
+  }
+  if (depth > sizeof(buffer)/sizeof(buffer[0])) {
+    heap.resize(depth);
+    val = heap.data();
+  }
+  for(const Instruction& ins : code) {
+    switch (ins.what) {
+    case Instruction::CONSTANT:
+      val[top++] = ins.value;
+      break;
+    case Instruction::VARIABLE:
+      val[top++] = bindings[ins.arg];
+      break;
+    case Instruction::FUNCTION: {
+      FCN     fcn(ins.function);
+      double* pp = val + top - ins.arg;
+      double  result = 0e0;
+      errno = 0;
+      switch (ins.arg) {
+      case 0: result = (*fcn.f0)(); break;
+      case 1: result = (*fcn.f1)(pp[0]); break;
+      case 2: result = (*fcn.f2)(pp[0],pp[1]); break;
+      case 3: result = (*fcn.f3)(pp[0],pp[1],pp[2]); break;
+      case 4: result = (*fcn.f4)(pp[0],pp[1],pp[2],pp[3]); break;
+      case 5: result = (*fcn.f5)(pp[0],pp[1],pp[2],pp[3],pp[4]); break;
+      }
+      if (errno != 0) {
+        return std::make_pair(int(EVAL::ERROR_CALCULATION_ERROR), 0e0);
+      }
+      top -= ins.arg;
+      val[top++] = result;
+      break;
+    }
+    case Instruction::OPERATOR: {
+      --top;
+      int status = apply(ins.arg, val[top-1], val[top], val[top-1]);
+      if (status != EVAL::OK) {
+        return std::make_pair(status, 0e0);
+      }
+      break;
+    }
+    }
+  }
+  return std::make_pair(int(EVAL::OK), val[0]);
+}
+
+//---------------------------------------------------------------------------
+std::pair<int,double> Evaluator::Expression::evaluate() const {
+  return execute(values.data());
+}
+
+//---------------------------------------------------------------------------
+std::pair<int,double> Evaluator::Expression::evaluate(const std::vector<double>& bindings) const {
+  if (bindings.size() != names.size()) {
+    return std::make_pair(int(EVAL::ERROR_UNKNOWN_VARIABLE), 0e0);
+  }
+  return execute(bindings.data());
+}
+
 //---------------------------------------------------------------------------
 int Evaluator::Object::EvalStatus::status() const {
   return theStatus;
@@ -758,6 +958,7 @@ int Evaluator::Object::setEnviron(const char* name, const char* value)  {
   dic_type::iterator iter = imp->theDictionary.find(item_name);
   if (iter != imp->theDictionary.end()) {
     iter->second = item;
+    ++imp->theGeneration;
     if (item_name == name) {
       return EVAL::WARNING_EXISTING_VARIABLE;
     }else{
@@ -876,7 +1077,7 @@ void Evaluator::Object::removeVariable(const char * name) {
   const char * pointer; int n; REMOVE_BLANKS;
   if (n == 0) return;
   Struct::WriteLock guard(imp);
-  imp->theDictionary.erase(string(pointer,n));
+  if (imp->theDictionary.erase(string(pointer,n)) > 0) ++imp->theGeneration;
 }
 
 //---------------------------------------------------------------------------
@@ -886,7 +1087,7 @@ void Evaluator::Object::removeFunction(const char * name, int npar) {
   const char * pointer; int n; REMOVE_BLANKS;
   if (n == 0) return;
   Struct::WriteLock guard(imp);
-  imp->theDictionary.erase(sss[npar]+string(pointer,n));
+  if (imp->theDictionary.erase(sss[npar]+string(pointer,n)) > 0) ++imp->theGeneration;
 }
 
 //---------------------------------------------------------------------------
@@ -921,6 +1122,35 @@ std::pair<int,double> Evaluator::evaluate(const std::string& expression, std::os
   return std::make_pair(result.status(),result.result());
 }
 
+//---------------------------------------------------------------------------
+std::pair<int,Evaluator::Expression> Evaluator::compile(const std::string& expression)  const   {
+  std::pair<int,Expression> result;
+  result.first = object->compile(expression.c_str(), result.second).status();
+  return result;
+}
+
+//---------------------------------------------------------------------------
+std::pair<int,Evaluator::Expression> Evaluator::compile(const std::string& expression, std::ostream& os)  const   {
+  std::pair<int,Expression> result;
+  auto status = object->compile(expression.c_str(), result.second);
+  result.first = status.status();
+  if ( result.first != OK )   {
+    status.print_error(os);
+  }
+  return result;
+}
+
+//---------------------------------------------------------------------------
+std::pair<int,double> Evaluator::evaluate(const Expression& expression)  const   {
+  auto result = object->evaluate(expression);
+  return std::make_pair(result.status(),result.result());
+}
+
+//---------------------------------------------------------------------------
+long Evaluator::generation()  const   {
+  return object->generation();
+}
+
 //---------------------------------------------------------------------------
 int Evaluator::setEnviron(const std::string& name, const std::string& value)  const    {
   int result = object->setEnviron(name.c_str(), value.c_str());
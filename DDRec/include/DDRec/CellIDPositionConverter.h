@@ -19,6 +19,8 @@
 
 #include "DDSegmentation/Segmentation.h"
 
+class TGeoNavigator;
+
 #include <set>
 #include <string>
 
@@ -67,13 +69,34 @@ namespace dd4hep {
        */
       Position position(const CellID& cellID) const;
 
+      /** Return the global positions for an array of n cellIDs of sensitive volumes.
+       *  Equivalent to calling position(cellID) for each cell, but the cells are
+       *  grouped by volume context so that the readout search and the combined
+       *  local-to-global transformation are computed once per sensitive volume.
+       *  Cells without sensitive volume get the position (0,0,0).
+       */
+      void positions(const CellID* cellIDs, std::size_t n, Position* result) const;
+
 
       /** Return the global cellID for the given global position.
        *  Note: this call is rather slow - only use it when really needed !
-       *  
+       *  The navigation uses the TGeoNavigator of the calling thread. To call it
+       *  concurrently from several threads, call setMaxThreads() beforehand.
        */
       CellID cellID(const Position& global) const;
 
+      /** Enable the multi-threaded navigation mode of the TGeoManager for up to
+       *  nthreads threads, where each thread navigates with its own TGeoNavigator.
+       *  Must be called once from the main thread before calling cellID(const Position&)
+       *  from several threads.
+       */
+      void setMaxThreads(int nthreads) const;
+
+      /** Access the TGeoNavigator of the calling thread. The navigator is created
+       *  on first access.
+       */
+      TGeoNavigator* navigator() const;
+
 
 
       /** Find the context with DetElement, placements etc for a given cellID of a sensitive volume.
@@ -17,6 +17,10 @@
 #include "DD4hep/detail/VolumeManagerInterna.h"
 
 #include "TGeoManager.h"
+#include "TGeoNavigator.h"
+
+#include <vector>
+#include <algorithm>
 
 namespace dd4hep {
   namespace rec {
@@ -84,17 +88,92 @@ namespace dd4hep {
 
 
 
+    void CellIDPositionConverter::positions(const CellID* cells, std::size_t n, Position* result) const {
+
+      // untill we have the alignment map object, we return the nominal positions
+
+      if( n == 0 )
+	return ;
+
+      // resolve the contexts and group the cells by sensitive volume
+      std::vector< std::pair<const VolumeManagerContext*, std::size_t> > order( n ) ;
+      for( std::size_t i = 0 ; i < n ; ++i )
+	order[i] = std::make_pair( findContext( cells[i] ), i ) ;
+
+      std::stable_sort( order.begin(), order.end(),
+			[]( const std::pair<const VolumeManagerContext*, std::size_t>& a,
+			    const std::pair<const VolumeManagerContext*, std::size_t>& b ){ return a.first < b.first ; } ) ;
+
+      // structure-of-arrays buffers for the local and global coordinates of one run
+      std::vector<double> lx( n ), ly( n ), lz( n ) ;
+
+      for( std::size_t begin = 0 ; begin < n ; ){
+
+	const VolumeManagerContext* context = order[begin].first ;
+	std::size_t end = begin ;
+	while( end < n && order[end].first == context )
+	  ++end ;
+
+	if( context == NULL ){
+	  for( std::size_t i = begin ; i < end ; ++i )
+	    result[ order[i].second ] = Position() ;
+	  begin = end ;
+	  continue ;
+	}
+
+	DetElement det = context->element ;
+	Readout r = findReadout( det ) ;
+	const DDSegmentation::Segmentation* seg = r.segmentation().segmentation() ;
+
+	// combined transformation: volume -> detector element -> global
+	TGeoHMatrix volToGlobal( det.nominal().worldTransformation() ) ;
+	volToGlobal.Multiply( &context->toElement() ) ;
+	const double* rot = volToGlobal.GetRotationMatrix() ;
+	const double* tra = volToGlobal.GetTranslation() ;
+	const double r00 = rot[0], r01 = rot[1], r02 = rot[2] ;
+	const double r10 = rot[3], r11 = rot[4], r12 = rot[5] ;
+	const double r20 = rot[6], r21 = rot[7], r22 = rot[8] ;
+	const double t0  = tra[0], t1  = tra[1], t2  = tra[2] ;
+
+	const std::size_t len = end - begin ;
+	double* x = lx.data() ;
+	double* y = ly.data() ;
+	double* z = lz.data() ;
+
+	for( std::size_t i = 0 ; i < len ; ++i ){
+	  DDSegmentation::Vector3D local = seg->position( cells[ order[begin+i].second ] ) ;
+	  x[i] = local.X ;
+	  y[i] = local.Y ;
+	  z[i] = local.Z ;
+	}
+
+	// branch free affine transformation on contiguous arrays: vectorized by the compiler
+	for( std::size_t i = 0 ; i < len ; ++i ){
+	  const double px = x[i], py = y[i], pz = z[i] ;
+	  x[i] = t0 + r00*px + r01*py + r02*pz ;
+	  y[i] = t1 + r10*px + r11*py + r12*pz ;
+	  z[i] = t2 + r20*px + r21*py + r22*pz ;
+	}
+
+	for( std::size_t i = 0 ; i < len ; ++i )
+	  result[ order[begin+i].second ] = Position( x[i], y[i], z[i] ) ;
+
+	begin = end ;
+      }
+    }
+
+
     CellID CellIDPositionConverter::cellID(const Position& global) const {
 
       CellID result(0) ;
       
-      TGeoManager *geoManager = _description->world().volume()->GetGeoManager() ;
+      TGeoNavigator* nav = navigator() ;
       
-      PlacedVolume pv = geoManager->FindNode( global.x() , global.y() , global.z() ) ;
+      PlacedVolume pv = nav->FindNode( global.x() , global.y() , global.z() ) ;
       
       if(  pv.isValid() && pv.volume().isSensitive() ) {
 
-	TGeoHMatrix*  m = geoManager->GetCurrentMatrix() ;
+	TGeoHMatrix*  m = nav->GetCurrentMatrix() ;
       
 	double g[3], l[3] ;
 	global.GetCoordinates( g ) ;
@@ -107,15 +186,12 @@ namespace dd4hep {
 	PlacedVolume::VolIDs volIDs ;
 	volIDs.insert( std::end(volIDs), std::begin(pv.volIDs()), std::end(pv.volIDs())) ;
 
-	TGeoPhysicalNode pN( geoManager->GetPath() ) ; 
-	
-	unsigned motherCount = 0 ;
-
-	while( pN.GetMother( motherCount ) != NULL   ){
+	// walk up the navigation history of this thread's navigator
+	for( int up = 1, level = nav->GetLevel() ; up < level ; ++up ){  // world has no volIDs
 
-	    PlacedVolume mPv = pN.GetMother( motherCount++ ) ;
+	    PlacedVolume mPv = nav->GetMother( up ) ;
 	    
-	    if( mPv.isValid() &&  pN.GetMother( motherCount ) != NULL )  // world has no volIDs
+	    if( mPv.isValid() )
 	      volIDs.insert( std::end(volIDs), std::begin(mPv.volIDs()), std::end(mPv.volIDs())) ;
 	}
 	
@@ -127,6 +203,27 @@ namespace dd4hep {
       return result ;
     }
 
+    void CellIDPositionConverter::setMaxThreads(int nthreads) const {
+
+      TGeoManager& geoManager = _description->manager() ;
+
+      if( nthreads > 1 && geoManager.GetMaxThreads() < nthreads )
+	geoManager.SetMaxThreads( nthreads ) ;
+    }
+
+    TGeoNavigator* CellIDPositionConverter::navigator() const {
+
+      TGeoManager& geoManager = _description->manager() ;
+
+      // in multi-threaded mode the current navigator is local to the calling thread
+      TGeoNavigator* nav = geoManager.GetCurrentNavigator() ;
+
+      if( nav == NULL )
+	nav = geoManager.AddNavigator() ;
+
+      return nav ;
+    }
+
     // CellID CellIDPositionConverter::cellID(const Position& global) const {
       
     //   CellID result(0) ;
@@ -98,6 +98,30 @@ int main(int /* argc */, char** /* argv */ ){
       }
     }
 
+    {
+      //compile once, evaluate with different variable values
+      e.setVariable("compA", 2.0);
+      e.setVariable("compB", 3.0);
+      const std::string expr("-compA*2 + max(compA,compB)^2 - (compA>compB)");
+      auto c = e.compile(expr);
+      test( c.first, Evaluator::OK, " compile status OK");
+      test( c.second.variables().size(), 2u, " compiled expression uses two variables");
+      test( c.second.evaluate().second, e.evaluate(expr).second, " compiled expression with compile time values");
+      auto r = c.second.evaluate({5.0, 1.0});
+      test( r.second, -5*2 + 25.0 - 1.0, " compiled expression with other values");
+      test( r.first, Evaluator::OK, " status OK");
+
+      long generation = e.generation();
+      e.setVariable("compA", 7.0);
+      test( e.generation() != generation, true, " redefinition changes the generation");
+      test( e.evaluate(c.second).second, e.evaluate(expr).second, " compiled expression with current dictionary values");
+
+      test( e.compile("(1+2").first, e.evaluate("(1+2").first, " compile status of invalid expression");
+      test( e.compile("(1+2").second.empty(), true, " invalid expression is not compiled");
+      test( e.compile("compA/compB").second.evaluate({1.0, 0.0}).first,
+            Evaluator::ERROR_CALCULATION_ERROR, " division by zero in compiled expression");
+    }
+
     {
       //do modifications while running multple threads
       std::atomic<int> countDownToStart{2};
@@ -0,0 +1,124 @@
+#include "DD4hep/DDTest.h"
+#include <exception>
+#include <iostream>
+#include <chrono>
+#include <random>
+
+#include "DDSegmentation/BitFieldCoder.h"
+
+
+using namespace std ;
+using namespace dd4hep ;
+using namespace DDSegmentation ;
+
+// this should be the first line in your test
+static DDTest test( "bitfieldcoder_bulk" ) ; 
+
+// compile time layout of "system:5,side:-2,layer:9,module:8,sensor:8,x:32:-16,y:-16"
+typedef BitFieldCoderStatic< BitFieldSpec<0,5>,  BitFieldSpec<5,-2>,   BitFieldSpec<7,9>,
+                             BitFieldSpec<16,8>, BitFieldSpec<24,8>,   BitFieldSpec<32,-16>,
+                             BitFieldSpec<48,-16> > StaticCoder ;
+
+static double seconds(chrono::high_resolution_clock::time_point start) {
+  return chrono::duration<double>( chrono::high_resolution_clock::now() - start ).count() ;
+}
+
+//=============================================================================
+
+int main(int /* argc */, char** /* argv */ ){
+    
+  try{
+    
+    // ----- write your tests in here -------------------------------------
+
+    test.log( "test bitfieldcoder bulk decoding/encoding" );
+
+    const BitFieldCoder bf("system:5,side:-2,layer:9,module:8,sensor:8,x:32:-16,y:-16" ) ;
+    const size_t num_fields = bf.size() ;
+    const size_t num_hits   = 1000000 ;
+
+    test( StaticCoder::matches( bf ), true , " static layout matches the encoding string" );
+    test( StaticCoder::matches( BitFieldCoder("system:5,side:2,layer:9,module:8,sensor:8,x:32:-16,y:-16") ),
+          false , " static layout does not match a modified encoding string" );
+
+    // random cell IDs with all fields in range
+    mt19937_64 rndm( 4711 ) ;
+    vector<long64> ids( num_hits ) ;
+    for( auto& id : ids ) {
+      id = 0 ;
+      for( size_t j=0; j<num_fields; ++j ) {
+        const BitFieldElement& f = bf[ unsigned(j) ] ;
+        long64 range = ( 1LL << f.width() ) ;
+        long64 val   = long64( rndm() % ulong64(range) ) + ( f.isSigned() ? f.minValue() : 0 ) ;
+        bf.set( id, j, val ) ;
+      }
+    }
+
+    // reference: one call per field and hit
+    vector<vector<long64> > ref( num_fields, vector<long64>( num_hits ) ) ;
+    auto start = chrono::high_resolution_clock::now() ;
+    for( size_t i=0; i<num_hits; ++i )
+      for( size_t j=0; j<num_fields; ++j )
+        ref[j][i] = bf.get( ids[i], j ) ;
+    double t_single = seconds( start ) ;
+
+    // bulk decoding through the runtime coder
+    vector<vector<long64> > columns ;
+    bf.decode( ids, columns ) ;   // allocate the columns outside the timing
+    start = chrono::high_resolution_clock::now() ;
+    bf.decode( ids, columns ) ;
+    double t_bulk = seconds( start ) ;
+    test( columns == ref, true , " bulk decoding identical to BitFieldCoder::get" );
+
+    // bulk decoding with the compile time layout
+    vector<vector<long64> > static_columns( num_fields, vector<long64>( num_hits ) ) ;
+    vector<long64*> cols ;
+    for( auto& c : static_columns ) cols.push_back( c.data() ) ;
+    start = chrono::high_resolution_clock::now() ;
+    StaticCoder::decode( ids.data(), num_hits, cols.data() ) ;
+    double t_static = seconds( start ) ;
+    test( static_columns == ref, true , " static bulk decoding identical to BitFieldCoder::get" );
+    test( StaticCoder::get<5>( ids[0] ), bf.get( ids[0], "x" ) , " static single field access" );
+
+    // encoding back
+    vector<long64> encoded ;
+    start = chrono::high_resolution_clock::now() ;
+    bf.encode( columns, encoded ) ;
+    double t_encode = seconds( start ) ;
+    test( encoded == ids, true , " bulk encoding restores the cell IDs" );
+
+    vector<long64> static_encoded( num_hits ) ;
+    vector<const long64*> ccols( cols.begin(), cols.end() ) ;
+    StaticCoder::encode( static_encoded.data(), num_hits, ccols.data() ) ;
+    test( static_encoded == ids, true , " static bulk encoding restores the cell IDs" );
+
+    // out of range values must be rejected
+    columns[2][num_hits/2] = 1000 ;
+    bool caught = false ;
+    try {
+      bf.encode( columns, encoded ) ;
+    } catch( const exception& ) {
+      caught = true ;
+    }
+    test( caught, true , " bulk encoding rejects values out of range" );
+
+    stringstream s ;
+    s << " decoding of " << num_hits << " cell IDs with " << num_fields << " fields:"
+      << " get: " << t_single << " s,"
+      << " bulk: " << t_bulk << " s,"
+      << " static bulk: " << t_static << " s,"
+      << " bulk encoding: " << t_encode << " s" ;
+    test.log( s.str() ) ;
+
+    // --------------------------------------------------------------------
+
+
+  } catch( exception &e ){
+    //} catch( ... ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
@@ -26,6 +26,8 @@
 #include "EVENT/SimCalorimeterHit.h"
 
 #include <sstream>
+#include <chrono>
+#include <thread>
 
 using namespace std ;
 using namespace dd4hep ;
@@ -101,6 +103,11 @@ int main_wrapper(int argc, char** argv ){
   
   TestMap tMap ;
 
+  // all cellIDs of the tested collections for the batch conversion benchmark
+  std::vector<CellID> allIDs ;
+  // all hit positions of the tested collections for the multi-threaded cellID benchmark
+  std::vector<Position> allPoints ;
+
   while( ( evt = rdr->readNextEvent() ) != 0 ){
 
     const std::vector< std::string >& colNames = *evt->getCollectionNames() ;
@@ -127,6 +134,12 @@ int main_wrapper(int argc, char** argv ){
       dd4hep::BitFieldCoder idDecoder0( cellIDEcoding ) ;
       dd4hep::BitFieldCoder idDecoder1( cellIDEcoding ) ;
 
+      for(int i=0, n=col->getNumberOfElements() ; i<n ; ++i){
+        SimCalorimeterHit* sHit = (SimCalorimeterHit*) col->getElementAt(i) ;
+        allIDs.push_back( idDecoder0.toLong( sHit->getCellID0() , sHit->getCellID1() ) ) ;
+        allPoints.push_back( Position( sHit->getPosition()[0]* dd4hep::mm , sHit->getPosition()[1]* dd4hep::mm ,  sHit->getPosition()[2]* dd4hep::mm ) ) ;
+      }
+
       int nHit = std::min( col->getNumberOfElements(), maxHit )  ;
      
       
@@ -176,6 +189,72 @@ int main_wrapper(int argc, char** argv ){
     
   }
 
+  // ====== benchmark batch conversion positions() against per-cell position() ========================
+
+  std::vector<Position> scalarPos( allIDs.size() ), batchPos( allIDs.size() ) ;
+
+  auto start = std::chrono::steady_clock::now() ;
+  for(size_t i=0 ; i<allIDs.size() ; ++i)
+    scalarPos[i] = idposConv.position( allIDs[i] ) ;
+  auto stop = std::chrono::steady_clock::now() ;
+  double tScalar = std::chrono::duration<double>( stop - start ).count() ;
+
+  start = std::chrono::steady_clock::now() ;
+  idposConv.positions( allIDs.data(), allIDs.size(), batchPos.data() ) ;
+  stop = std::chrono::steady_clock::now() ;
+  double tBatch = std::chrono::duration<double>( stop - start ).count() ;
+
+  unsigned batchFailed = 0 ;
+  for(size_t i=0 ; i<allIDs.size() ; ++i){
+    if( dist( scalarPos[i], batchPos[i] ) > epsilon )
+      ++batchFailed ;
+  }
+  std::stringstream sst2 ;
+  sst2 << " batch positions() of " << allIDs.size() << " cells: failed " << batchFailed ;
+  test( batchFailed , 0u , sst2.str() ) ;
+
+  printf(" position():  %10zu cells in %8.3f s  \n", allIDs.size(), tScalar ) ;
+  printf(" positions(): %10zu cells in %8.3f s  speedup: %6.2f \n", allIDs.size(), tBatch,
+         tBatch > 0. ? tScalar/tBatch : 0. ) ;
+
+  // ====== benchmark concurrent cellID(position) with per-thread navigators ==========================
+
+  unsigned nThreads = std::max( 2u, std::min( 8u, std::thread::hardware_concurrency() ) ) ;
+  std::vector<CellID> serialIDs( allPoints.size() ), threadIDs( allPoints.size() ) ;
+
+  start = std::chrono::steady_clock::now() ;
+  for(size_t i=0 ; i<allPoints.size() ; ++i)
+    serialIDs[i] = idposConv.cellID( allPoints[i] ) ;
+  stop = std::chrono::steady_clock::now() ;
+  double tSerial = std::chrono::duration<double>( stop - start ).count() ;
+
+  idposConv.setMaxThreads( nThreads ) ;
+  std::vector<std::thread> workers ;
+  start = std::chrono::steady_clock::now() ;
+  for(unsigned t=0 ; t<nThreads ; ++t){
+    workers.emplace_back( [&idposConv, &allPoints, &threadIDs, t, nThreads](){
+	for(size_t i=t ; i<allPoints.size() ; i+=nThreads)
+	  threadIDs[i] = idposConv.cellID( allPoints[i] ) ;
+      } ) ;
+  }
+  for( auto& w : workers )
+    w.join() ;
+  stop = std::chrono::steady_clock::now() ;
+  double tThreads = std::chrono::duration<double>( stop - start ).count() ;
+
+  unsigned threadFailed = 0 ;
+  for(size_t i=0 ; i<allPoints.size() ; ++i){
+    if( serialIDs[i] != threadIDs[i] )
+      ++threadFailed ;
+  }
+  std::stringstream sst3 ;
+  sst3 << " concurrent cellID() of " << allPoints.size() << " points with " << nThreads << " threads: failed " << threadFailed ;
+  test( threadFailed , 0u , sst3.str() ) ;
+
+  printf(" cellID():    %10zu points in %8.3f s  (1 thread) \n", allPoints.size(), tSerial ) ;
+  printf(" cellID():    %10zu points in %8.3f s  (%u threads) speedup: %6.2f \n", allPoints.size(), tThreads,
+         nThreads, tThreads > 0. ? tSerial/tThreads : 0. ) ;
+
   // print summary
 
   std::cout << "\n ----------------------- summary  ----------------------   " << std::endl ;
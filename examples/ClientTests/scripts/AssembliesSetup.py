@@ -0,0 +1,56 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import, unicode_literals
+import os
+import time
+import DDG4
+from g4units import GeV, mm, cm
+"""
+
+   dd4hep example setup of the Assemblies geometry with the VXD tracker
+   used to test the Geant4 geometry construction
+
+   \author  M.Frank
+   \version 1.0
+
+"""
+
+
+class Setup:
+  def __init__(self, geometry=None, batch=False):
+    if not geometry:
+      geometry = os.environ['DD4hepExamplesINSTALL'] + "/examples/ClientTests/compact/Assemblies.xml"
+    self.kernel = DDG4.Kernel()
+    self.kernel.loadGeometry(str("file:" + geometry))
+    self.geant4 = DDG4.Geant4(self.kernel, tracker='Geant4TrackerCombineAction')
+    self.geant4.printDetectors()
+    # Configure UI
+    self.geant4.setupCshUI()
+    if batch:
+      self.kernel.UI = ''
+    # Configure G4 geometry setup
+    seq, self.construction = self.geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+
+  def run(self, output, num_events=2):
+    # Configure I/O
+    self.geant4.setupROOTOutput('RootOutput', output + '_' + time.strftime('%Y-%m-%d_%H-%M'), mc_truth=False)
+    # Setup particle gun
+    self.geant4.setupGun("Gun", particle='e-', energy=2 * GeV,
+                         position=(0.15 * mm, 0.12 * mm, 0.1 * cm), multiplicity=1)
+    # First the tracking detectors
+    seq, act = self.geant4.setupTracker('VXD')
+    # Now build the physics list:
+    phys = self.kernel.physicsList()
+    phys.extends = 'QGSP_BERT'
+    phys.enableUI()
+    phys.dump()
+    self.geant4.execute(num_events=num_events)
+    return self
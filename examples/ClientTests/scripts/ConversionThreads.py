@@ -0,0 +1,77 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import, unicode_literals
+import os
+import re
+import sys
+import AssembliesSetup
+#
+"""
+   dd4hep example to test the concurrent conversion of the solids to Geant4
+
+   The converted Geant4 geometry is written to GDML. With -reference the
+   GDML file is compared to the one of another conversion, e.g. with one
+   thread. The pointer values appended to the names by the GDML writer
+   are ignored.
+
+   Usage:
+     python ConversionThreads.py [-threads <number>] [-gdml <file>] [-reference <file>] [batch]
+
+     -threads   <number>   Number of threads converting the solids (default: 4)
+     -gdml      <file>     GDML file of the Geant4 geometry (default: ConversionThreads_<threads>.gdml)
+     -reference <file>     GDML file of another conversion to compare with
+
+   \author  M.Frank
+   \version 1.0
+
+"""
+
+
+def geometry(gdml_file):
+  with open(gdml_file) as f:
+    return re.sub(r'0x[0-9a-fA-F]+', '', f.read())
+
+
+def run():
+  threads = 4
+  gdml = None
+  reference = None
+  batch = False
+  for i in range(len(sys.argv)):
+    if sys.argv[i] == '-threads':
+      threads = int(sys.argv[i + 1])
+    elif sys.argv[i] == '-gdml':
+      gdml = sys.argv[i + 1]
+    elif sys.argv[i] == '-reference':
+      reference = sys.argv[i + 1]
+    elif sys.argv[i] == 'batch':
+      batch = True
+  if not gdml:
+    gdml = 'ConversionThreads_%d.gdml' % (threads,)
+  # The GDML writer refuses to overwrite existing files
+  if os.path.exists(gdml):
+    os.remove(gdml)
+
+  m = AssembliesSetup.Setup(batch=batch)
+  m.construction.ConversionThreads = threads
+  m.construction.DumpGDML = gdml
+  m.run('ConversionThreads')
+
+  if reference:
+    if geometry(gdml) == geometry(reference):
+      print('+++ Geant4 geometry of %d threads identical to the reference %s' % (threads, reference))
+    else:
+      print('+++ ERROR: Geant4 geometry of %d threads differs from the reference %s' % (threads, reference))
+      sys.exit(1)
+
+
+if __name__ == "__main__":
+  run()
@@ -0,0 +1,67 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import, unicode_literals
+import os
+import re
+import sys
+import shutil
+import AssembliesSetup
+#
+"""
+   dd4hep example to test the Geant4 geometry cache
+
+   Usage:
+     python GeometryCache.py -cache <directory> [-clean] [-readout <id-spec>] [batch]
+
+     -cache   <directory>  Directory of the geometry cache
+     -clean                Remove the cache directory before the run
+     -readout <id-spec>    Use a modified readout descriptor for the VXD
+
+   \author  M.Frank
+   \version 1.0
+
+"""
+
+
+def run():
+  install_dir = os.environ['DD4hepExamplesINSTALL']
+  geometry = install_dir + "/examples/ClientTests/compact/Assemblies.xml"
+  cache = 'GeometryCache'
+  readout = None
+  batch = False
+  clean = False
+  for i in range(len(sys.argv)):
+    if sys.argv[i] == '-cache':
+      cache = sys.argv[i + 1]
+    elif sys.argv[i] == '-readout':
+      readout = sys.argv[i + 1]
+    elif sys.argv[i] == '-clean':
+      clean = True
+    elif sys.argv[i] == 'batch':
+      batch = True
+
+  if clean and os.path.exists(cache):
+    shutil.rmtree(cache)
+  if readout:
+    # Same geometry, but the volume identifiers of the VXD are encoded differently
+    with open(geometry) as f:
+      compact = re.sub(r'<id>.*</id>', '<id>' + readout + '</id>', f.read())
+    geometry = 'GeometryCache_readout.xml'
+    with open(geometry, 'w') as f:
+      f.write(compact)
+
+  m = AssembliesSetup.Setup(geometry, batch)
+  m.construction.GeometryCache = cache
+  m.run('GeometryCache')
+
+
+if __name__ == "__main__":
+  run()
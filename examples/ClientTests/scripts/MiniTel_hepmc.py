@@ -18,6 +18,9 @@ import DDG4
    dd4hep example setup using the python configuration
    and reading a HepEvt event
 
+   Usage:
+     python MiniTel_hepmc.py [batch] [-events <number>] [-output <file name>]
+
    \author  M.Frank
    \version 1.0
 
@@ -30,14 +33,24 @@ def run():
   if len(sys.argv) >= 2 and sys.argv[1] == "batch":
     DDG4.setPrintLevel(DDG4.OutputLevel.WARNING)
     m.kernel.UI = ''
+  num_events = 1
+  output = None
+  for i in range(len(sys.argv) - 1):
+    if sys.argv[i] == '-events':
+      num_events = int(sys.argv[i + 1])
+    elif sys.argv[i] == '-output':
+      output = sys.argv[i + 1]
   m.configure()
-  m.defineOutput()
+  if output:
+    m.defineOutput(output)
+  else:
+    m.defineOutput()
   fname = os.environ['DD4hepExamplesINSTALL'] + '/examples/DDG4/data/Muons10GeV.HEPEvt'
   m.setupInput("Geant4EventReaderHepEvtShort|" + fname)
   m.setupGenerator()
   m.setupPhysics(model='FTFP_BERT')
   m.phys.decays = True
-  m.run(num_events=1)
+  m.run(num_events=num_events)
 
 
 if __name__ == "__main__":
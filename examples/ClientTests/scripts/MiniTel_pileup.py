@@ -0,0 +1,55 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import, unicode_literals
+import os
+import sys
+import DDG4
+from g4units import mm, ns
+#
+"""
+
+   dd4hep example setup using the python configuration:
+   a HepEvt signal event overlaid with minimum bias events
+   from the in-memory pool of the Geant4InteractionPileup action
+
+   \author  M.Frank
+   \version 1.0
+
+"""
+
+
+def run():
+  from MiniTelSetup import Setup
+  m = Setup()
+  if len(sys.argv) >= 2 and sys.argv[1] == "batch":
+    m.kernel.UI = ''
+  m.configure()
+  m.defineOutput()
+  data = os.environ['DD4hepExamplesINSTALL'] + '/examples/DDG4/data/'
+  signal = DDG4.GeneratorAction(m.kernel, "Geant4InputAction/Input")
+  signal.Input = "Geant4EventReaderHepEvtShort|" + data + 'Muons10GeV.HEPEvt'
+  signal.MomentumScale = 1.0
+  signal.Mask = 1
+  pileup = DDG4.GeneratorAction(m.kernel, "Geant4InteractionPileup/Pileup")
+  pileup.Input = "Geant4EventReaderHepMC|" + data + 'LHCb_MinBias_HepMC.txt'
+  pileup.PoolSize = 100
+  pileup.MeanPileup = 2.0
+  pileup.MomentumScale = 1.0
+  pileup.Mask = 2
+  pileup.Sigma = (0.01 * mm, 0.01 * mm, 5 * mm, 0.1 * ns)
+  m.geant4.buildInputStage([signal, pileup])
+  m.setupGenerator()
+  m.setupPhysics(model='FTFP_BERT')
+  m.run(num_events=3)
+
+
+if __name__ == "__main__":
+  run()
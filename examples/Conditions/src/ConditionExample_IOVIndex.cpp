@@ -0,0 +1,144 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+/*
+   Plugin invocation:
+   ==================
+   This plugin behaves like a main program.
+   Invoke the plugin with something like this:
+
+   geoPluginRun -destroy -plugin DD4hep_ConditionExample_IOVIndex \
+   -iovs 1000000 -queries 200 -overlaps 1000
+
+   Benchmark of the IOV index used by the ConditionsIOVPool.
+   A synthetic history of run-like IOVs of random length is created in
+   increasing order. In addition long-lived IOVs spanning many runs are
+   registered out of order. Random validity requests are then resolved
+   by a linear scan of all IOVs and by the index.
+   Checks:
+   - both methods return the identical set of IOVs.
+
+*/
+// Framework include files
+#include "DDCond/ConditionsIOVPool.h"
+#include "DD4hep/Factories.h"
+#include "DD4hep/Printout.h"
+#include "TTimeStamp.h"
+#include "TRandom3.h"
+
+#include <map>
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::cond;
+
+/// Plugin function: IOV index benchmark
+/**
+ *  Factory: DD4hep_ConditionExample_IOVIndex
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \date    01/12/2016
+ */
+static int condition_example (Detector& /* description */, int argc, char** argv)  {
+  long   num_iov = 1000000, num_queries = 200, num_overlaps = 1000;
+  bool   arg_error = false;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-iovs",argv[i],4) )
+      num_iov = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-queries",argv[i],4) )
+      num_queries = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-overlaps",argv[i],4) )
+      num_overlaps = ::atol(argv[++i]);
+    else
+      arg_error = true;
+  }
+  if ( arg_error || num_iov < 1 || num_queries < 1 || num_overlaps < 0 )   {
+    /// Help printout describing the basic command line interface
+    cout <<
+      "Usage: -plugin <name> -arg [-arg]                                             \n"
+      "     name:   factory name     DD4hep_ConditionExample_IOVIndex                \n"
+      "     -iovs     <number>       Number of IOVs in the synthetic history.        \n"
+      "     -queries  <number>       Number of random validity requests.             \n"
+      "     -overlaps <number>       Number of long-lived IOVs inserted out of order.\n"
+      "\tArguments given: " << arguments(argc,argv) << endl << flush;
+    ::exit(EINVAL);
+  }
+
+  /******************** Create the synthetic IOV history ******************/
+  typedef map<IOV::Key, shared_ptr<ConditionsPool> > Elements;
+  Elements           elements;
+  ConditionsIOVIndex index;
+  TRandom3           rndm(12345);
+  IOV::Key_value_type run = 1;
+  TTimeStamp start;
+  for(long i=0; i<num_iov; ++i)  {
+    IOV::Key_value_type len = 1 + IOV::Key_value_type(rndm.Integer(100));
+    auto r = elements.emplace(IOV::Key(run, run+len-1), shared_ptr<ConditionsPool>());
+    index.insert(&(*r.first));
+    run += len;
+  }
+  for(long i=0; i<num_overlaps; ++i)  {
+    IOV::Key_value_type lower = 1 + IOV::Key_value_type(rndm.Rndm()*double(run));
+    IOV::Key_value_type len   = 1 + IOV::Key_value_type(rndm.Integer(100000));
+    auto r = elements.emplace(IOV::Key(lower, lower+len), shared_ptr<ConditionsPool>());
+    if ( r.second ) index.insert(&(*r.first));
+  }
+  TTimeStamp stop;
+  printout(INFO,"IOVIndex","+  Created %ld IOVs [%ld runs] in %8.3f sec.",
+           long(index.size()), long(run-1), stop.AsDouble()-start.AsDouble());
+
+  /******************** Resolve random requests ***************************/
+  vector<IOV::Key> queries;
+  for(long i=0; i<num_queries; ++i)  {
+    IOV::Key_value_type lower = 1 + IOV::Key_value_type(rndm.Rndm()*double(run-1));
+    IOV::Key_value_type len   = IOV::Key_value_type(rndm.Integer(10));
+    queries.emplace_back(lower, lower+len);
+  }
+  vector<vector<const ConditionsIOVIndex::Entry*> > linear(queries.size()), indexed(queries.size());
+  TTimeStamp start_linear;
+  for(size_t i=0; i<queries.size(); ++i)  {
+    for( const auto& e : elements )
+      if ( IOV::key_contains_range(e.first, queries[i]) ) linear[i].push_back(&e);
+  }
+  TTimeStamp stop_linear;
+  for(size_t i=0; i<queries.size(); ++i)
+    index.containing(queries[i], indexed[i]);
+  TTimeStamp stop_index;
+
+  long num_bad = 0, num_hits = 0;
+  for(size_t i=0; i<queries.size(); ++i)  {
+    num_hits += long(linear[i].size());
+    if ( linear[i] != indexed[i] )  {
+      printout(ERROR,"IOVIndex","Request [%lld,%lld]: linear scan: %ld IOVs, index: %ld IOVs",
+               (long long)queries[i].first, (long long)queries[i].second,
+               long(linear[i].size()), long(indexed[i].size()));
+      ++num_bad;
+    }
+  }
+  double t_linear = stop_linear.AsDouble()-start_linear.AsDouble();
+  double t_index  = stop_index.AsDouble()-stop_linear.AsDouble();
+  printout(INFO,"IOVIndex",
+           "+======= Summary: # of IOV: %8ld  # of Requests: %6ld ================",
+           long(index.size()), long(queries.size()));
+  printout(INFO,"IOVIndex","+  Linear scan: %10.6f sec  [%10.3f us/request]",
+           t_linear, 1e6*t_linear/double(queries.size()));
+  printout(INFO,"IOVIndex","+  Index:       %10.6f sec  [%10.3f us/request]  Hits: %ld",
+           t_index, 1e6*t_index/double(queries.size()), num_hits);
+  bool ok = num_bad == 0;
+  printout(ok ? ALWAYS : ERROR,"IOVIndex","+  Test %s", ok ? "PASSED" : "FAILED");
+  // All done.
+  return 1;
+}
+
+// first argument is the type from the xml file
+DECLARE_APPLY(DD4hep_ConditionExample_IOVIndex,condition_example)
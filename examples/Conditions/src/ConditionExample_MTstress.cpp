@@ -0,0 +1,202 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+/*
+   Plugin invocation:
+   ==================
+   This plugin behaves like a main program.
+   Invoke the plugin with something like this:
+
+   geoPluginRun -volmgr -destroy -plugin DD4hep_ConditionExample_MTstress \
+   -input file:${DD4hep_DIR}/examples/AlignDet/compact/Telescope.xml    \
+   -iovs 10 -threads 16 -events 200
+
+   Populate the conditions store by hand for a set of IOVs.
+   Then let many threads prepare their slices simultaneously for randomly
+   chosen, hence heavily overlapping, IOVs.
+   Checks:
+   - no slice misses any conditions,
+   - the derived conditions of each IOV were computed exactly once,
+     i.e. no conditions were registered twice by competing threads.
+
+*/
+// Framework include files
+#include "ConditionExampleObjects.h"
+#include "DDCond/ConditionsIOVPool.h"
+#include "DDCond/ConditionsManagerObject.h"
+#include "DD4hep/Factories.h"
+#include "TTimeStamp.h"
+#include "TRandom3.h"
+
+#include <set>
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <thread>
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::ConditionExamples;
+
+namespace {
+
+  /// Shared test status of all worker threads
+  struct StressStatus  {
+    /// Protection for the set of accessed IOVs
+    mutex            guard;
+    /// Set of all IOV values prepared at least once
+    set<long>        used_iovs;
+    /// Number of slice preparations
+    atomic<long>     num_prepare {0};
+    /// Number of incomplete slices
+    atomic<long>     num_failed  {0};
+    /// Number of derived conditions computed
+    atomic<long>     num_computed {0};
+  };
+
+  /// Worker thread: prepare slices for randomly chosen IOVs
+  void stress_worker(ConditionsManager manager, const IOVType* typ,
+                     const ConditionsSlice& proto, shared_future<void> go,
+                     int id, int num_events, int num_iov, StressStatus& status)
+  {
+    ConditionsSlice slice(proto);
+    TRandom3 rndm(1000+id);
+    go.wait();
+    for(int i=0; i<num_events; ++i)  {
+      long run = 1 + long(rndm.Integer(num_iov*10));
+      IOV  iov(typ, run);
+      ConditionsManager::Result res = manager.prepare(iov, slice);
+      status.num_computed += res.computed;
+      ++status.num_prepare;
+      if ( res.missing != 0 )  {
+        ++status.num_failed;
+        printout(ERROR,"MTstress","Thread:%3d Incomplete slice for %s: "
+                 "%ld conditions (S:%6ld,L:%6ld,C:%6ld,M:%ld)",
+                 id, iov.str().c_str(), res.total(), res.selected, res.loaded,
+                 res.computed, res.missing);
+      }
+      lock_guard<mutex> lock(status.guard);
+      status.used_iovs.insert((run-1)/10);
+    }
+  }
+}
+
+/// Plugin function: Multi-threaded conditions slice preparation stress test
+/**
+ *  Factory: DD4hep_ConditionExample_MTstress
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \date    01/12/2016
+ */
+static int condition_example (Detector& description, int argc, char** argv)  {
+  string input;
+  int    num_iov = 10, num_threads = 16, num_events = 200;
+  bool   arg_error = false;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-input",argv[i],4) )
+      input = argv[++i];
+    else if ( 0 == ::strncmp("-iovs",argv[i],4) )
+      num_iov = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-threads",argv[i],4) )
+      num_threads = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-events",argv[i],4) )
+      num_events = ::atol(argv[++i]);
+    else
+      arg_error = true;
+  }
+  if ( arg_error || input.empty() || num_iov < 1 || num_threads < 1 )   {
+    /// Help printout describing the basic command line interface
+    cout <<
+      "Usage: -plugin <name> -arg [-arg]                                             \n"
+      "     name:   factory name     DD4hep_ConditionExample_MTstress                \n"
+      "     -input   <string>        Geometry file                                   \n"
+      "     -iovs    <number>        Number of IOV slots to choose from.             \n"
+      "     -threads <number>        Number of concurrent execution threads.         \n"
+      "     -events  <number>        Number of slice preparations per thread.        \n"
+      "\tArguments given: " << arguments(argc,argv) << endl << flush;
+    ::exit(EINVAL);
+  }
+
+  // First we load the geometry
+  description.fromXML(input);
+
+  /******************** Initialize the conditions manager *****************/
+  ConditionsManager manager = installManager(description);
+  const IOVType*    iov_typ = manager.registerIOVType(0,"run").second;
+  if ( 0 == iov_typ )
+    except("ConditionsPrepare","++ Unknown IOV type supplied.");
+
+  /******************** Now as usual: create the slice ********************/
+  shared_ptr<ConditionsContent> content(new ConditionsContent());
+  shared_ptr<ConditionsSlice>   slice(new ConditionsSlice(manager,content));
+  Scanner(ConditionsKeys(*content,INFO),description.world());
+  Scanner(ConditionsDependencyCreator(*content,DEBUG),description.world());
+
+  /******************** Populate the conditions store *********************/
+  // Have e.g. 10 run-slices [1,10], [11,20] .... [91,100]
+  long num_created = 0;
+  for(int i=0; i<num_iov; ++i)  {
+    IOV iov(iov_typ, IOV::Key(1+i*10,(i+1)*10));
+    ConditionsPool* pool = manager.registerIOV(*iov.iovType, iov.key());
+    num_created = Scanner().scan(ConditionsCreator(*slice, *pool, DEBUG),description.world());
+  }
+
+  // ++++++++++++++++++++++++ Now let all threads prepare slices at the same time
+  StressStatus        status;
+  promise<void>       start_signal;
+  shared_future<void> go(start_signal.get_future());
+  vector<thread>      threads;
+  for(int i=0; i<num_threads; ++i)  {
+    threads.emplace_back(stress_worker, manager, iov_typ, cref(*slice), go,
+                         i, num_events, num_iov, ref(status));
+  }
+  TTimeStamp start;
+  start_signal.set_value();
+  for(auto& t : threads) t.join();
+  TTimeStamp stop;
+
+  /******************** Check the content of the IOV pools ****************/
+  // Each IOV pool must contain the created conditions plus the derived
+  // conditions exactly once if the IOV was requested by any thread.
+  long num_derived = long(content->derived().size());
+  long num_bad_pools = 0;
+  ConditionsIOVPool* iov_pool = manager.iovPool(*iov_typ);
+  for( const auto& e : iov_pool->elements )  {
+    long idx = long(e.first.first-1)/10;
+    long expected = num_created + (status.used_iovs.count(idx) ? num_derived : 0);
+    if ( long(e.second->size()) != expected )  {
+      printout(ERROR,"MTstress","Pool %s has %ld conditions. Expected: %ld",
+               e.second->iov->str().c_str(), long(e.second->size()), expected);
+      ++num_bad_pools;
+    }
+  }
+  long num_expected_computed = long(status.used_iovs.size())*num_derived;
+  if ( status.num_computed != num_expected_computed )  {
+    printout(ERROR,"MTstress","Computed %ld derived conditions. Expected: %ld",
+             status.num_computed.load(), num_expected_computed);
+  }
+  printout(INFO,"MTstress",
+           "+======= Summary: # of IOV: %3d  # of Threads: %3d ========================",
+           num_iov, num_threads);
+  printout(INFO,"MTstress","+  Prepared %ld slices [%ld failed] for %ld IOVs in %8.3f sec. Computed:%ld",
+           status.num_prepare.load(), status.num_failed.load(), long(status.used_iovs.size()),
+           stop.AsDouble()-start.AsDouble(), status.num_computed.load());
+  bool ok = status.num_failed == 0 && num_bad_pools == 0 &&
+    status.num_computed == num_expected_computed;
+  printout(ok ? ALWAYS : ERROR,"MTstress","+  Test %s", ok ? "PASSED" : "FAILED");
+  // All done.
+  return 1;
+}
+
+// first argument is the type from the xml file
+DECLARE_APPLY(DD4hep_ConditionExample_MTstress,condition_example)
@@ -33,6 +33,85 @@ using namespace std;
 using namespace dd4hep;
 using namespace dd4hep::ConditionExamples;
 
+namespace {
+
+  /// Conditions of detector elements with odd keys get a narrower IOV
+  bool narrow_iov(DetElement de)   {
+    return (de.key() & 1) != 0;
+  }
+
+  /// Derived condition, which only reads another derived condition
+  /**
+   *  The IOV of the result must be taken from the derived input.
+   */
+  class ConditionUpdateIOV : public ConditionUpdateCall  {
+  public:
+    /// Interface to client Callback in order to update the condition
+    virtual Condition operator()(const ConditionKey& key, ConditionUpdateContext& context) override  final  {
+#ifdef DD4HEP_CONDITIONS_DEBUG
+      Condition target(key.name,"derived");
+#else
+      Condition target(key.hash);
+#endif
+      Condition input = context.condition(context.key(0));
+      target.bind<int>() = int(input.get<vector<int> >().size());
+      return target;
+    }
+  };
+
+  /// Add the dependency of the IOV check to each detector element
+  struct IOVDependencyCreator  {
+    ConditionsContent& content;
+    shared_ptr<ConditionUpdateCall> call { new ConditionUpdateIOV() };
+    IOVDependencyCreator(ConditionsContent& c) : content(c)  {}
+    int operator()(DetElement de, int)  const  {
+      cond::DependencyBuilder build(de, ConditionKey(de,"derived_data/derived_iov").item_key(), call);
+      build.add(ConditionKey(de,"derived_data/derived_1"));
+      content.addDependency(build.release());
+      return 1;
+    }
+  };
+
+  /// Create the conditions of every detector element in the wide or the narrow IOV pool
+  struct SplitIOVCreator  {
+    ConditionsSlice& slice;
+    ConditionsPool&  wide;
+    ConditionsPool&  narrow;
+    SplitIOVCreator(ConditionsSlice& s, ConditionsPool& w, ConditionsPool& n)
+      : slice(s), wide(w), narrow(n)  {}
+    int operator()(DetElement de, int level)  const  {
+      return ConditionsCreator(slice, narrow_iov(de) ? narrow : wide, DEBUG)(de, level);
+    }
+  };
+
+  /// Check that the derived conditions carry the IOV of their inputs
+  struct IOVChecker  {
+    ConditionsSlice& slice;
+    IOV::Key         wide;
+    IOV::Key         narrow;
+    size_t&          checked;
+    size_t&          errors;
+    IOVChecker(ConditionsSlice& s, const IOV::Key& w, const IOV::Key& n, size_t& c, size_t& e)
+      : slice(s), wide(w), narrow(n), checked(c), errors(e)  {}
+    int operator()(DetElement de, int)  const  {
+      static const char* items[] = { "derived_data/derived_1", "derived_data/derived_2",
+                                     "derived_data/derived_3", "derived_data/derived_iov" };
+      const IOV::Key& expected = narrow_iov(de) ? narrow : wide;
+      for( const char* item : items )   {
+        Condition cond = slice.get(de, ConditionKey(de,item).item_key());
+        ++checked;
+        if ( !cond.isValid() || cond.iov().keyData != expected )   {
+          printout(ERROR,"IOVCheck","%s#%s has IOV %s. Expected: [%ld,%ld]",
+                   de.path().c_str(), item, cond.isValid() ? cond.iov().str().c_str() : "[invalid]",
+                   long(expected.first), long(expected.second));
+          ++errors;
+        }
+      }
+      return 1;
+    }
+  };
+}
+
 /// Plugin function: Condition program example
 /**
  *  Factory: DD4hep_ConditionExample_stress2
@@ -43,13 +122,17 @@ using namespace dd4hep::ConditionExamples;
  */
 static int condition_example (Detector& description, int argc, char** argv)  {
   string input;
-  int    num_iov = 10;
-  bool   arg_error = false;
+  int    num_iov = 10, num_threads = 0;
+  bool   arg_error = false, check_iov = false;
   for(int i=0; i<argc && argv[i]; ++i)  {
     if ( 0 == ::strncmp("-input",argv[i],4) )
       input = argv[++i];
     else if ( 0 == ::strncmp("-iovs",argv[i],4) )
       num_iov = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-threads",argv[i],4) )
+      num_threads = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-check",argv[i],4) )
+      check_iov = true;
     else
       arg_error = true;
   }
@@ -60,6 +143,9 @@ static int condition_example (Detector& description, int argc, char** argv)  {
       "     name:   factory name     DD4hep_ConditionExample_stress2                 \n"
       "     -input   <string>        Geometry file                                   \n"
       "     -iovs    <number>        Number of collision loads to be performed.      \n"
+      "     -threads <number>        Number of threads to compute derived conditions.\n"
+      "     -check                   Create inputs with different IOVs and check the \n"
+      "                              IOVs of the derived conditions.                 \n"
       "\tArguments given: " << arguments(argc,argv) << endl << flush;
     ::exit(EINVAL);
   }
@@ -69,6 +155,8 @@ static int condition_example (Detector& description, int argc, char** argv)  {
 
   /******************** Initialize the conditions manager *****************/
   ConditionsManager manager = installManager(description);
+  manager["ComputeThreads"] = num_threads;
+  manager["ComputeTiming"]  = num_threads > 1;
   const IOVType*    iov_typ = manager.registerIOVType(0,"run").second;
   if ( 0 == iov_typ )
     except("ConditionsPrepare","++ Unknown IOV type supplied.");
@@ -78,8 +166,11 @@ static int condition_example (Detector& description, int argc, char** argv)  {
   shared_ptr<ConditionsSlice> slice(new ConditionsSlice(manager,content));
   Scanner(ConditionsKeys(*content,INFO),description.world());
   Scanner(ConditionsDependencyCreator(*content,DEBUG),description.world());
+  if ( check_iov )   {
+    Scanner(IOVDependencyCreator(*content),description.world());
+  }
 
-  size_t total_created = 0;
+  size_t total_created = 0, num_checked = 0, num_errors = 0;
   ConditionsManager::Result total;
   TStatistic cr_stat("Creation"), acc_stat("Access");
   // ++++++++++++++++++++++++ Now compute the conditions for each of these IOVs
@@ -88,8 +179,16 @@ static int condition_example (Detector& description, int argc, char** argv)  {
       TTimeStamp start;
       IOV iov(iov_typ, IOV::Key(1+i*10,(i+1)*10));
       ConditionsPool*   iov_pool = manager.registerIOV(*iov.iovType, iov.key());
+      int count = 0;
       // Create conditions with all deltas. Use a generic creator
-      int count = Scanner().scan(ConditionsCreator(*slice, *iov_pool, DEBUG),description.world());
+      if ( check_iov )   {
+        IOV narrow(iov_typ, IOV::Key(i*10+3,i*10+7));
+        ConditionsPool* narrow_pool = manager.registerIOV(*narrow.iovType, narrow.key());
+        count = Scanner().scan(SplitIOVCreator(*slice, *iov_pool, *narrow_pool),description.world());
+      }
+      else  {
+        count = Scanner().scan(ConditionsCreator(*slice, *iov_pool, DEBUG),description.world());
+      }
       TTimeStamp stop;
       total_created += count;
       cr_stat.Fill(stop.AsDouble()-start.AsDouble());
@@ -107,6 +206,10 @@ static int condition_example (Detector& description, int argc, char** argv)  {
       printout(INFO,"Compute","Total %-6ld conditions (S:%6ld,L:%6ld,C:%6ld,M:%4ld) of type %-25s [%8.3f sec]",
                res.total(), res.selected, res.loaded, res.computed, res.missing,
                req_iov.str().c_str(), stop.AsDouble()-start.AsDouble());
+      if ( check_iov )   {
+        IOVChecker checker(*slice, IOV::Key(1+i*10,(i+1)*10), IOV::Key(i*10+3,i*10+7), num_checked, num_errors);
+        Scanner().scan(checker, description.world());
+      }
     }
   }
   printout(INFO,"Statistics","+======= Summary: # of IOV: %3d ===========================================", num_iov);
@@ -116,6 +219,10 @@ static int condition_example (Detector& description, int argc, char** argv)  {
            acc_stat.GetName(), acc_stat.GetMean(), acc_stat.GetMeanErr(), acc_stat.GetRMS(), acc_stat.GetN());
   printout(INFO,"Statistics","+  Accessed a total of %ld conditions (S:%6ld,L:%6ld,C:%6ld,M:%ld)",
            total.total(), total.selected, total.loaded, total.computed, total.missing, total_created);
+  if ( check_iov )   {
+    printout(INFO,"Statistics","+  Checked the IOVs of %ld derived conditions: %ld mismatches",
+             num_checked, num_errors);
+  }
   printout(INFO,"Statistics","+=========================================================================");
   // All done.
   return 1;
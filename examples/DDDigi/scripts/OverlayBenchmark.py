@@ -0,0 +1,109 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import, unicode_literals
+import os
+import sys
+import time
+import logging
+import DDDigi
+
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+
+"""
+
+   DDDigi overlay benchmark
+
+   Overlays background events on signal events read from DDG4 ROOT files
+   and measures the event throughput. To measure the scaling with the
+   number of threads run it once per thread count:
+
+   $> for n in 1 2 4 8; do
+        python OverlayBenchmark.py -signal sig.root -background bkg.root -mean 20 -bunches 10 -threads $n
+      done
+
+   @author  M.Frank
+   @version 1.0
+
+"""
+
+
+def help():
+  logging.info("OverlayBenchmark.py -option [-option]                                 ")
+  logging.info("       -geometry <file name>    Compact geometry (default: SiD)         ")
+  logging.info("       -signal <file name>      DDG4 ROOT file with signal events       ")
+  logging.info("       -background <file name>  DDG4 ROOT file with background events   ")
+  logging.info("       -mean <number>           Mean background events per bunch        ")
+  logging.info("       -bunches <number>        Bunch crossings before/after the signal ")
+  logging.info("       -pool <number>           Number of background events in the pool ")
+  logging.info("       -events <number>         Number of events to digitize            ")
+  logging.info("       -threads <number>        Number of worker threads                ")
+
+
+def measure(geometry, options, num_threads):
+  kernel = DDDigi.Kernel()
+  kernel.loadGeometry(str("file:" + geometry))
+  digi = DDDigi.Digitize(kernel)
+  inp = digi.setupDDG4Input('Signal', options['signal'])
+  inp.ReadAhead = 2 * max(1, num_threads)
+  sources = {'Background': {'input': options['background'], 'mean': options['mean'], 'pool': options['pool']}}
+  digi.setupOverlay('Overlay', sources,
+                    first_bunch=-options['bunches'], last_bunch=options['bunches'], mask=1)
+  kernel.numThreads = num_threads
+  kernel.maxEventsParallel = max(1, num_threads)
+  kernel.numEvents = options['events']
+  start = time.time()
+  kernel.run()
+  secs = time.time() - start
+  kernel.terminate()
+  return secs
+
+
+def run():
+  install_dir = os.environ['DD4hepINSTALL']
+  geometry = install_dir + "/DDDetectors/compact/SiD.xml"
+  options = {'signal': None, 'background': None, 'mean': 1.0, 'bunches': 0, 'pool': 100, 'events': 100}
+  num_threads = 1
+  hlp = False
+  args = sys.argv[1:]
+  for i in list(range(len(args))):
+    c = args[i].upper()
+    if c[:4] == '-GEO':
+      geometry = args[i + 1]
+    elif c[:4] == '-SIG':
+      options['signal'] = args[i + 1]
+    elif c[:4] == '-BAC':
+      options['background'] = args[i + 1]
+    elif c[:4] == '-MEA':
+      options['mean'] = float(args[i + 1])
+    elif c[:4] == '-BUN':
+      options['bunches'] = int(args[i + 1])
+    elif c[:4] == '-POO':
+      options['pool'] = int(args[i + 1])
+    elif c[:4] == '-EVE':
+      options['events'] = int(args[i + 1])
+    elif c[:4] == '-THR':
+      num_threads = int(args[i + 1])
+    elif c[:2] == '-H':
+      hlp = True
+
+  if hlp or not options['signal'] or not options['background']:
+    help()
+    sys.exit(1)
+
+  DDDigi.setPrintLevel(DDDigi.OutputLevel.INFO)
+  secs = measure(geometry, options, num_threads)
+  logger.info("+++ %3d threads: %d events in %8.2f seconds: %8.2f events/second",
+              num_threads, options['events'], secs, options['events'] / secs)
+
+
+if __name__ == "__main__":
+  run()
@@ -0,0 +1,70 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import, unicode_literals
+import sys
+import DDDigi
+"""
+   Test of the data dependency checks of DDDigi
+
+   Usage:
+     python TestDependencies.py [-conflict]
+
+     -conflict   Two actions executed in parallel write the same event data slot.
+                 The kernel must refuse the configuration.
+
+   \author  M.Frank
+   \version 1.0
+
+"""
+
+
+def run():
+  conflict = '-conflict' in sys.argv
+  DDDigi.setPrintFormat(str('%-32s %5s %s'))
+  kernel = DDDigi.Kernel()
+  # Input: one producer of the event data read by the digitizers
+  producer = DDDigi.TestAction(kernel, 'producer', 10, outputs=['hits'])
+  kernel.inputAction().adopt(producer)
+  # Digitizers executed in parallel
+  event_processor = DDDigi.Synchronize(kernel, 'DigiSynchronize/MainDigitizer', True)
+  event_processor.parallel = True
+  if conflict:
+    writer_1 = DDDigi.TestAction(kernel, 'writer_1', 10, inputs=['hits'], outputs=['digits'])
+    writer_2 = DDDigi.TestAction(kernel, 'writer_2', 10, inputs=['hits'], outputs=['digits'])
+    event_processor.adopt(writer_1)
+    event_processor.adopt(writer_2)
+    consumer = DDDigi.TestAction(kernel, 'consumer', 10, inputs=['digits'])
+  else:
+    reader_1 = DDDigi.TestAction(kernel, 'reader_1', 10, inputs=['hits'], outputs=['digits_1'])
+    reader_2 = DDDigi.TestAction(kernel, 'reader_2', 10, inputs=['hits'], outputs=['digits_2'])
+    event_processor.adopt(reader_1)
+    event_processor.adopt(reader_2)
+    consumer = DDDigi.TestAction(kernel, 'consumer', 10, inputs=['digits_1', 'digits_2'])
+  kernel.eventAction().adopt(event_processor)
+  # Output
+  kernel.outputAction().adopt(consumer)
+
+  kernel.numThreads = 0   # = number of concurrent threads
+  kernel.numEvents = 10
+  kernel.maxEventsParallel = 3
+  try:
+    kernel.run()
+  except Exception as X:
+    if not conflict:
+      raise
+    print('+++ Configuration refused: ' + str(X))
+    return
+  if conflict:
+    print('+++ Conflicting configuration accepted.')
+
+
+if __name__ == '__main__':
+  run()
@@ -0,0 +1,61 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import, unicode_literals
+import os
+import sys
+import DDDigi
+"""
+   Test of the DDDigi background overlay
+
+   Signal and background events are read from the same DDG4 ROOT file.
+   The background events are drawn from a pool and overlaid on the
+   signal for the bunch crossings -1, 0 and +1.
+
+   Usage:
+     python TestOverlay.py -input <DDG4 ROOT file> [-events <number>]
+
+   \author  M.Frank
+   \version 1.0
+
+"""
+
+
+def run():
+  input_file = None
+  num_events = 5
+  for i in range(len(sys.argv) - 1):
+    if sys.argv[i] == '-input':
+      input_file = sys.argv[i + 1]
+    elif sys.argv[i] == '-events':
+      num_events = int(sys.argv[i + 1])
+  if not input_file:
+    print('+++ No input file given. Usage: TestOverlay.py -input <file name> [-events <number>]')
+    sys.exit(2)
+
+  DDDigi.setPrintFormat(str('%-32s %5s %s'))
+  kernel = DDDigi.Kernel()
+  install_dir = os.environ['DD4hepExamplesINSTALL']
+  kernel.loadGeometry(str("file:" + install_dir + "/examples/ClientTests/compact/MiniTel.xml"))
+  digi = DDDigi.Digitize(kernel)
+  digi.setupDDG4Input('Signal', input_file)
+  sources = {'Background': {'input': input_file, 'mean': 2.0, 'pool': 5}}
+  mixer = digi.setupOverlay('Overlay', sources, first_bunch=-1, last_bunch=1, mask=1)
+  mixer.OutputLevel = DDDigi.OutputLevel.DEBUG
+
+  kernel.numThreads = 0   # = number of concurrent threads
+  kernel.numEvents = num_events
+  kernel.maxEventsParallel = 1
+  kernel.run()
+  kernel.terminate()
+
+
+if __name__ == '__main__':
+  run()
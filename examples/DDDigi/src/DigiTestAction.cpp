@@ -16,6 +16,10 @@
 // Framework include files
 #include "DDDigi/DigiEventAction.h"
 
+// C/C++ include files
+#include <vector>
+#include <string>
+
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
 
@@ -39,6 +43,14 @@ namespace dd4hep {
     protected:
       /// Sleep period to fake execution [milliseconds]
       int m_sleep = 0;
+      /// Names of the event data items read
+      std::vector<std::string> m_inputNames;
+      /// Names of the event data items written
+      std::vector<std::string> m_outputNames;
+      /// Event data slots read
+      std::vector<DigiSlot<int> > m_inputSlots;
+      /// Event data slots written
+      std::vector<DigiSlot<int> > m_outputSlots;
     protected:
       /// Define standard assignments and constructors
       DDDIGI_DEFINE_ACTION_CONSTRUCTORS(DigiTestAction);
@@ -48,6 +60,8 @@ namespace dd4hep {
       DigiTestAction(const DigiKernel& kernel, const std::string& nam);
       /// Default destructor
       virtual ~DigiTestAction();
+      /// Declare the event data slots
+      virtual void initialize()  override;
       /// Callback to read event input
       virtual void execute(DigiContext& context)  const override;
     };
@@ -76,6 +90,7 @@ namespace dd4hep {
 //#include "DDDigi/DigiTestAction.h"
 
 // C/C++ include files
+#include <memory>
 
 #ifdef __APPLE__
 static void noop(int) {}
@@ -92,6 +107,8 @@ DigiTestAction::DigiTestAction(const DigiKernel& kernel, const string& nam)
   : DigiEventAction(kernel, nam)
 {
   declareProperty("sleep", m_sleep = 0);
+  declareProperty("inputs", m_inputNames);
+  declareProperty("outputs", m_outputNames);
   InstanceCount::increment(this);
 }
 
@@ -100,9 +117,25 @@ DigiTestAction::~DigiTestAction() {
   InstanceCount::decrement(this);
 }
 
+/// Declare the event data slots
+void DigiTestAction::initialize()   {
+  for( const auto& nam : m_inputNames )
+    m_inputSlots.emplace_back(declareInput<int>(nam));
+  for( const auto& nam : m_outputNames )
+    m_outputSlots.emplace_back(declareOutput<int>(nam));
+  this->DigiEventAction::initialize();
+}
+
 /// Pre-track action callback
 void DigiTestAction::execute(DigiContext& context)  const   {
+  DigiEvent& event = context.event();
+  for( const auto& slot : m_inputSlots )   {
+    if ( event.get(slot) != event.eventNumber )
+      except("+++ Event: %8d Inconsistent event data in slot %d.", event.eventNumber, slot.index);
+  }
   debug("+++ Event: %8d (DigiTestAction)  %d msec",
-       context.event().eventNumber, m_sleep);
+       event.eventNumber, m_sleep);
   if ( m_sleep > 0 ) ::usleep(1000*m_sleep);
+  for( const auto& slot : m_outputSlots )
+    event.put(slot, make_shared<int>(event.eventNumber));
 }
@@ -0,0 +1,161 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+/// Framework include files
+#include <DD4hep/Detector.h>
+#include <DD4hep/Factories.h>
+#include <DD4hep/Printout.h>
+#include <DDDigi/DigiKernel.h>
+#include <DDDigi/DigiContext.h>
+#include <DDDigi/DigiSegmentation.h>
+
+/// C/C++ include files
+#include <algorithm>
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <chrono>
+#include <vector>
+#include <map>
+
+#include <TClass.h>
+
+using namespace dd4hep;
+using namespace dd4hep::digi;
+
+namespace  {
+  /// Sensitive placement with its volume identifier
+  struct sensitive_t  {
+    PlacedVolume placement;
+    VolumeID     vid;
+  };
+  /// Collect all sensitive placements below a given placement
+  void collect(const IDDescriptor& id_desc, PlacedVolume pv, VolumeID vid, std::vector<sensitive_t>& volumes)  {
+    const auto& ids = pv.volIDs();
+    if ( !ids.empty() ) vid |= id_desc.encode(ids);
+    if ( pv.volume().isSensitive() ) volumes.push_back({pv, vid});
+    for( int i = 0, n = pv->GetNdaughters(); i < n; ++i )
+      collect(id_desc, PlacedVolume(pv->GetDaughter(i)), vid, volumes);
+  }
+  double seconds(std::chrono::steady_clock::time_point start)   {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+}
+
+/// Plugin to measure the throughput of the cell scanners for a full detector scan
+/**
+ *  Factory: DD4hep_DigiCellScanner
+ *
+ *  For every sensitive detector with segmentation all cells of all sensitive
+ *  placements are scanned. The cell cache is filled in a first pass, which
+ *  is timed separately.
+ *
+ *  Correctness check (not timed): the position of every scanned cell is
+ *  converted back with Segmentation::cellID and must give the same cell.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ */
+static long test_CellScanner(Detector& description, int argc, char** argv) {
+  std::vector<std::string> detectors;
+  std::size_t repeat = 1;
+  for(int i = 0; i < argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-detector",argv[i],4) )
+      detectors.emplace_back(argv[++i]);
+    else if ( 0 == ::strncmp("-repeat",argv[i],4) )
+      repeat = std::max(1L, ::atol(argv[++i]));
+    else  {
+      std::cout <<
+        "Usage: -plugin DD4hep_DigiCellScanner -arg [-arg]                          \n"
+        "     -detector <name>   Sensitive detector to be scanned [default: all]    \n"
+        "     -repeat   <value>  Number of scans of each detector [default: 1]      \n"
+        "\tArguments given: " << arguments(argc,argv) << std::endl << std::flush;
+      ::exit(EINVAL);
+    }
+  }
+
+  DigiKernel& kernel = DigiKernel::instance(description);
+  DigiContext context(&kernel);
+  std::size_t total_cells = 0;
+  double      total_time  = 0e0;
+  for( const auto& s : description.sensitiveDetectors() )   {
+    SensitiveDetector sd = s.second;
+    std::string nam = sd.name();
+    if ( !detectors.empty() && std::find(detectors.begin(), detectors.end(), nam) == detectors.end() )
+      continue;
+    Segmentation seg = sd.readout().segmentation();
+    DetElement   det = description.detector(nam);
+    if ( !seg.isValid() || !det.isValid() )
+      continue;
+
+    std::vector<sensitive_t> volumes;
+    std::map<const TClass*, std::shared_ptr<DigiCellScanner> > scanners;
+    collect(sd.readout().idSpec(), det.placement(), 0, volumes);
+    try  {
+      auto start = std::chrono::steady_clock::now();
+      for( const auto& v : volumes )   {
+        Solid sol = v.placement.volume().solid();
+        auto& scanner = scanners[sol->IsA()];
+        if ( !scanner ) scanner = create_cell_scanner(sol, seg);
+        scanner->cells(sol, v.vid);
+      }
+      double   cache = seconds(start);
+      CellID   check = 0;
+      std::size_t num_cells = 0;
+      start = std::chrono::steady_clock::now();
+      for( std::size_t r = 0; r < repeat; ++r )   {
+        for( const auto& v : volumes )   {
+          const auto& scanner = scanners[v.placement.volume().solid()->IsA()];
+          scanner->scan(context, v.placement, v.vid,
+                        [&num_cells, &check](DigiContext&, const DigiCellScanner&, const DigiCellData& data)  {
+                          check ^= data.cell_id;
+                          ++num_cells;
+                        });
+        }
+      }
+      double secs = seconds(start);
+      std::size_t num_bad = 0;
+      for( const auto& v : volumes )   {
+        const auto& scanner = scanners[v.placement.volume().solid()->IsA()];
+        scanner->scan(context, v.placement, v.vid,
+                      [&seg, &v, &num_bad](DigiContext&, const DigiCellScanner&, const DigiCellData& data)  {
+                        Position local = seg.position(data.cell_id);
+                        CellID   cell  = seg.cellID(local, local, v.vid);
+                        if ( cell != data.cell_id && ++num_bad <= 10 )   {
+                          printout(ERROR, "DigiCellScanner", "Cell %016llX at (%g, %g, %g) is mapped to cell %016llX",
+                                   (unsigned long long)data.cell_id, local.X(), local.Y(), local.Z(),
+                                   (unsigned long long)cell);
+                        }
+                      });
+      }
+      if ( num_bad > 0 )   {
+        printout(ERROR, "DigiCellScanner", "%-24s %-18s %ld cells fail the position round trip.",
+                 nam.c_str(), seg.type().c_str(), num_bad);
+      }
+      total_cells += num_cells;
+      total_time  += secs;
+      printout(INFO, "DigiCellScanner", "%-24s %-18s %7ld volumes %10ld cells in %8.4f sec: %10.4g cells/sec "
+               "[cache: %8.4f sec, check: %016llX]",
+               nam.c_str(), seg.type().c_str(), volumes.size(), num_cells/repeat, secs,
+               secs > 0e0 ? double(num_cells)/secs : 0e0, cache, (unsigned long long)check);
+    }
+    catch(const std::exception& e)   {
+      printout(WARNING, "DigiCellScanner", "%-24s %-18s Cannot be scanned: %s",
+               nam.c_str(), seg.type().c_str(), e.what());
+    }
+  }
+  printout(ALWAYS, "DigiCellScanner", "+++ Scanned %ld cells in %8.4f sec: %10.4g cells/sec",
+           total_cells, total_time, total_time > 0e0 ? double(total_cells)/total_time : 0e0);
+  return 1;
+}
+DECLARE_APPLY(DD4hep_DigiCellScanner,test_CellScanner)
@@ -0,0 +1,180 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+/// Framework include files
+#include <DD4hep/Factories.h>
+#include <DD4hep/Printout.h>
+#include <DDDigi/Philox.h>
+#include <DDDigi/DigiKernel.h>
+#include <DDDigi/DigiContext.h>
+#include <DDDigi/DigiGaussianNoise.h>
+#include <DDDigi/DigiRandomGenerator.h>
+
+/// C/C++ include files
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <random>
+#include <vector>
+#include <cmath>
+
+using namespace dd4hep;
+using namespace dd4hep::digi;
+
+namespace  {
+  /// Digitization context with its own random generator for stand-alone tests
+  class TestContext : public DigiContext  {
+  public:
+    /// Initializing constructor
+    TestContext(const DigiKernel& kernel, unsigned long seed) : DigiContext(&kernel)  {
+      auto engine = std::make_shared<std::mt19937_64>(seed);
+      auto random = std::make_shared<DigiRandomGenerator>();
+      random->key = seed;
+      random->engine = [engine]()  { return (double((*engine)() >> 11) + 1.0) / 9007199254740992.0; };
+      m_random = std::move(random);
+    }
+  };
+}
+
+/// Plugin to check the counter based random generator against the published known answers
+/**
+ *  Factory: DD4hep_DigiPhilox
+ *
+ *  Known answer of Philox4x32-10 from the Random123 distribution (kat_vectors).
+ *  The generator uses 64 bit counters, hence only the vector with the upper
+ *  counter words zero applies.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ */
+static long test_Philox(Detector& , int argc, char** argv) {
+  struct kat_t  { std::uint64_t counter, key; std::uint32_t result[4]; };
+  static const kat_t kat[] = {
+    { 0x0000000000000000UL, 0x0000000000000000UL, { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 } }
+  };
+  for(int i = 0; i < argc && argv[i]; ++i)  {
+    std::cout <<
+      "Usage: -plugin DD4hep_DigiPhilox                                         \n"
+      "\tArguments given: " << arguments(argc,argv) << std::endl << std::flush;
+    ::exit(EINVAL);
+  }
+  std::size_t num_bad = 0;
+  for( const auto& k : kat )   {
+    std::uint32_t r[4];
+    detail::Philox4x32::generate(k.counter, k.key, r);
+    bool ok = 0 == ::memcmp(r, k.result, sizeof(r));
+    printout(ok ? INFO : ERROR, "Philox",
+             "+++ counter: %016lx key: %016lx -> %08x %08x %08x %08x [expected: %08x %08x %08x %08x]",
+             k.counter, k.key, r[0], r[1], r[2], r[3],
+             k.result[0], k.result[1], k.result[2], k.result[3]);
+    num_bad += ok ? 0 : 1;
+  }
+  if ( num_bad > 0 )   {
+    printout(ERROR, "Philox", "+++ %ld known answer checks FAILED.", num_bad);
+    return 0;
+  }
+  printout(INFO, "Philox", "+++ All known answer checks passed.");
+  return 1;
+}
+DECLARE_APPLY(DD4hep_DigiPhilox,test_Philox)
+
+/// Plugin to check the statistics of the sparse noise generation
+/**
+ *  Factory: DD4hep_DigiSparseNoise
+ *
+ *  Gaussian noise is generated sparsely for channels without signal and the
+ *  result is compared with the expectation of the dense generation:
+ *  - the number of channels above threshold follows the tail probability,
+ *  - the channels are ordered, unique and uniformly distributed,
+ *  - all values are above threshold and their mean is the one of the
+ *    truncated gaussian distribution.
+ *  Deviations of more than 5 standard deviations are reported as errors.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ */
+static long test_SparseNoise(Detector& description, int argc, char** argv) {
+  std::size_t channels  = 1000000;
+  std::size_t trials    = 100;
+  double      threshold = 3.0;
+  for(int i = 0; i < argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-channels",argv[i],3) )
+      channels  = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-trials",argv[i],3) )
+      trials    = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-threshold",argv[i],3) )
+      threshold = ::atof(argv[++i]);
+    else  {
+      std::cout <<
+        "Usage: -plugin DD4hep_DigiSparseNoise -arg [-arg]                        \n"
+        "     -channels  <value>  Number of channels per trial [default: 1000000] \n"
+        "     -trials    <value>  Number of trials [default: 100]                 \n"
+        "     -threshold <value>  Threshold in units of sigma [default: 3]        \n"
+        "\tArguments given: " << arguments(argc,argv) << std::endl << std::flush;
+      ::exit(EINVAL);
+    }
+  }
+  DigiKernel&        kernel = DigiKernel::instance(description);
+  TestContext        context(kernel, 0x5EED5EEDUL);
+  DigiGaussianNoise* noise  = new DigiGaussianNoise(kernel, "SparseNoise");
+  noise->property("sigma").set(1.0);
+  noise->property("cutoff").set(-1.0);
+
+  std::vector<std::pair<std::size_t, double> > hits;
+  std::size_t num_hits = 0, num_lower = 0, num_bad = 0;
+  double      sum = 0e0;
+  for( std::size_t t = 0; t < trials; ++t )   {
+    hits.clear();
+    std::size_t n = noise->sparse(context, channels, threshold, hits);
+    if ( n != hits.size() ) ++num_bad;
+    for( std::size_t i = 0; i < hits.size(); ++i )   {
+      const auto& h = hits[i];
+      if ( h.first >= channels || h.second < threshold ) ++num_bad;
+      if ( i > 0 && h.first <= hits[i-1].first ) ++num_bad;
+      if ( h.first < channels/2 ) ++num_lower;
+      sum += h.second;
+    }
+    num_hits += n;
+  }
+  noise->release();
+
+  // Expectations of the dense generation
+  const double prob   = 0.5 * std::erfc(threshold / std::sqrt(2e0));
+  const double lambda = std::exp(-0.5 * threshold * threshold) / std::sqrt(2e0 * M_PI) / prob;
+  const double expected = double(channels) * double(trials) * prob;
+  const double dev_hits = (double(num_hits) - expected) / std::sqrt(expected * (1e0 - prob));
+  const double half     = double(channels/2) / double(channels);
+  const double dev_half = num_hits > 0
+    ? (double(num_lower) - double(num_hits) * half) / std::sqrt(double(num_hits) * half * (1e0 - half))
+    : 0e0;
+  const double mean     = num_hits > 0 ? sum / double(num_hits) : 0e0;
+  const double variance = 1e0 + threshold * lambda - lambda * lambda;
+  const double dev_mean = num_hits > 0 ? (mean - lambda) / std::sqrt(variance / double(num_hits)) : 0e0;
+
+  printout(INFO, "SparseNoise", "+++ %ld trials of %ld channels. Threshold: %.2f sigma",
+           trials, channels, threshold);
+  printout(INFO, "SparseNoise", "+++ Channels above threshold: %10ld expected: %12.1f  [%+6.2f sigma]",
+           num_hits, expected, dev_hits);
+  printout(INFO, "SparseNoise", "+++ Channels in lower half:   %10ld expected: %12.1f  [%+6.2f sigma]",
+           num_lower, double(num_hits) * half, dev_half);
+  printout(INFO, "SparseNoise", "+++ Mean value above threshold: %8.5f expected: %10.5f  [%+6.2f sigma]",
+           mean, lambda, dev_mean);
+  if ( num_bad > 0 )
+    printout(ERROR, "SparseNoise", "+++ %ld channels out of range, unordered or below threshold.", num_bad);
+  if ( std::abs(dev_hits) > 5e0 || std::abs(dev_half) > 5e0 || std::abs(dev_mean) > 5e0 )
+    printout(ERROR, "SparseNoise", "+++ The sparse noise statistics deviate from the expectation.");
+  else if ( 0 == num_bad )
+    printout(INFO, "SparseNoise", "+++ Sparse noise statistics agree with the expectation.");
+  return 1;
+}
+DECLARE_APPLY(DD4hep_DigiSparseNoise,test_SparseNoise)